@@ -26,6 +26,26 @@
 
 /* Read Button, this is on bit 1 of the port */
 #define READ_USR_BTN() (LL_GPIO_ReadInputPort(GPIOA) & LL_GPIO_PIN_0)
+#define USR_BTN_PRESSED() (READ_USR_BTN() == 0)     /* Pulled up, low when pressed */
+
+/* Panel, the button interrupts on EXTI line 0, PC13 has no timer channel so the LED is switched through BSRR */
+#define BTN_EXTI_SOURCE_PORT (LL_SYSCFG_EXTI_PORTA)
+#define BTN_EXTI_SOURCE_LINE (LL_SYSCFG_EXTI_LINE0)
+#define BTN_EXTI_LINE (LL_EXTI_LINE_0)
+#define BTN_EXTI_IRQN (EXTI0_IRQn)
+#define BTN_EXTI_IRQ_HANDLER EXTI0_IRQHandler
+
+#define LED_BSRR_PORT (GPIOC)
+#define LED_BSRR_ON (LL_GPIO_PIN_13 << 16)            /* Active low, reset is on */
+#define LED_BSRR_OFF (LL_GPIO_PIN_13)
+
+/* Pots, ADC1 scans PA1-2 (IN1-2), PA4-7 (IN4-7) and PB0-1 (IN8-9), PA3 is taken by MCLK */
+#define CONTROL_COUNT (8)
+#define CONTROL_CHANNELS {LL_ADC_CHANNEL_1, LL_ADC_CHANNEL_2, LL_ADC_CHANNEL_4, LL_ADC_CHANNEL_5, \
+                          LL_ADC_CHANNEL_6, LL_ADC_CHANNEL_7, LL_ADC_CHANNEL_8, LL_ADC_CHANNEL_9}
+#define CONTROL_SEQUENCE (LL_ADC_REG_SEQ_SCAN_ENABLE_8RANKS)
+#define CONTROL_PINS_A (LL_GPIO_PIN_1 | LL_GPIO_PIN_2 | LL_GPIO_PIN_4 | LL_GPIO_PIN_5 | LL_GPIO_PIN_6 | LL_GPIO_PIN_7)
+#define CONTROL_PINS_B (LL_GPIO_PIN_0 | LL_GPIO_PIN_1)
 
 /* SYS CLOCK */
 #define PLL_M (LL_RCC_PLLM_DIV_12)
@@ -47,6 +67,14 @@
 #define MCLK_PIN (LL_GPIO_PIN_3)
 #define MCLK_PORT (GPIOA)
 
+/* Full duplex input, I2S2ext SD on PB14, RX on DMA1 Stream 3 Channel 3 */
+#define I2S_EXT (I2S2ext)
+#define I2S_SDI_AF (LL_GPIO_AF_6)
+#define I2S_SDI_PIN (LL_GPIO_PIN_14)
+#define I2S_SDI_PORT (GPIOB)
+#define I2S_RX_DMA_STREAM (LL_DMA_STREAM_3)
+#define I2S_RX_DMA_CHANNEL (LL_DMA_CHANNEL_3)
+
 /* DMA (I2S)*/
 #define DMA (DMA1)
 #define DMA_IRQN (DMA1_Stream4_IRQn)
@@ -59,6 +87,75 @@
 #define DMA_IRQN (DMA1_Stream4_IRQn)
 #define DMA_IRQ_HANDLER DMA1_Stream4_IRQHandler
 
+/* MIDI (USART1, RX on DMA2 Stream 2 Channel 4, TX on DMA2 Stream 7 Channel 4) */
+#define MIDI_UART (USART1)
+#define MIDI_AF (LL_GPIO_AF_7)
+#define MIDI_RX_PIN (LL_GPIO_PIN_10)
+#define MIDI_RX_PORT (GPIOA)
+#define MIDI_UART_IRQN (USART1_IRQn)
+#define MIDI_UART_IRQ_HANDLER USART1_IRQHandler
+
+#define MIDI_DMA (DMA2)
+#define MIDI_DMA_STREAM (LL_DMA_STREAM_2)
+#define MIDI_DMA_CHANNEL (LL_DMA_CHANNEL_4)
+#define MIDI_DMA_CLEAR_FLAGS() (DMA2->LIFCR = DMA_LIFCR_CHTIF2 | DMA_LIFCR_CTCIF2 | DMA_LIFCR_CTEIF2 | DMA_LIFCR_CDMEIF2 | DMA_LIFCR_CFEIF2)
+#define MIDI_DMA_IRQN (DMA2_Stream2_IRQn)
+#define MIDI_DMA_IRQ_HANDLER DMA2_Stream2_IRQHandler
+
+#define MIDI_TX_PIN (LL_GPIO_PIN_9)
+#define MIDI_TX_PORT (GPIOA)
+#define MIDI_TX_DMA_STREAM (LL_DMA_STREAM_7)
+#define MIDI_TX_DMA_CHANNEL (LL_DMA_CHANNEL_4)
+#define MIDI_TX_DMA_CLEAR_FLAGS() (DMA2->HIFCR = DMA_HIFCR_CHTIF7 | DMA_HIFCR_CTCIF7 | DMA_HIFCR_CTEIF7 | DMA_HIFCR_CDMEIF7 | DMA_HIFCR_CFEIF7)
+
+/* Encoder, TIM4 in encoder mode on PB6 (CH1) and PB7 (CH2) */
+#define ENC_TIM (TIM4)
+#define ENC_AF (LL_GPIO_AF_2)
+#define ENC_A_PIN (LL_GPIO_PIN_6)
+#define ENC_A_PORT (GPIOB)
+#define ENC_B_PIN (LL_GPIO_PIN_7)
+#define ENC_B_PORT (GPIOB)
+
+/* Codec control for codecs that have it, I2C3 on PA8 (SCL) and PB4 (SDA) */
+#define I2C_BUS (I2C3)
+#define I2C_CLOCK (LL_APB1_GRP1_PERIPH_I2C3)
+#define I2C_SCL_AF (LL_GPIO_AF_4)
+#define I2C_SCL_PIN (LL_GPIO_PIN_8)
+#define I2C_SCL_PORT (GPIOA)
+#define I2C_SDA_AF (LL_GPIO_AF_9)
+#define I2C_SDA_PIN (LL_GPIO_PIN_4)
+#define I2C_SDA_PORT (GPIOB)
+#define I2C_EV_IRQN (I2C3_EV_IRQn)
+#define I2C_EV_IRQ_HANDLER I2C3_EV_IRQHandler
+#define I2C_ER_IRQN (I2C3_ER_IRQn)
+#define I2C_ER_IRQ_HANDLER I2C3_ER_IRQHandler
+
+/* PCM510x soft mute (XSMT), high to play */
+#define CODEC_MUTE_PIN (LL_GPIO_PIN_13)
+#define CODEC_MUTE_PORT (GPIOB)
+
+/* OLED (SSD1306, or SH1106 with -DOLED=sh1106), SPI1 on PB3 (SCK) and PB5 (MOSI), TX on DMA2 Stream 3 Channel 3 */
+#define OLED_SPI (SPI1)
+#define OLED_AF (LL_GPIO_AF_5)
+#define OLED_SPI_PRESCALER (LL_SPI_BAUDRATEPRESCALER_DIV16)   /* 6.25MHz from APB2 */
+#define OLED_SCK_PIN (LL_GPIO_PIN_3)
+#define OLED_SCK_PORT (GPIOB)
+#define OLED_MOSI_PIN (LL_GPIO_PIN_5)
+#define OLED_MOSI_PORT (GPIOB)
+#define OLED_DC_PIN (LL_GPIO_PIN_15)                     /* PB4 is the codec I2C SDA */
+#define OLED_DC_PORT (GPIOA)
+#define OLED_CS_PIN (LL_GPIO_PIN_8)
+#define OLED_CS_PORT (GPIOB)
+#define OLED_RES_PIN (LL_GPIO_PIN_9)
+#define OLED_RES_PORT (GPIOB)
+
+#define OLED_DMA (DMA2)
+#define OLED_DMA_STREAM (LL_DMA_STREAM_3)
+#define OLED_DMA_CHANNEL (LL_DMA_CHANNEL_3)
+#define OLED_DMA_CLEAR_FLAGS() (DMA2->LIFCR = DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTCIF3 | DMA_LIFCR_CTEIF3 | DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3)
+#define OLED_DMA_IRQN (DMA2_Stream3_IRQn)
+#define OLED_DMA_IRQ_HANDLER DMA2_Stream3_IRQHandler
+
 /* API */
 bool board_init(void);
 
@@ -0,0 +1,45 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __CODEC_H__
+#define __CODEC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  The DAC or codec on the I2S bus. Exactly one driver in bsp/codecs is
+  built, chosen by CODEC in source/CMakeLists.txt, each implements the API
+  below against its own control port (I2C, pins or nothing at all).
+
+  init() leaves the codec powered down. audio_start() agrees the format
+  with it through set_format(), starts the I2S clocks and then powers it
+  up. The rest may be called at any time from a task and do not wait for
+  the codec, done is called (from an interrupt for I2C codecs) once the
+  change has been made.
+*/
+
+/* I2S (Philips) data format, 16 bit words in 16 bit slots, 24 and 32 bit words in 32 bit slots */
+typedef struct
+{
+  uint32_t rate;                    /* Sample rate in Hz */
+  uint8_t bits;                     /* Significant bits per sample, 16, 24 or 32 */
+  bool mclk;                        /* Set by the codec if it needs MCLK, which is 256fs */
+} codec_format_t;
+
+/* Completion, ok is false if the codec did not take the change */
+typedef void (*codec_done_t)(void *context, bool ok);
+
+/* API */
+bool codec_init(void);
+bool codec_set_format(codec_format_t *format);
+bool codec_set_volume(uint8_t volume, codec_done_t done, void *context);
+bool codec_set_mute(bool mute, codec_done_t done, void *context);
+bool codec_set_power(bool on, codec_done_t done, void *context);
+
+#endif /* __CODEC_H__ */
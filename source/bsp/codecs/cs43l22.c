@@ -0,0 +1,192 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "board.h"
+#include "codec.h"
+#include "i2c.h"
+
+/* Control Memory Address Pointers (registers) for CS32L22 DAC */
+#define CS43L22_REG_CHIP_ID 0x01
+#define CS43L22_REG_POWER_CTL1 0x02
+#define CS43L22_REG_POWER_CTL2 0x04
+#define CS43L22_REG_CLOCKING_CTL 0x05
+#define CS43L22_REG_INTERFACE_CTL1 0x06
+#define CS43L22_REG_PLAYBACK_CTL2 0x0F
+#define CS43L22_REG_MASTER_A_VOL 0x20
+#define CS43L22_REG_MASTER_B_VOL 0x21
+#define CS43L22_REG_SPEAKER_A_VOL 0x24
+#define CS43L22_REG_SPEAKER_B_VOL 0x25
+
+/* Configuration Values (parameters) */
+#define OUTPUT_DEVICE_AUTO 0x05
+#define CODEC_STANDARD 0x04
+#define SPKR_ATTENUATION 0x00
+#define SPKR_MODE 0x06
+#define VOLUME 80
+
+/* Power control 1 */
+#define POWER_CTL1_DOWN 0x01
+#define POWER_CTL1_UP 0x9E
+
+/* Interface control 1, slave, I2S up to 24 bit, longer words are truncated */
+#define INTERFACE_CTL1_I2S 0x04
+
+/* Playback control 2, limiter on and the headphone and speaker mutes */
+#define PLAYBACK_CTL2_UNMUTED 0x02
+#define PLAYBACK_CTL2_MUTED 0xF2
+
+/* Master volume, signed 0.5dB steps, this is the -102dB floor */
+#define MASTER_VOL_MIN 0x34
+
+/* I2C address */
+#define CS43L22_I2C_ADDR (0x94U)
+
+/* The control port is rated to 100kHz */
+#define CS43L22_I2C_SPEED (100000)
+
+/*
+  Cirrus CS43L22, the Discovery's onboard DAC and headphone/speaker amp.
+
+  It needs MCLK and detects the sample rate from its ratio to LRCK, so the
+  format only sets the interface. Register writes are queued on the I2C
+  driver (i2c.c) and nothing here waits for them.
+*/
+
+/* Configure while powered down, everything but the interface, volume and power up */
+static const i2c_reg_t init_sequence[] = {
+    {CS43L22_REG_POWER_CTL1, POWER_CTL1_DOWN},          /* Power down for configuration */
+    {CS43L22_REG_POWER_CTL2, 0x0A},
+    {CS43L22_REG_CLOCKING_CTL, 0x81},                   /* Clock configuration - auto detect, div by 2 */
+    {0x0A, 0x00},                                       /* Disable digital soft ramp and other DSP features */
+    {0x14, 0x00},                                       /* Disable digital EQ effects */
+    {0x1A, 0x00},                                       /* Tone control off */
+    {0x1B, 0x00},                                       /* Bass=0, Treble=0 */
+    {CS43L22_REG_PLAYBACK_CTL2, PLAYBACK_CTL2_UNMUTED}, /* Limiter ON, PCM mixer OFF */
+    {0x27, 0x00},                                       /* Limiter default attack/release */
+    {0x1C, 0x90},                                       /* Limiter threshold (-1.5dB) */
+    {CS43L22_REG_SPEAKER_A_VOL, 0x00},                  /* Speakers, no attenuation */
+    {CS43L22_REG_SPEAKER_B_VOL, 0x00},
+    {0x22, 0x00},                                       /* Headphones, no attenuation */
+    {0x23, 0x00},
+};
+
+/**
+ * codec_init
+ * \brief releases the codec from reset and queues its configuration, it stays powered down.
+ * \return true if success, false otherwise
+ */
+bool codec_init(void)
+{
+#ifdef CODEC_RESET_PIN
+  LL_GPIO_InitTypeDef reset =
+      {
+          .Pin = CODEC_RESET_PIN,
+          .Mode = LL_GPIO_MODE_OUTPUT,
+          .Speed = LL_GPIO_SPEED_FREQ_LOW,
+          .OutputType = LL_GPIO_OUTPUT_PUSHPULL,
+          .Pull = LL_GPIO_PULL_NO,
+      };
+
+  if(LL_GPIO_Init(CODEC_RESET_PORT, &reset) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* Release the device from reset */
+  LL_GPIO_SetOutputPin(CODEC_RESET_PORT, CODEC_RESET_PIN);
+#endif
+
+  if(!i2c_init(CS43L22_I2C_SPEED))
+  {
+    return false;
+  }
+
+  return i2c_write_regs(CS43L22_I2C_ADDR, init_sequence, sizeof(init_sequence) / sizeof(init_sequence[0]), NULL, NULL) &&
+         codec_set_volume(100, NULL, NULL);
+}
+
+/**
+ * codec_set_format
+ * \brief queues the interface format, the sample rate is detected from MCLK.
+ * \param format the format, mclk is set
+ * \return false if the codec cannot play the format
+ */
+bool codec_set_format(codec_format_t *format)
+{
+  /* Single and double speed modes */
+  if(format->rate < 4000 || format->rate > 100000)
+  {
+    return false;
+  }
+
+  if(format->bits != 16 && format->bits != 24 && format->bits != 32)
+  {
+    return false;
+  }
+
+  format->mclk = true;
+
+  i2c_reg_t reg = {CS43L22_REG_INTERFACE_CTL1, INTERFACE_CTL1_I2S};
+  return i2c_write_regs(CS43L22_I2C_ADDR, &reg, 1, NULL, NULL);
+}
+
+/**
+ * codec_set_volume
+ * \brief queues a master volume change for both channels.
+ * \param volume 0-100, 100 is 0dB and each step below is 0.5dB down, 0 is the -102dB floor
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_volume(uint8_t volume, codec_done_t done, void *context)
+{
+  if(volume > 100)
+  {
+    volume = 100;
+  }
+
+  /* Two's complement half dBs, 0x00 is 0dB and 0xFF is -0.5dB */
+  uint8_t vol = volume == 0 ? MASTER_VOL_MIN : (uint8_t)(volume - 100);
+
+  i2c_reg_t regs[] = {
+      {CS43L22_REG_MASTER_A_VOL, vol},
+      {CS43L22_REG_MASTER_B_VOL, vol},
+  };
+
+  return i2c_write_regs(CS43L22_I2C_ADDR, regs, 2, done, context);
+}
+
+/**
+ * codec_set_mute
+ * \brief queues muting or unmuting the headphone and speaker outputs.
+ * \param mute true to mute
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_mute(bool mute, codec_done_t done, void *context)
+{
+  i2c_reg_t reg = {CS43L22_REG_PLAYBACK_CTL2, mute ? PLAYBACK_CTL2_MUTED : PLAYBACK_CTL2_UNMUTED};
+
+  return i2c_write_regs(CS43L22_I2C_ADDR, &reg, 1, done, context);
+}
+
+/**
+ * codec_set_power
+ * \brief queues powering the codec up or down, MCLK must be running to power up.
+ * \param on true to power up
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_power(bool on, codec_done_t done, void *context)
+{
+  i2c_reg_t reg = {CS43L22_REG_POWER_CTL1, on ? POWER_CTL1_UP : POWER_CTL1_DOWN};
+
+  return i2c_write_regs(CS43L22_I2C_ADDR, &reg, 1, done, context);
+}
@@ -0,0 +1,136 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stddef.h>
+
+#include "board.h"
+#include "codec.h"
+
+/*
+  TI PCM5100/5101/5102 DACs in hardware mode, and any other DAC with no
+  control port such as the UDA1334A.
+
+  They lock a PLL to the bit clock so need no MCLK, and detect the rate
+  and word length themselves (FMT tied low for I2S). The only control is
+  the soft mute pin XSMT, on CODEC_MUTE_PIN if the board wires it, which
+  also stands in for power. There is no volume control, the synth's own
+  volume does the job.
+*/
+
+/* Rates the PLL locks to */
+#define PCM510X_RATE_MIN (8000)
+#define PCM510X_RATE_MAX (384000)
+
+/**
+ * codec_init
+ * \brief holds the DAC muted until it is powered up.
+ * \return true if success, false otherwise
+ */
+bool codec_init(void)
+{
+#ifdef CODEC_MUTE_PIN
+  LL_GPIO_ResetOutputPin(CODEC_MUTE_PORT, CODEC_MUTE_PIN);
+
+  if (LL_GPIO_Init(CODEC_MUTE_PORT, &(LL_GPIO_InitTypeDef){
+          .Pin = CODEC_MUTE_PIN,
+          .Mode = LL_GPIO_MODE_OUTPUT,
+          .Speed = LL_GPIO_SPEED_FREQ_LOW,
+          .OutputType = LL_GPIO_OUTPUT_PUSHPULL,
+          .Pull = LL_GPIO_PULL_NO}) != SUCCESS)
+  {
+    return false;
+  }
+#endif
+
+  return true;
+}
+
+/**
+ * codec_set_format
+ * \brief checks the DAC can lock to the format.
+ * \param format the format, mclk is cleared
+ * \return false if the DAC cannot play the format
+ */
+bool codec_set_format(codec_format_t *format)
+{
+  if (format->rate < PCM510X_RATE_MIN || format->rate > PCM510X_RATE_MAX)
+  {
+    return false;
+  }
+
+  if (format->bits != 16 && format->bits != 24 && format->bits != 32)
+  {
+    return false;
+  }
+
+  format->mclk = false;
+  return true;
+}
+
+/**
+ * codec_set_volume
+ * \brief not supported, there is no volume control.
+ * \return false
+ */
+bool codec_set_volume(uint8_t volume, codec_done_t done, void *context)
+{
+  return false;
+}
+
+/**
+ * codec_set_mute
+ * \brief soft mutes or unmutes the DAC through XSMT.
+ * \param mute true to mute
+ * \param done called before returning, may be NULL
+ * \param context passed to done
+ * \return false if the board has no mute pin
+ */
+bool codec_set_mute(bool mute, codec_done_t done, void *context)
+{
+#ifdef CODEC_MUTE_PIN
+  if (mute)
+  {
+    LL_GPIO_ResetOutputPin(CODEC_MUTE_PORT, CODEC_MUTE_PIN);
+  }
+  else
+  {
+    LL_GPIO_SetOutputPin(CODEC_MUTE_PORT, CODEC_MUTE_PIN);
+  }
+
+  if (done != NULL)
+  {
+    done(context, true);
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * codec_set_power
+ * \brief the DAC powers itself, this unmutes it when on and mutes it when off.
+ * \param on true to power up
+ * \param done called before returning, may be NULL
+ * \param context passed to done
+ * \return true, a DAC with no mute pin plays as soon as it has clocks
+ */
+bool codec_set_power(bool on, codec_done_t done, void *context)
+{
+#ifdef CODEC_MUTE_PIN
+  return codec_set_mute(!on, done, context);
+#else
+  if (done != NULL)
+  {
+    done(context, true);
+  }
+
+  return true;
+#endif
+}
@@ -0,0 +1,216 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "board.h"
+#include "codec.h"
+#include "i2c.h"
+
+/*
+  Wolfson (Cirrus) WM8731 stereo codec, 24 bit up to 96kHz with a line
+  input ADC.
+
+  It runs as an I2S slave from MCLK at 256fs in normal mode, a 24.576MHz
+  MCLK for 96kHz is halved internally. Its registers are 9 bits wide
+  behind a 7 bit address, each write is two bytes: the address shifted up
+  with the top data bit, then the low 8 data bits. Writes are queued on
+  the I2C driver (i2c.c) and nothing here waits for them.
+
+  Configuration needs the digital interface inactive, the outputs are
+  powered last to keep the power up pop down.
+*/
+
+/* Registers */
+#define WM8731_REG_LEFT_LINE_IN 0x00
+#define WM8731_REG_LEFT_HP_OUT 0x02
+#define WM8731_REG_ANALOGUE_PATH 0x04
+#define WM8731_REG_DIGITAL_PATH 0x05
+#define WM8731_REG_POWER_DOWN 0x06
+#define WM8731_REG_INTERFACE 0x07
+#define WM8731_REG_SAMPLING 0x08
+#define WM8731_REG_ACTIVE 0x09
+#define WM8731_REG_RESET 0x0F
+
+/* Line inputs at 0dB unmuted, both channels in one write */
+#define LINE_IN_BOTH 0x100
+#define LINE_IN_0DB 0x017
+
+/* Headphone outputs, both channels with zero cross detection, 1dB steps */
+#define HP_OUT_BOTH 0x180
+#define HP_OUT_0DB 0x79
+#define HP_OUT_MUTE 0x2F
+
+/* DAC to the outputs, line in to the ADC, mic muted */
+#define ANALOGUE_PATH_DAC 0x012
+
+/* DAC soft mute, the ADC high pass filter is left on */
+#define DIGITAL_PATH_UNMUTED 0x000
+#define DIGITAL_PATH_MUTED 0x008
+
+/* Power down bits, the microphone, oscillator and clock out are never used */
+#define POWER_OUTPUTS_OFF 0x072
+#define POWER_ON 0x062
+#define POWER_OFF 0x0FF
+
+/* Interface, slave, I2S with the word length in bits 3:2 */
+#define INTERFACE_I2S 0x002
+#define INTERFACE_IWL_16 (0 << 2)
+#define INTERFACE_IWL_24 (2 << 2)
+#define INTERFACE_IWL_32 (3 << 2)
+
+/* I2C address with CSB low */
+#define WM8731_I2C_ADDR (0x34U)
+
+/* Fast mode */
+#define WM8731_I2C_SPEED (400000)
+
+/* Sampling control for MCLK at 256fs, the higher rates set CLKIDIV2 */
+static const struct
+{
+  uint32_t rate;
+  uint16_t sampling;
+} rates[] = {
+    {44100, 0x020},
+    {48000, 0x000},
+    {88200, 0x07C},
+    {96000, 0x05C},
+};
+
+/* Private functions */
+static i2c_reg_t reg(uint8_t address, uint16_t data);
+
+/**
+ * codec_init
+ * \brief resets the codec and queues its configuration, it stays powered down.
+ * \return true if success, false otherwise
+ */
+bool codec_init(void)
+{
+  if (!i2c_init(WM8731_I2C_SPEED))
+  {
+    return false;
+  }
+
+  i2c_reg_t sequence[] = {
+      reg(WM8731_REG_RESET, 0),
+      reg(WM8731_REG_POWER_DOWN, POWER_OUTPUTS_OFF),
+      reg(WM8731_REG_LEFT_LINE_IN, LINE_IN_BOTH | LINE_IN_0DB),
+      reg(WM8731_REG_ANALOGUE_PATH, ANALOGUE_PATH_DAC),
+      reg(WM8731_REG_DIGITAL_PATH, DIGITAL_PATH_UNMUTED),
+  };
+
+  return i2c_write_regs(WM8731_I2C_ADDR, sequence, sizeof(sequence) / sizeof(sequence[0]), NULL, NULL) &&
+         codec_set_volume(100, NULL, NULL);
+}
+
+/**
+ * codec_set_format
+ * \brief queues the interface format and sample rate.
+ * \param format the format, mclk is set
+ * \return false if the codec cannot play the format
+ * \note the interface is left inactive until the codec is powered up.
+ */
+bool codec_set_format(codec_format_t *format)
+{
+  uint16_t interface;
+
+  switch (format->bits)
+  {
+  case 16:
+    interface = INTERFACE_I2S | INTERFACE_IWL_16;
+    break;
+  case 24:
+    interface = INTERFACE_I2S | INTERFACE_IWL_24;
+    break;
+  case 32:
+    interface = INTERFACE_I2S | INTERFACE_IWL_32;
+    break;
+  default:
+    return false;
+  }
+
+  for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+  {
+    if (rates[i].rate == format->rate)
+    {
+      format->mclk = true;
+
+      i2c_reg_t sequence[] = {
+          reg(WM8731_REG_ACTIVE, 0),
+          reg(WM8731_REG_INTERFACE, interface),
+          reg(WM8731_REG_SAMPLING, rates[i].sampling),
+      };
+
+      return i2c_write_regs(WM8731_I2C_ADDR, sequence, sizeof(sequence) / sizeof(sequence[0]), NULL, NULL);
+    }
+  }
+
+  return false;
+}
+
+/**
+ * codec_set_volume
+ * \brief queues a headphone volume change for both channels.
+ * \param volume 0-100, 100 is 0dB and every two steps below is 1dB down, 0 mutes
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_volume(uint8_t volume, codec_done_t done, void *context)
+{
+  if (volume > 100)
+  {
+    volume = 100;
+  }
+
+  uint16_t vol = volume == 0 ? HP_OUT_MUTE : HP_OUT_0DB - (100 - volume) / 2;
+  i2c_reg_t write = reg(WM8731_REG_LEFT_HP_OUT, HP_OUT_BOTH | vol);
+
+  return i2c_write_regs(WM8731_I2C_ADDR, &write, 1, done, context);
+}
+
+/**
+ * codec_set_mute
+ * \brief queues a DAC soft mute or unmute.
+ * \param mute true to mute
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_mute(bool mute, codec_done_t done, void *context)
+{
+  i2c_reg_t write = reg(WM8731_REG_DIGITAL_PATH, mute ? DIGITAL_PATH_MUTED : DIGITAL_PATH_UNMUTED);
+
+  return i2c_write_regs(WM8731_I2C_ADDR, &write, 1, done, context);
+}
+
+/**
+ * codec_set_power
+ * \brief queues powering the codec up or down, MCLK must be running to power up.
+ * \param on true to power up
+ * \param done called from the I2C interrupt once written, may be NULL
+ * \param context passed to done
+ * \return false if the I2C queue is full, nothing is changed
+ */
+bool codec_set_power(bool on, codec_done_t done, void *context)
+{
+  i2c_reg_t sequence[] = {
+      reg(WM8731_REG_ACTIVE, on ? 1 : 0),
+      reg(WM8731_REG_POWER_DOWN, on ? POWER_ON : POWER_OFF),
+  };
+
+  return i2c_write_regs(WM8731_I2C_ADDR, sequence, 2, done, context);
+}
+
+/**
+ * reg
+ * \brief packs a 9 bit register write into its two bytes.
+ */
+static i2c_reg_t reg(uint8_t address, uint16_t data)
+{
+  return (i2c_reg_t){(uint8_t)((address << 1) | ((data >> 8) & 1)), (uint8_t)data};
+}
@@ -9,8 +9,6 @@
 
 #include "board.h"
 
-extern void cs43l22_init(void);
-
 bool board_init()
 { 
   /* Enable the peripheral clocks */ 
@@ -21,8 +19,15 @@ bool board_init()
   LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOE);
 
   LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_SPI3);
+  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_SPI2);   /* OLED */
   LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);  
-  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_USART2);
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);  
+
+  /* MIDI is on USART1 (PB7), USART2 RX would need DMA1 Stream 5 which I2S3 uses */
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_USART1);
+
+  /* Encoder */
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_TIM1);
 
   /* LEDs */
   if(LL_GPIO_Init(GPIOD, &(LL_GPIO_InitTypeDef){
@@ -38,9 +43,6 @@ bool board_init()
   LL_GPIO_SetPinPull(GPIOA, LL_GPIO_PIN_0, LL_GPIO_PULL_UP);
   LL_GPIO_SetPinMode(GPIOA, LL_GPIO_PIN_0, LL_GPIO_MODE_INPUT);
 
-  /* Start the Discovery's onboard codec */
-  cs43l22_init();
-
   return true;
 }
 
@@ -9,6 +9,10 @@
 #ifndef __BOARD_H__
 #define __BOARD_H__
 
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
 #include "stm32f4xx.h"
 #include "stm32f4xx_ll_gpio.h"
 #include "stm32f4xx_ll_rcc.h"
@@ -33,6 +37,28 @@
 
 /* USER Button */
 #define READ_USR_BTN() (LL_GPIO_ReadInputPort(GPIOA) & LL_GPIO_PIN_0)
+#define USR_BTN_PRESSED() (READ_USR_BTN() != 0)     /* Pulled down on the board, high when pressed */
+
+/* Panel, the button interrupts on EXTI line 0 and the green LED (PD12) is TIM4 CH1 PWM */
+#define BTN_EXTI_SOURCE_PORT (LL_SYSCFG_EXTI_PORTA)
+#define BTN_EXTI_SOURCE_LINE (LL_SYSCFG_EXTI_LINE0)
+#define BTN_EXTI_LINE (LL_EXTI_LINE_0)
+#define BTN_EXTI_IRQN (EXTI0_IRQn)
+#define BTN_EXTI_IRQ_HANDLER EXTI0_IRQHandler
+
+#define LED_PWM_TIM (TIM4)
+#define LED_PWM_PIN (LL_GPIO_PIN_12)
+#define LED_PWM_PORT (GPIOD)
+#define LED_PWM_AF (LL_GPIO_AF_2)
+
+/* Pots, ADC1 scans PA1-3 (IN1-3), PB0-1 (IN8-9), PC1-2 (IN11-12) and PC4 (IN14) */
+#define CONTROL_COUNT (8)
+#define CONTROL_CHANNELS {LL_ADC_CHANNEL_1, LL_ADC_CHANNEL_2, LL_ADC_CHANNEL_3, LL_ADC_CHANNEL_8, \
+                          LL_ADC_CHANNEL_9, LL_ADC_CHANNEL_11, LL_ADC_CHANNEL_12, LL_ADC_CHANNEL_14}
+#define CONTROL_SEQUENCE (LL_ADC_REG_SEQ_SCAN_ENABLE_8RANKS)
+#define CONTROL_PINS_A (LL_GPIO_PIN_1 | LL_GPIO_PIN_2 | LL_GPIO_PIN_3)
+#define CONTROL_PINS_B (LL_GPIO_PIN_0 | LL_GPIO_PIN_1)
+#define CONTROL_PINS_C (LL_GPIO_PIN_1 | LL_GPIO_PIN_2 | LL_GPIO_PIN_4)
 
 /* Clock dividers  */
 #define PLL_M (LL_RCC_PLLM_DIV_4)
@@ -54,6 +80,14 @@
 #define MCLK_PIN (LL_GPIO_PIN_7)           
 #define MCLK_PORT (GPIOC)
 
+/* Full duplex input, I2S3ext SD on PC11, RX on DMA1 Stream 0 Channel 3 */
+#define I2S_EXT (I2S3ext)
+#define I2S_SDI_AF (LL_GPIO_AF_5)
+#define I2S_SDI_PIN (LL_GPIO_PIN_11)
+#define I2S_SDI_PORT (GPIOC)
+#define I2S_RX_DMA_STREAM (LL_DMA_STREAM_0)
+#define I2S_RX_DMA_CHANNEL (LL_DMA_CHANNEL_3)
+
 
 /* DMA configuration */
 #define DMA (DMA1)                         /* The DMA periperhal, stream and channel are specific to the I2S peripheral */
@@ -66,6 +100,75 @@
 #define DMA_IRQN (DMA1_Stream5_IRQn)       /* The interrupt number and interrupt handler function */   
 #define DMA_IRQ_HANDLER DMA1_Stream5_IRQHandler
 
+/* MIDI (USART1, RX on DMA2 Stream 2 Channel 4, TX on DMA2 Stream 7 Channel 4) */
+#define MIDI_UART (USART1)
+#define MIDI_AF (LL_GPIO_AF_7)
+#define MIDI_RX_PIN (LL_GPIO_PIN_7)
+#define MIDI_RX_PORT (GPIOB)
+#define MIDI_UART_IRQN (USART1_IRQn)
+#define MIDI_UART_IRQ_HANDLER USART1_IRQHandler
+
+#define MIDI_DMA (DMA2)
+#define MIDI_DMA_STREAM (LL_DMA_STREAM_2)
+#define MIDI_DMA_CHANNEL (LL_DMA_CHANNEL_4)
+#define MIDI_DMA_CLEAR_FLAGS() (DMA2->LIFCR = DMA_LIFCR_CHTIF2 | DMA_LIFCR_CTCIF2 | DMA_LIFCR_CTEIF2 | DMA_LIFCR_CDMEIF2 | DMA_LIFCR_CFEIF2)
+#define MIDI_DMA_IRQN (DMA2_Stream2_IRQn)
+#define MIDI_DMA_IRQ_HANDLER DMA2_Stream2_IRQHandler
+
+/* PA9 is also the USB OTG VBUS sense on this board, leave the USB socket unplugged when using MIDI out */
+#define MIDI_TX_PIN (LL_GPIO_PIN_9)
+#define MIDI_TX_PORT (GPIOA)
+#define MIDI_TX_DMA_STREAM (LL_DMA_STREAM_7)
+#define MIDI_TX_DMA_CHANNEL (LL_DMA_CHANNEL_4)
+#define MIDI_TX_DMA_CLEAR_FLAGS() (DMA2->HIFCR = DMA_HIFCR_CHTIF7 | DMA_HIFCR_CTCIF7 | DMA_HIFCR_CTEIF7 | DMA_HIFCR_CDMEIF7 | DMA_HIFCR_CFEIF7)
+
+/* Encoder, TIM1 in encoder mode on PE9 (CH1) and PE11 (CH2) */
+#define ENC_TIM (TIM1)
+#define ENC_AF (LL_GPIO_AF_1)
+#define ENC_A_PIN (LL_GPIO_PIN_9)
+#define ENC_A_PORT (GPIOE)
+#define ENC_B_PIN (LL_GPIO_PIN_11)
+#define ENC_B_PORT (GPIOE)
+
+/* Codec control, I2C1 on PB6 (SCL) and PB9 (SDA), the CS43L22 is held in reset by PD4 */
+#define I2C_BUS (I2C1)
+#define I2C_CLOCK (LL_APB1_GRP1_PERIPH_I2C1)
+#define I2C_SCL_AF (LL_GPIO_AF_4)
+#define I2C_SCL_PIN (LL_GPIO_PIN_6)
+#define I2C_SCL_PORT (GPIOB)
+#define I2C_SDA_AF (LL_GPIO_AF_4)
+#define I2C_SDA_PIN (LL_GPIO_PIN_9)
+#define I2C_SDA_PORT (GPIOB)
+#define I2C_EV_IRQN (I2C1_EV_IRQn)
+#define I2C_EV_IRQ_HANDLER I2C1_EV_IRQHandler
+#define I2C_ER_IRQN (I2C1_ER_IRQn)
+#define I2C_ER_IRQ_HANDLER I2C1_ER_IRQHandler
+
+#define CODEC_RESET_PIN (LL_GPIO_PIN_4)
+#define CODEC_RESET_PORT (GPIOD)
+
+/* OLED (SSD1306, or SH1106 with -DOLED=sh1106), SPI2 on PB13 (SCK) and PB15 (MOSI), TX on DMA1 Stream 4 Channel 0 */
+#define OLED_SPI (SPI2)
+#define OLED_AF (LL_GPIO_AF_5)
+#define OLED_SPI_PRESCALER (LL_SPI_BAUDRATEPRESCALER_DIV8)    /* 6.25MHz from APB1 */
+#define OLED_SCK_PIN (LL_GPIO_PIN_13)
+#define OLED_SCK_PORT (GPIOB)
+#define OLED_MOSI_PIN (LL_GPIO_PIN_15)
+#define OLED_MOSI_PORT (GPIOB)
+#define OLED_DC_PIN (LL_GPIO_PIN_14)
+#define OLED_DC_PORT (GPIOB)
+#define OLED_CS_PIN (LL_GPIO_PIN_12)
+#define OLED_CS_PORT (GPIOB)
+#define OLED_RES_PIN (LL_GPIO_PIN_11)
+#define OLED_RES_PORT (GPIOB)
+
+#define OLED_DMA (DMA1)
+#define OLED_DMA_STREAM (LL_DMA_STREAM_4)
+#define OLED_DMA_CHANNEL (LL_DMA_CHANNEL_0)
+#define OLED_DMA_CLEAR_FLAGS() (DMA1->HIFCR = DMA_HIFCR_CHTIF4 | DMA_HIFCR_CTCIF4 | DMA_HIFCR_CTEIF4 | DMA_HIFCR_CDMEIF4 | DMA_HIFCR_CFEIF4)
+#define OLED_DMA_IRQN (DMA1_Stream4_IRQn)
+#define OLED_DMA_IRQ_HANDLER DMA1_Stream4_IRQHandler
+
 /* API */
 bool board_init(void);
 
@@ -0,0 +1,217 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_crc.h"
+
+/*
+  Internal flash programming and the CRC unit.
+
+  The F411 has a single flash bank, any instruction fetch or constant read
+  from flash stalls while an erase or program operation is running. A word
+  program takes ~16us which is harmless, a 128KB sector erase takes one to
+  two seconds during which nothing running from flash (tasks, interrupts,
+  the kernel tick) can make progress, only the DMA carries on. Erase through
+  dae_flash_erase(), it holds the DAE on a silent output and stops MIDI
+  input for the window so neither the audio nor the MIDI receive ring can
+  be overrun.
+
+  Each erase and each word program runs with interrupts masked, so tasks
+  sharing the flash controller cannot interleave their register sequences.
+  This costs nothing, the stall already holds off every interrupt handler.
+*/
+
+/* Flash key sequence */
+#define FLASH_KEY1 (0x45670123U)
+#define FLASH_KEY2 (0xCDEF89ABU)
+
+/* Error flags in the status register */
+#define FLASH_SR_ERRORS (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_RDERR)
+
+/* Start address of each sector, the last entry is the end of flash */
+static const uint32_t sector_start[] = {
+    0x08000000, 0x08004000, 0x08008000, 0x0800C000, /* 16KB */
+    0x08010000,                                     /* 64KB */
+    0x08020000, 0x08040000, 0x08060000,             /* 128KB */
+    0x08080000,
+};
+
+#define SECTOR_COUNT (sizeof(sector_start) / sizeof(sector_start[0]) - 1)
+
+/* Private functions */
+static void unlock(void);
+static void lock(void);
+static bool wait(void);
+static void flush_caches(void);
+
+/**
+ * flash_init
+ * \brief enables the CRC unit used by flash_crc()
+ */
+void flash_init(void)
+{
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_CRC);
+}
+
+/**
+ * flash_erase
+ * \brief erases the sector holding an address, blocking
+ * \param address any address in the sector
+ * \return true if success, false if the address is not in flash or the erase failed
+ */
+bool flash_erase(uint32_t address)
+{
+  uint32_t sector = 0;
+
+  while (sector < SECTOR_COUNT && address >= sector_start[sector + 1])
+  {
+    sector++;
+  }
+
+  if (address < sector_start[0] || sector >= SECTOR_COUNT)
+  {
+    return false;
+  }
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  unlock();
+
+  /* 32 bit parallelism, valid for a 2.7-3.6V supply */
+  MODIFY_REG(FLASH->CR, FLASH_CR_PSIZE | FLASH_CR_SNB | FLASH_CR_PG,
+             FLASH_CR_PSIZE_1 | (sector << FLASH_CR_SNB_Pos) | FLASH_CR_SER);
+  SET_BIT(FLASH->CR, FLASH_CR_STRT);
+
+  bool ok = wait();
+
+  CLEAR_BIT(FLASH->CR, FLASH_CR_SER | FLASH_CR_SNB);
+  lock();
+  flush_caches();
+
+  __set_PRIMASK(primask);
+
+  return ok;
+}
+
+/**
+ * flash_program
+ * \brief programs words into erased flash
+ * \param address the destination, word aligned
+ * \param data the words to program
+ * \param words the number of words
+ * \return true if success, false on a programming error
+ * \note interrupts and higher priority tasks run between words.
+ */
+bool flash_program(uint32_t address, const uint32_t *data, size_t words)
+{
+  bool ok = true;
+
+  for (size_t i = 0; i < words && ok; i++)
+  {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    unlock();
+    MODIFY_REG(FLASH->CR, FLASH_CR_PSIZE | FLASH_CR_SER, FLASH_CR_PSIZE_1 | FLASH_CR_PG);
+
+    *(volatile uint32_t *)(address + i * sizeof(uint32_t)) = data[i];
+    __DSB();
+    ok = wait();
+
+    CLEAR_BIT(FLASH->CR, FLASH_CR_PG);
+    lock();
+
+    __set_PRIMASK(primask);
+  }
+
+  flush_caches();
+
+  return ok;
+}
+
+/**
+ * flash_crc
+ * \brief CRC-32 of a block of words using the CRC unit
+ * \details polynomial 0x04C11DB7, initial value 0xFFFFFFFF, each word fed MSB
+ *          first with no reflection or final XOR (CRC-32/MPEG-2 over the
+ *          little endian words).
+ * \param data the words, may be in flash or RAM
+ * \param words the number of words
+ * \return the CRC
+ * \note the CRC unit is shared, only call from one task.
+ */
+uint32_t flash_crc(const uint32_t *data, size_t words)
+{
+  LL_CRC_ResetCRCCalculationUnit(CRC);
+
+  for (size_t i = 0; i < words; i++)
+  {
+    LL_CRC_FeedData32(CRC, data[i]);
+  }
+
+  return LL_CRC_ReadData32(CRC);
+}
+
+/**
+ * unlock
+ * \brief unlocks the flash control register
+ */
+static void unlock(void)
+{
+  if (READ_BIT(FLASH->CR, FLASH_CR_LOCK))
+  {
+    WRITE_REG(FLASH->KEYR, FLASH_KEY1);
+    WRITE_REG(FLASH->KEYR, FLASH_KEY2);
+  }
+
+  /* Clear errors left by a previous operation, they would block this one */
+  WRITE_REG(FLASH->SR, FLASH_SR_ERRORS | FLASH_SR_EOP);
+}
+
+/**
+ * lock
+ * \brief locks the flash control register
+ */
+static void lock(void)
+{
+  SET_BIT(FLASH->CR, FLASH_CR_LOCK);
+}
+
+/**
+ * wait
+ * \brief waits for the current operation to finish
+ * \return true if it finished without error
+ */
+static bool wait(void)
+{
+  while (READ_BIT(FLASH->SR, FLASH_SR_BSY))
+    ;
+
+  uint32_t errors = READ_BIT(FLASH->SR, FLASH_SR_ERRORS);
+  WRITE_REG(FLASH->SR, errors | FLASH_SR_EOP);
+
+  return errors == 0;
+}
+
+/**
+ * flush_caches
+ * \brief discards the ART cache lines that may hold the old contents
+ */
+static void flush_caches(void)
+{
+  CLEAR_BIT(FLASH->ACR, FLASH_ACR_DCEN | FLASH_ACR_ICEN);
+  SET_BIT(FLASH->ACR, FLASH_ACR_DCRST | FLASH_ACR_ICRST);
+  CLEAR_BIT(FLASH->ACR, FLASH_ACR_DCRST | FLASH_ACR_ICRST);
+  SET_BIT(FLASH->ACR, FLASH_ACR_DCEN | FLASH_ACR_ICEN);
+}
@@ -0,0 +1,327 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "i2c.h"
+#include "stm32f4xx_ll_i2c.h"
+
+/*
+  A register write is START, device address, register, value. Each step
+  is one event interrupt (SB, ADDR, BTF, BTF) so the CPU is busy for a
+  few hundred nanoseconds per byte and free while the bytes shift out.
+  Writes that follow each other are joined by a repeated start, the STOP
+  goes out with the last one in the queue.
+
+  The BTF of the value stays set until the STOP or repeated START is on
+  the bus. The event interrupt is off from the end of a write until the
+  next START has gone out, and it only acts on the flag its step waits
+  for, so a write is never completed twice.
+
+  DMA would save two of the four interrupts per write but needs a stream
+  of its own and the F4's DMA/I2C end of transfer handling, for two bytes
+  it is not worth it.
+
+  A write that is not acknowledged, or loses arbitration, is abandoned
+  and the queue moves on. Its group completes with ok false.
+*/
+
+static_assert((I2C_QUEUE_SIZE & (I2C_QUEUE_SIZE - 1)) == 0, "I2C_QUEUE_SIZE must be a power of 2");
+
+#define I2C_QUEUE_MASK (I2C_QUEUE_SIZE - 1)
+
+/* Below audio and MIDI, codec control is never urgent */
+#define I2C_IRQ_PRIORITY (13)
+
+/* A START or STOP takes at most a bit time to go out, far less than this */
+#define I2C_CONDITION_TIMEOUT (FREQ / 10000)
+
+/* Where the write on the bus is, each step waits for one event flag */
+typedef enum
+{
+  STEP_START,    /* START requested, waiting for SB */
+  STEP_ADDRESS,  /* Device address sent, waiting for ADDR */
+  STEP_REGISTER, /* Register sent, waiting for BTF */
+  STEP_VALUE,    /* Value sent, waiting for BTF */
+} i2c_step_t;
+
+/* Queued write, done is only called for the last of a group */
+typedef struct
+{
+  uint8_t device;
+  uint8_t reg;
+  uint8_t value;
+  bool last;
+  i2c_done_t done;
+  void *context;
+} i2c_write_t;
+
+/* Written by i2c_write_regs(), read by the interrupt */
+static i2c_write_t queue[I2C_QUEUE_SIZE];
+static volatile size_t head;
+static volatile size_t tail;
+
+/* Owned by the interrupt while a write is on the bus */
+static volatile bool active;
+static i2c_step_t step;
+static bool failed;
+
+/* Private functions */
+static void start(void);
+static void restart(void);
+static void complete(bool ok);
+
+/**
+ * i2c_init
+ * \brief initialises the I2C master and its interrupts, the bus is idle.
+ * \param speed the SCL clock in Hz, up to 400kHz, the slowest device on the bus sets it
+ * \return true if success, false otherwise
+ */
+bool i2c_init(uint32_t speed)
+{
+  LL_APB1_GRP1_EnableClock(I2C_CLOCK);
+
+  LL_GPIO_InitTypeDef io = {
+      .Mode = LL_GPIO_MODE_ALTERNATE,
+      .Speed = LL_GPIO_SPEED_FREQ_HIGH,
+      .OutputType = LL_GPIO_OUTPUT_OPENDRAIN,
+      .Pull = LL_GPIO_PULL_UP,
+  };
+
+  io.Pin = I2C_SCL_PIN;
+  io.Alternate = I2C_SCL_AF;
+  if (LL_GPIO_Init(I2C_SCL_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  io.Pin = I2C_SDA_PIN;
+  io.Alternate = I2C_SDA_AF;
+  if (LL_GPIO_Init(I2C_SDA_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_I2C_EnableReset(I2C_BUS);
+  LL_I2C_DisableReset(I2C_BUS);
+
+  /* Fast mode needs the 16/9 duty cycle for its 1.3us minimum low time */
+  if (LL_I2C_Init(I2C_BUS, &(LL_I2C_InitTypeDef){
+          .PeripheralMode = LL_I2C_MODE_I2C,
+          .ClockSpeed = speed,
+          .DutyCycle = LL_I2C_DUTYCYCLE_16_9,
+          .OwnAddress1 = 0,
+          .TypeAcknowledge = LL_I2C_ACK,
+          .OwnAddrSize = LL_I2C_OWNADDRESS1_7BIT}) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* The event interrupt is enabled by each write */
+  LL_I2C_EnableIT_ERR(I2C_BUS);
+  NVIC_SetPriority(I2C_EV_IRQN, I2C_IRQ_PRIORITY);
+  NVIC_SetPriority(I2C_ER_IRQN, I2C_IRQ_PRIORITY);
+  NVIC_EnableIRQ(I2C_EV_IRQN);
+  NVIC_EnableIRQ(I2C_ER_IRQN);
+
+  LL_I2C_Enable(I2C_BUS);
+
+  return true;
+}
+
+/**
+ * i2c_write_regs
+ * \brief queues a group of register writes to a device, they are sent in order.
+ * \param device the 8 bit write address of the device
+ * \param regs the writes, copied into the queue
+ * \param n the number of writes
+ * \param done called from the interrupt when the group completes, may be NULL
+ * \param context passed to done
+ * \return false if the queue has no room for the whole group, nothing is queued
+ * \note safe to call from tasks and interrupts, it never waits on the bus.
+ */
+bool i2c_write_regs(uint8_t device, const i2c_reg_t *regs, size_t n, i2c_done_t done, void *context)
+{
+  if (n == 0)
+  {
+    return false;
+  }
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (I2C_QUEUE_SIZE - (head - tail) < n)
+  {
+    __set_PRIMASK(primask);
+    return false;
+  }
+
+  for (size_t i = 0; i < n; i++)
+  {
+    bool last = i == n - 1;
+
+    queue[(head + i) & I2C_QUEUE_MASK] = (i2c_write_t){
+        .device = device,
+        .reg = regs[i].reg,
+        .value = regs[i].value,
+        .last = last,
+        .done = last ? done : NULL,
+        .context = context,
+    };
+  }
+  head += n;
+
+  if (!active)
+  {
+    active = true;
+    start();
+  }
+
+  __set_PRIMASK(primask);
+  return true;
+}
+
+/**
+ * start
+ * \brief starts the write at the tail of the queue from an idle bus.
+ */
+static void start(void)
+{
+  /* A START requested while the last STOP is still going out would be taken as a repeated start */
+  for (uint32_t timeout = I2C_CONDITION_TIMEOUT; (I2C_BUS->CR1 & I2C_CR1_STOP) && timeout != 0; timeout--)
+    ;
+
+  step = STEP_START;
+  LL_I2C_GenerateStartCondition(I2C_BUS);
+  LL_I2C_EnableIT_EVT(I2C_BUS);
+}
+
+/**
+ * restart
+ * \brief starts the write at the tail of the queue with a repeated start.
+ * \note the last write's BTF is cleared by the START going out, the interrupt is enabled once it has.
+ */
+static void restart(void)
+{
+  step = STEP_START;
+  LL_I2C_GenerateStartCondition(I2C_BUS);
+
+  for (uint32_t timeout = I2C_CONDITION_TIMEOUT; (I2C_BUS->CR1 & I2C_CR1_START) && timeout != 0; timeout--)
+    ;
+
+  LL_I2C_EnableIT_EVT(I2C_BUS);
+}
+
+/**
+ * complete
+ * \brief retires the write at the tail of the queue and starts the next one.
+ * \param ok false if the write failed, the error handler has released the bus
+ */
+static void complete(bool ok)
+{
+  const i2c_write_t *write = &queue[tail & I2C_QUEUE_MASK];
+  bool last = write->last;
+  i2c_done_t done = write->done;
+  void *context = write->context;
+  bool group_ok = ok && !failed;
+
+  failed = last ? false : !group_ok;
+  tail++;
+
+  /* Off until the next START is on the bus, the flags of this write stay set until then */
+  LL_I2C_DisableIT_EVT(I2C_BUS);
+
+  if (tail == head)
+  {
+    if (ok)
+    {
+      LL_I2C_GenerateStopCondition(I2C_BUS);
+    }
+    active = false;
+  }
+  else if (ok)
+  {
+    restart();
+  }
+  else
+  {
+    start();
+  }
+
+  if (last && done != NULL)
+  {
+    done(context, group_ok);
+  }
+}
+
+/**
+ * \brief I2C Event Interrupt Handler
+ * \note Steps the write at the tail of the queue through address, register and value.
+ */
+void I2C_EV_IRQ_HANDLER(void)
+{
+  const i2c_write_t *write = &queue[tail & I2C_QUEUE_MASK];
+
+  switch (step)
+  {
+  case STEP_START:
+    if (LL_I2C_IsActiveFlag_SB(I2C_BUS))
+    {
+      LL_I2C_TransmitData8(I2C_BUS, write->device);
+      step = STEP_ADDRESS;
+    }
+    break;
+  case STEP_ADDRESS:
+    if (LL_I2C_IsActiveFlag_ADDR(I2C_BUS))
+    {
+      LL_I2C_ClearFlag_ADDR(I2C_BUS);
+      LL_I2C_TransmitData8(I2C_BUS, write->reg);
+      step = STEP_REGISTER;
+    }
+    break;
+  case STEP_REGISTER:
+    if (LL_I2C_IsActiveFlag_BTF(I2C_BUS))
+    {
+      LL_I2C_TransmitData8(I2C_BUS, write->value);
+      step = STEP_VALUE;
+    }
+    break;
+  case STEP_VALUE:
+    if (LL_I2C_IsActiveFlag_BTF(I2C_BUS))
+    {
+      complete(true);
+    }
+    break;
+  }
+}
+
+/**
+ * \brief I2C Error Interrupt Handler
+ * \note Abandons the write on the bus, a lost arbitration has already released it.
+ */
+void I2C_ER_IRQ_HANDLER(void)
+{
+  if (LL_I2C_IsActiveFlag_AF(I2C_BUS))
+  {
+    LL_I2C_ClearFlag_AF(I2C_BUS);
+    LL_I2C_GenerateStopCondition(I2C_BUS);
+  }
+
+  LL_I2C_ClearFlag_BERR(I2C_BUS);
+  LL_I2C_ClearFlag_ARLO(I2C_BUS);
+  LL_I2C_ClearFlag_OVR(I2C_BUS);
+
+  if (active)
+  {
+    complete(false);
+  }
+}
@@ -0,0 +1,43 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __I2C_H__
+#define __I2C_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Interrupt driven I2C master for codec control, register writes only.
+
+  Writes are queued and sent in order by the event interrupt, the caller
+  never waits on the bus. A group of writes is queued whole or not at all
+  and its callback runs once the last of them is on the wire.
+*/
+
+/* Queued register writes, must be a power of 2 */
+#ifndef I2C_QUEUE_SIZE
+#define I2C_QUEUE_SIZE (32)
+#endif
+
+/* One register write */
+typedef struct
+{
+  uint8_t reg;
+  uint8_t value;
+} i2c_reg_t;
+
+/* Called from the I2C interrupt when a group completes, ok is false if any write in it was not acknowledged */
+typedef void (*i2c_done_t)(void *context, bool ok);
+
+/* API */
+bool i2c_init(uint32_t speed);
+bool i2c_write_regs(uint8_t device, const i2c_reg_t *regs, size_t n, i2c_done_t done, void *context);
+
+#endif /* __I2C_H__ */
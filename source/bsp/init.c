@@ -9,9 +9,23 @@
 #include "trace.h"
 #include "stm32f4xx_ll_spi.h"
 #include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_usart.h"
 
 /* This will include the header for specific board we're using */
 #include "board.h"
+#include "codec.h"
+#include "sections.h"
+#include "stats.h"
+#include "sysview.h"
+
+/* Flash and CRC driver, flash.c */
+void flash_init(void);
+
+/* Button and LED, panel.c */
+bool panel_init(void);
+
+/* OLED display, oled.c */
+bool oled_init(void);
 
 /**
  * clock_init
@@ -118,6 +132,16 @@ static bool i2s_init()
   }
 #endif
 
+#ifdef I2S_EXT
+  /* Serial Data In (SDI) on the full duplex extension, pulled down so an unconnected input is silent */
+  io.Pin = I2S_SDI_PIN;
+  io.Alternate = I2S_SDI_AF;
+  if (LL_GPIO_Init(I2S_SDI_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+#endif
+
 /* 
   Partially configure the I2S peripheral, the remaining configuration is done by
   the audio_start call.
@@ -168,6 +192,125 @@ if (LL_I2S_Init(I2S, &(LL_I2S_InitTypeDef){
   /* Connnect DMA to I2S peripheral */
   LL_SPI_EnableDMAReq_TX(I2S);
 
+#ifdef I2S_EXT
+  /* The input stream moves in lock step with the output, it needs no interrupts of its own */
+  if (LL_DMA_Init(DMA, I2S_RX_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .Channel = I2S_RX_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_HALFWORD,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_HALFWORD,
+          .Mode = LL_DMA_MODE_CIRCULAR,
+          .Priority = LL_DMA_PRIORITY_HIGH,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_SPI_EnableDMAReq_RX(I2S_EXT);
+#endif
+
+  return true;
+}
+
+/* MIDI receive ring, written by the DMA and drained on idle line/half/full events */
+#define MIDI_RX_BUFFER_SIZE (64)
+static DMA_BUFFER uint8_t midi_rx_buffer[MIDI_RX_BUFFER_SIZE];
+static size_t midi_rx_pos;
+
+/**
+ * \brief Initialise MIDI, USART receive via DMA into a circular buffer and transmit via DMA
+ * \note Bytes are collected by the DMA and handed on in bursts when the line goes
+ *       idle (or the buffer is half/fully used) rather than one interrupt per byte.
+ *       The transmit stream is set up here and started by midi_transmit().
+ * \return true if success, false otherwise
+ */
+static bool midi_init()
+{
+  if (LL_GPIO_Init(MIDI_RX_PORT, &(LL_GPIO_InitTypeDef){
+          .Pin = MIDI_RX_PIN,
+          .Mode = LL_GPIO_MODE_ALTERNATE,
+          .Speed = LL_GPIO_SPEED_FREQ_LOW,
+          .Pull = LL_GPIO_PULL_UP,
+          .Alternate = MIDI_AF}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_GPIO_Init(MIDI_TX_PORT, &(LL_GPIO_InitTypeDef){
+          .Pin = MIDI_TX_PIN,
+          .Mode = LL_GPIO_MODE_ALTERNATE,
+          .Speed = LL_GPIO_SPEED_FREQ_LOW,
+          .OutputType = LL_GPIO_OUTPUT_PUSHPULL,
+          .Pull = LL_GPIO_PULL_NO,
+          .Alternate = MIDI_AF}) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* MIDI is 31250 baud, 8N1 */
+  if (LL_USART_Init(MIDI_UART, &(LL_USART_InitTypeDef){
+          .BaudRate = 31250,
+          .DataWidth = LL_USART_DATAWIDTH_8B,
+          .StopBits = LL_USART_STOPBITS_1,
+          .Parity = LL_USART_PARITY_NONE,
+          .TransferDirection = LL_USART_DIRECTION_TX_RX,
+          .HardwareFlowControl = LL_USART_HWCONTROL_NONE,
+          .OverSampling = LL_USART_OVERSAMPLING_16}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_DMA_Init(MIDI_DMA, MIDI_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .PeriphOrM2MSrcAddress = LL_USART_DMA_GetRegAddr(MIDI_UART),
+          .MemoryOrM2MDstAddress = (uint32_t)midi_rx_buffer,
+          .NbData = MIDI_RX_BUFFER_SIZE,
+          .Channel = MIDI_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_BYTE,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_BYTE,
+          .Mode = LL_DMA_MODE_CIRCULAR,
+          .Priority = LL_DMA_PRIORITY_LOW,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* Transmit is one shot, the stream disables itself when the transfer completes */
+  if (LL_DMA_Init(MIDI_DMA, MIDI_TX_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .PeriphOrM2MSrcAddress = LL_USART_DMA_GetRegAddr(MIDI_UART),
+          .Channel = MIDI_TX_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_MEMORY_TO_PERIPH,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_BYTE,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_BYTE,
+          .Mode = LL_DMA_MODE_NORMAL,
+          .Priority = LL_DMA_PRIORITY_LOW,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* Half and full interrupts catch bursts longer than the idle detection */
+  LL_DMA_EnableIT_HT(MIDI_DMA, MIDI_DMA_STREAM);
+  LL_DMA_EnableIT_TC(MIDI_DMA, MIDI_DMA_STREAM);
+  NVIC_SetPriority(MIDI_DMA_IRQN, 11);
+  NVIC_EnableIRQ(MIDI_DMA_IRQN);
+
+  /* Idle line interrupt marks the end of a burst */
+  LL_USART_EnableIT_IDLE(MIDI_UART);
+  NVIC_SetPriority(MIDI_UART_IRQN, 11);
+  NVIC_EnableIRQ(MIDI_UART_IRQN);
+
+  LL_USART_EnableDMAReq_RX(MIDI_UART);
+  LL_USART_EnableDMAReq_TX(MIDI_UART);
+  LL_DMA_EnableStream(MIDI_DMA, MIDI_DMA_STREAM);
+  LL_USART_Enable(MIDI_UART);
+
   return true;
 }
 
@@ -200,6 +343,11 @@ bool init(void)
   /* Remaining shared initialisation goes here */
   i2s_init();
   dma_init();
+  midi_init();
+  flash_init();
+  panel_init();
+  oled_init();
+  codec_init();
 
   return true;
 }
@@ -207,64 +355,125 @@ bool init(void)
 
 /* I2S PLL dividers are the same for all boards providing the oscillator is divided down
    to 1MHz or 2MHz, these come from Table 90 in the STM32F411xE reference manual. They
-   differ depending on whether we're also using a MCLK.
+   differ depending on whether we're also using a MCLK, which the codec decides. Without
+   MCLK a 16 bit frame just doubles the I2S divider, every entry is still exact.
 */
-#ifdef DAE_USES_MCLK
-
-#define I2S_44_N (271)
-#define I2S_44_R (LL_RCC_PLLI2SR_DIV_2)
-
-#define I2S_48_N (258)
-#define I2S_48_R (LL_RCC_PLLI2SR_DIV_3)
-
-#define I2S_96_N (344)
-#define I2S_96_R (LL_RCC_PLLI2SR_DIV_2)
+static const struct
+{
+  uint32_t rate;
+  uint32_t n;
+  uint32_t r;
+  uint32_t mclk_n;
+  uint32_t mclk_r;
+} i2s_plls[] = {
+    {48000, 384, LL_RCC_PLLI2SR_DIV_5, 258, LL_RCC_PLLI2SR_DIV_3},
+    {44100, 429, LL_RCC_PLLI2SR_DIV_4, 271, LL_RCC_PLLI2SR_DIV_2},
+    {96000, 424, LL_RCC_PLLI2SR_DIV_3, 344, LL_RCC_PLLI2SR_DIV_2},
+};
+
+#define I2S_PLL_COUNT (sizeof(i2s_plls) / sizeof(i2s_plls[0]))
 
-#else
+/* Import the functions we need to communicate with the DAE */
+extern void dae_ready_for_audio(uint8_t buffer_idx);
+extern void dae_midi_received(uint8_t byte);
 
-#define I2S_44_N (429)
-#define I2S_44_R (LL_RCC_PLLI2SR_DIV_4)
+/* Length of the audio DMA buffer in 16-bit transfers, set by audio_start */
+static size_t audio_buffer_len;
 
-#define I2S_48_N (384)
-#define I2S_48_R (LL_RCC_PLLI2SR_DIV_5)
+/* 16-bit transfers in a stereo frame, two for 16 bit words and four for the longer ones */
+static size_t audio_frame_len;
 
-#define I2S_96_N (424)
-#define I2S_96_R (LL_RCC_PLLI2SR_DIV_3)
+/* Longest wait for the input to catch up with the output in CPU cycles (100us), a frame is ~2000 cycles at 48kHz */
+#define AUDIO_INPUT_TIMEOUT (FREQ / 10000)
 
+#ifdef I2S_EXT
+/* Input DMA count when the input stalled, 0 while it runs as a circular stream never reads 0 */
+static uint32_t input_stalled_at;
 #endif
 
-/* Import the functions we need to communicate with the DAE */
-extern void dae_ready_for_audio(uint8_t buffer_idx);
-extern void dae_midi_received(uint8_t byte);
-
 /**
  * audio_start
  * \brief starts the audio hardware
  * \note this is called by the DAE to start the hardware audio layer, it
- *       supplies the buffer and other parameters. It finalises the configuration
- *       of the audio subsystem and starts it running.
+ *       supplies the buffer and other parameters. It agrees a format with the
+ *       codec, finalises the configuration of the audio subsystem, starts it
+ *       running and powers the codec up.
  * \param audio_buffer the audio buffer
- * \param buf_len the number of bytes in the buffer
- * \param fsr sample rate
+ * \param input_buffer the input buffer, the same length, filled in lock step if the board has an input
+ * \param buf_len the number of 16-bit transfers in each buffer
+ * \param fsr the sample rate wanted, the codec and I2S PLL may not both support it
+ * \param bits the word length, 16, 24 (in a 32 bit slot) or 32
+ * \return the sample rate running, 0 if the codec could not agree one
  */
-void audio_start(int16_t audio_buffer[], size_t buf_len, uint32_t fsr)
+uint32_t audio_start(int16_t audio_buffer[], int16_t input_buffer[], size_t buf_len, uint32_t fsr, uint8_t bits)
 {
+    codec_format_t format = {.bits = bits};
+    uint32_t data_format;
+
+    switch (bits)
+    {
+    case 16:
+        data_format = LL_I2S_DATAFORMAT_16B;
+        break;
+    case 24:
+        data_format = LL_I2S_DATAFORMAT_24B;
+        break;
+    case 32:
+        data_format = LL_I2S_DATAFORMAT_32B;
+        break;
+    default:
+        return 0;
+    }
+
+    size_t pll = I2S_PLL_COUNT;
+
+    /* The rate wanted if both ends can clock it, otherwise the first rate both can */
+    for (int pass = 0; pass < 2 && pll == I2S_PLL_COUNT; pass++)
+    {
+        for (size_t i = 0; i < I2S_PLL_COUNT && pll == I2S_PLL_COUNT; i++)
+        {
+            if (pass == 0 && i2s_plls[i].rate != fsr)
+            {
+                continue;
+            }
+
+            format.rate = i2s_plls[i].rate;
+            if (codec_set_format(&format))
+            {
+                pll = i;
+            }
+        }
+    }
+
+    if (pll == I2S_PLL_COUNT)
+    {
+        return 0;
+    }
+
+    audio_buffer_len = buf_len;
+    audio_frame_len = bits == 16 ? 2 : 4;
+
     /* Set DMA transfer buffer */
     LL_DMA_SetDataLength(DMA, DMA_STREAM, buf_len);
     LL_DMA_ConfigAddresses(DMA, DMA_STREAM, (uint32_t)audio_buffer, LL_SPI_DMA_GetRegAddr(I2S), LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
 
-    /* Calculate the PLL speeds required for different sample rates */
-    if (fsr == 48000)
-    {
-        LL_RCC_PLLI2S_ConfigDomain_I2S(LL_RCC_PLLSOURCE_HSE, I2S_PLL_M, I2S_48_N, I2S_48_R);
-    }
-    else if (fsr == 96000)
+#ifdef I2S_EXT
+    /* audio_input() times its wait on the cycle counter, which is never reset so it is shared with stats and tracing */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    LL_DMA_SetDataLength(DMA, I2S_RX_DMA_STREAM, buf_len);
+    LL_DMA_ConfigAddresses(DMA, I2S_RX_DMA_STREAM, LL_SPI_DMA_GetRegAddr(I2S_EXT), (uint32_t)input_buffer, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+#endif
+
+    /* The PLL speeds for the rate, MCLK needs a faster I2S clock */
+    if (format.mclk)
     {
-        LL_RCC_PLLI2S_ConfigDomain_I2S(LL_RCC_PLLSOURCE_HSE, I2S_PLL_M, I2S_96_N, I2S_96_R);
+        LL_RCC_PLLI2S_ConfigDomain_I2S(LL_RCC_PLLSOURCE_HSE, I2S_PLL_M, i2s_plls[pll].mclk_n, i2s_plls[pll].mclk_r);
     }
     else
     {
-        LL_RCC_PLLI2S_ConfigDomain_I2S(LL_RCC_PLLSOURCE_HSE, I2S_PLL_M, I2S_44_N, I2S_44_R);
+        LL_RCC_PLLI2S_ConfigDomain_I2S(LL_RCC_PLLSOURCE_HSE, I2S_PLL_M, i2s_plls[pll].n, i2s_plls[pll].r);
     }
 
     /* Re-enable PLLI2S */
@@ -272,38 +481,128 @@ void audio_start(int16_t audio_buffer[], size_t buf_len, uint32_t fsr)
     while (!LL_RCC_PLLI2S_IsReady())
         ;
 
-    /* Update I2S peripheral with sample rate provided by audio generator */
+    /* Update I2S peripheral with the agreed sample rate */
     LL_I2S_InitTypeDef i2s =
         {
-            .AudioFreq = fsr,
+            .AudioFreq = format.rate,
             .ClockPolarity = LL_I2S_POLARITY_LOW,
-            .DataFormat = LL_I2S_DATAFORMAT_32B,
-            .MCLKOutput = LL_I2S_MCLK_OUTPUT_DISABLE,
+            .DataFormat = data_format,
+            .MCLKOutput = format.mclk ? LL_I2S_MCLK_OUTPUT_ENABLE : LL_I2S_MCLK_OUTPUT_DISABLE,
             .Mode = LL_I2S_MODE_MASTER_TX,
             .Standard = LL_I2S_STANDARD_PHILIPS};
-            
-#ifdef DAE_USES_MCLK            
-    /* If we're using the MCLK enable the output*/
-    i2s.MCLKOutput = LL_I2S_MCLK_OUTPUT_ENABLE;
-#endif
 
     if (LL_I2S_Init(I2S, &i2s) != SUCCESS)
     {
-        return;
+        return 0;
     }
 
-    /* Enable I2S */
-    LL_I2S_Enable(I2S);
-    while (!LL_I2S_IsEnabled(I2S))
+#ifdef I2S_EXT
+    /* The extension is the slave receiver on the master's clocks */
+    if (LL_I2S_InitFullDuplex(I2S_EXT, &i2s) != SUCCESS)
+    {
+        return 0;
+    }
+#endif
+
+    /*
+      Both streams are armed before the clocks start, the output stream preloads
+      the first transfer and the input stream takes the first one received, so
+      transfer n of one buffer is the same slot as transfer n of the other.
+    */
+#ifdef I2S_EXT
+    LL_DMA_EnableStream(DMA, I2S_RX_DMA_STREAM);
+    while (!LL_DMA_IsEnabledStream(DMA, I2S_RX_DMA_STREAM))
         ;
+#endif
 
     /* Enable DMA */
     LL_DMA_EnableStream(DMA, DMA_STREAM);
     while (!LL_DMA_IsEnabledStream(DMA, DMA_STREAM))
         ;
+
+    /* Enable I2S, the slave extension must be ready before the master starts the clocks */
+#ifdef I2S_EXT
+    LL_I2S_Enable(I2S_EXT);
+#endif
+    LL_I2S_Enable(I2S);
+    while (!LL_I2S_IsEnabled(I2S))
+        ;
+
+    /* The clocks are running, the codec can come up */
+    codec_set_power(true, NULL, NULL);
+
+    return format.rate;
 }
 
 
+/**
+ * audio_position
+ * \brief the number of frames the DMA has sent from the half-buffer now playing
+ * \note used by the DAE to timestamp events to better than block accuracy.
+ * \return frame offset, 0 to block size - 1
+ */
+uint32_t audio_position(void)
+{
+  if (audio_buffer_len == 0)
+  {
+    return 0;
+  }
+
+  /* The DMA counts down the transfers left */
+  uint32_t sent = audio_buffer_len - LL_DMA_GetDataLength(DMA, DMA_STREAM);
+
+  return (sent / audio_frame_len) % (audio_buffer_len / (audio_frame_len * 2));
+}
+
+/**
+ * audio_input
+ * \brief waits for the input captured while an output half-buffer played.
+ * \note called by the DAE for the half passed to dae_ready_for_audio(). The input
+ *       trails the output by the slot being shifted, less than a frame, so the wait
+ *       is over before the DAE task has woken.
+ * \param buffer_idx the half-buffer
+ * \return true once the same half of the input buffer is complete, false if the board has no
+ *         input or it has not arrived within AUDIO_INPUT_TIMEOUT, the caller substitutes silence
+ * \note once the input has stalled it is not waited for again until the DMA count moves,
+ *       a running stream has moved half the buffer by the next call.
+ */
+bool audio_input(uint8_t buffer_idx)
+{
+#ifdef I2S_EXT
+  size_t half = audio_buffer_len / 2;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t remaining = LL_DMA_GetDataLength(DMA, I2S_RX_DMA_STREAM);
+
+  if (input_stalled_at != 0)
+  {
+    if (remaining == input_stalled_at)
+    {
+      return false;
+    }
+    input_stalled_at = 0;
+  }
+
+  do
+  {
+    size_t received = audio_buffer_len - remaining;
+
+    /* The first half is complete once the stream is into the second, the second once it has wrapped */
+    if ((buffer_idx == 0) == (received >= half))
+    {
+      return true;
+    }
+
+    remaining = LL_DMA_GetDataLength(DMA, I2S_RX_DMA_STREAM);
+  } while (DWT->CYCCNT - start < AUDIO_INPUT_TIMEOUT);
+
+  /* The input has stalled, the half holds stale or partly written samples */
+  input_stalled_at = remaining;
+  return false;
+#else
+  return false;
+#endif
+}
+
 /**
  * \brief Audio DMA Interrupt Handler
  *
@@ -314,6 +613,9 @@ void audio_start(int16_t audio_buffer[], size_t buf_len, uint32_t fsr)
  */
 void DMA_IRQ_HANDLER(void)
 {
+  STATS_ISR_ENTER();
+  SYSVIEW_ISR_ENTER();
+
   if (DMA->HISR & DMA_HISR_TCIF)
   {
     DMA->HIFCR = DMA_HIFCR_CTCIF; 
@@ -324,8 +626,136 @@ void DMA_IRQ_HANDLER(void)
     DMA->HIFCR = DMA_HIFCR_CHTIF; 
     dae_ready_for_audio(0);              
   }
+
+  SYSVIEW_ISR_EXIT();
+  STATS_ISR_EXIT(&stats_audio_isr);
+}
+
+
+/**
+ * midi_rx_drain
+ * \brief passes every byte the DMA has written since the last call to the DAE
+ */
+static void midi_rx_drain(void)
+{
+  size_t pos = MIDI_RX_BUFFER_SIZE - LL_DMA_GetDataLength(MIDI_DMA, MIDI_DMA_STREAM);
+  if (pos == MIDI_RX_BUFFER_SIZE)
+  {
+    pos = 0;
+  }
+
+  while (midi_rx_pos != pos)
+  {
+    dae_midi_received(midi_rx_buffer[midi_rx_pos]);
+    midi_rx_pos = (midi_rx_pos + 1) % MIDI_RX_BUFFER_SIZE;
+  }
 }
 
+/**
+ * midi_transmit_busy
+ * \brief true while a midi_transmit() transfer is in progress
+ */
+bool midi_transmit_busy(void)
+{
+  return LL_DMA_IsEnabledStream(MIDI_DMA, MIDI_TX_DMA_STREAM);
+}
+
+/**
+ * midi_transmit
+ * \brief starts sending bytes on the MIDI output
+ * \param data the bytes, the buffer must stay valid until midi_transmit_busy() is false
+ * \param len the number of bytes
+ * \return false if a transmission is already in progress
+ */
+bool midi_transmit(const uint8_t *data, size_t len)
+{
+  if (midi_transmit_busy())
+  {
+    return false;
+  }
+
+  MIDI_TX_DMA_CLEAR_FLAGS();
+  LL_DMA_SetMemoryAddress(MIDI_DMA, MIDI_TX_DMA_STREAM, (uint32_t)data);
+  LL_DMA_SetDataLength(MIDI_DMA, MIDI_TX_DMA_STREAM, len);
+  LL_DMA_EnableStream(MIDI_DMA, MIDI_TX_DMA_STREAM);
+
+  return true;
+}
+
+/**
+ * midi_receive
+ * \brief stops or restarts MIDI input, around a flash erase that stalls the interrupts.
+ * \param enable false to stop, the UART then ignores the line. true to restart
+ *        from an empty ring.
+ * \note the receive interrupts are off while stopped, the caller may reset the parser.
+ */
+void midi_receive(bool enable)
+{
+  if (!enable)
+  {
+    NVIC_DisableIRQ(MIDI_UART_IRQN);
+    NVIC_DisableIRQ(MIDI_DMA_IRQN);
+    LL_USART_DisableDirectionRx(MIDI_UART);
+    return;
+  }
+
+  /* Bytes left in the ring were received before the stop, the parser has been reset since */
+  size_t pos = MIDI_RX_BUFFER_SIZE - LL_DMA_GetDataLength(MIDI_DMA, MIDI_DMA_STREAM);
+  midi_rx_pos = pos == MIDI_RX_BUFFER_SIZE ? 0 : pos;
+
+  MIDI_DMA_CLEAR_FLAGS();
+  LL_USART_ClearFlag_ORE(MIDI_UART);
+  LL_USART_ClearFlag_IDLE(MIDI_UART);
+  NVIC_ClearPendingIRQ(MIDI_UART_IRQN);
+  NVIC_ClearPendingIRQ(MIDI_DMA_IRQN);
+
+  LL_USART_EnableDirectionRx(MIDI_UART);
+  NVIC_EnableIRQ(MIDI_UART_IRQN);
+  NVIC_EnableIRQ(MIDI_DMA_IRQN);
+}
+
+/**
+ * \brief MIDI USART Interrupt Handler
+ * \note Fires when the receive line goes idle at the end of a burst of bytes.
+ */
+void MIDI_UART_IRQ_HANDLER(void)
+{
+  STATS_ISR_ENTER();
+  SYSVIEW_ISR_ENTER();
+
+  if (LL_USART_IsActiveFlag_ORE(MIDI_UART))
+  {
+    LL_USART_ClearFlag_ORE(MIDI_UART);
+  }
+
+  if (LL_USART_IsActiveFlag_IDLE(MIDI_UART))
+  {
+    LL_USART_ClearFlag_IDLE(MIDI_UART);
+    midi_rx_drain();
+  }
+
+  SYSVIEW_ISR_EXIT();
+
+  /* Shares the DMA handler's times, they run at the same priority and never nest */
+  STATS_ISR_EXIT(&stats_midi_isr);
+}
+
+/**
+ * \brief MIDI DMA Interrupt Handler
+ * \note Fires at half and full buffer so a long burst (e.g. SysEx) cannot overrun
+ *       the ring before the line goes idle.
+ */
+void MIDI_DMA_IRQ_HANDLER(void)
+{
+  STATS_ISR_ENTER();
+  SYSVIEW_ISR_ENTER();
+
+  MIDI_DMA_CLEAR_FLAGS();
+  midi_rx_drain();
+
+  SYSVIEW_ISR_EXIT();
+  STATS_ISR_EXIT(&stats_midi_isr);
+}
 
 /**
  * \brief Hard fault exception handler
@@ -0,0 +1,13 @@
+/*
+   Stand-in for the SEGGER.h of the SystemView distribution, which is not
+   vendored here. SEGGER_SYSVIEW.h only needs va_list and the basic types
+   from Global.h.
+*/
+#ifndef SEGGER_H
+#define SEGGER_H
+
+#include <stdarg.h>
+
+#include "Global.h"
+
+#endif /* SEGGER_H */
@@ -79,6 +79,26 @@ Additional information:
 **********************************************************************
 */
 
+//
+// Channel 0 is the RTT terminal, tools/sysview_dump.py finds the trace on 1
+//
+#define SEGGER_SYSVIEW_RTT_CHANNEL              1
+
+//
+// A live trace only has to cover the probe's polling interval, the
+// post-mortem ring holds the last hundred or so audio blocks
+//
+#ifndef   SEGGER_SYSVIEW_RTT_BUFFER_SIZE
+  #if (defined SEGGER_SYSVIEW_POST_MORTEM_MODE) && (SEGGER_SYSVIEW_POST_MORTEM_MODE == 1)
+    #define SEGGER_SYSVIEW_RTT_BUFFER_SIZE      (8 * 1024)
+  #else
+    #define SEGGER_SYSVIEW_RTT_BUFFER_SIZE      (4 * 1024)
+  #endif
+#endif
+
+#define SEGGER_SYSVIEW_APP_NAME                 "DAE"
+#define SEGGER_SYSVIEW_DEVICE_NAME              "STM32F411"
+
 
 #endif  // SEGGER_SYSVIEW_CONF_H
 
@@ -0,0 +1,288 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_spi.h"
+
+/*
+  SSD1306 or SH1106 128x64 OLED on a transmit only SPI bus with DMA, the
+  controller is chosen at build time (-DOLED=, OLED_SH1106 for the SH1106).
+
+  The controller is used in page addressing mode, which both chips have.
+  A flush sends only the dirty pages: for each one a three byte address
+  command is written by the CPU, then the 128 bytes of the page go by DMA.
+  The DMA complete interrupt moves on to the next dirty page, when there
+  are none left the UI is told the framebuffer is free again. A full
+  screen takes ~1.4ms at 6.25MHz with the CPU busy for ~5us of each page.
+
+  The framebuffer belongs to the UI, it must not be drawn into until the
+  flush completes.
+*/
+
+/* Controller geometry */
+#define OLED_PAGES (8)
+#define OLED_WIDTH (128)
+
+/* The SH1106 has 132 columns, the panel is centred on them */
+#ifndef OLED_COLUMN_OFFSET
+#if defined(OLED_SH1106)
+#define OLED_COLUMN_OFFSET (2)
+#else
+#define OLED_COLUMN_OFFSET (0)
+#endif
+#endif
+
+/* Low priority, the display must never delay audio or MIDI */
+#define OLED_IRQ_PRIORITY (14)
+
+/* Commands */
+#define OLED_SET_PAGE (0xB0)
+#define OLED_SET_COLUMN_LOW (0x00)
+#define OLED_SET_COLUMN_HIGH (0x10)
+
+/* Power on sequence, 128x64 on the controller's own supply */
+static const uint8_t init_sequence[] = {
+    0xAE,       /* Display off */
+    0xD5, 0x80, /* Clock divide */
+    0xA8, 0x3F, /* Multiplex 64 */
+    0xD3, 0x00, /* No display offset */
+    0x40,       /* Start line 0 */
+#if defined(OLED_SH1106)
+    0xAD, 0x8B, /* DC-DC converter on, page addressing is the only mode */
+    0x32,       /* Pump 8.0V */
+#else
+    0x8D, 0x14, /* Charge pump on */
+    0x20, 0x02, /* Page addressing */
+#endif
+    0xA1,       /* Column 127 is segment 0 */
+    0xC8,       /* Scan from COM63 */
+    0xDA, 0x12, /* Alternative COM pins */
+    0x81, 0xCF, /* Contrast */
+    0xD9, 0xF1, /* Precharge */
+    0xDB, 0x40, /* VCOMH level */
+    0xA4,       /* Display follows RAM */
+    0xA6,       /* Not inverted */
+    0xAF,       /* Display on */
+};
+
+/* Import the function we need to communicate with the UI */
+extern void ui_display_flushed(void);
+
+/* Flush in progress, owned by the DMA interrupt until it completes */
+static const uint8_t *flush_pages;
+static uint8_t flush_dirty;
+static volatile bool flush_busy;
+
+/* Private functions */
+static void command(const uint8_t *bytes, size_t n);
+static bool next_page(void);
+
+/**
+ * oled_init
+ * \brief initialises the SPI bus and DMA, resets the display and switches it on blank.
+ * \note the controller RAM is random at power on, the first flush should send every page.
+ * \return true if success, false otherwise
+ */
+bool oled_init(void)
+{
+  LL_GPIO_InitTypeDef io = {
+      .Mode = LL_GPIO_MODE_ALTERNATE,
+      .Speed = LL_GPIO_SPEED_FREQ_MEDIUM,
+      .OutputType = LL_GPIO_OUTPUT_PUSHPULL,
+      .Pull = LL_GPIO_PULL_NO,
+      .Alternate = OLED_AF,
+  };
+
+  io.Pin = OLED_SCK_PIN;
+  if (LL_GPIO_Init(OLED_SCK_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  io.Pin = OLED_MOSI_PIN;
+  if (LL_GPIO_Init(OLED_MOSI_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* Data/command, chip select and reset are plain outputs */
+  io.Mode = LL_GPIO_MODE_OUTPUT;
+  io.Speed = LL_GPIO_SPEED_FREQ_LOW;
+
+  io.Pin = OLED_DC_PIN;
+  if (LL_GPIO_Init(OLED_DC_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_GPIO_SetOutputPin(OLED_CS_PORT, OLED_CS_PIN);
+  io.Pin = OLED_CS_PIN;
+  if (LL_GPIO_Init(OLED_CS_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  io.Pin = OLED_RES_PIN;
+  if (LL_GPIO_Init(OLED_RES_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_SPI_Init(OLED_SPI, &(LL_SPI_InitTypeDef){
+          .TransferDirection = LL_SPI_HALF_DUPLEX_TX,
+          .Mode = LL_SPI_MODE_MASTER,
+          .DataWidth = LL_SPI_DATAWIDTH_8BIT,
+          .ClockPolarity = LL_SPI_POLARITY_LOW,
+          .ClockPhase = LL_SPI_PHASE_1EDGE,
+          .NSS = LL_SPI_NSS_SOFT,
+          .BaudRate = OLED_SPI_PRESCALER,
+          .BitOrder = LL_SPI_MSB_FIRST,
+          .CRCCalculation = LL_SPI_CRCCALCULATION_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_DMA_Init(OLED_DMA, OLED_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .PeriphOrM2MSrcAddress = LL_SPI_DMA_GetRegAddr(OLED_SPI),
+          .Channel = OLED_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_MEMORY_TO_PERIPH,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_BYTE,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_BYTE,
+          .Mode = LL_DMA_MODE_NORMAL,
+          .Priority = LL_DMA_PRIORITY_LOW,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_DMA_EnableIT_TC(OLED_DMA, OLED_DMA_STREAM);
+  NVIC_SetPriority(OLED_DMA_IRQN, OLED_IRQ_PRIORITY);
+  NVIC_EnableIRQ(OLED_DMA_IRQN);
+
+  LL_SPI_EnableDMAReq_TX(OLED_SPI);
+  LL_SPI_Enable(OLED_SPI);
+
+  /* Reset pulse, at least 3us low then time for the controller to come out of reset */
+  LL_GPIO_ResetOutputPin(OLED_RES_PORT, OLED_RES_PIN);
+  for (volatile uint32_t i = 0; i < FREQ / 1000000 * 10; i++)
+    ;
+  LL_GPIO_SetOutputPin(OLED_RES_PORT, OLED_RES_PIN);
+  for (volatile uint32_t i = 0; i < FREQ / 1000000 * 10; i++)
+    ;
+
+  LL_GPIO_ResetOutputPin(OLED_CS_PORT, OLED_CS_PIN);
+  command(init_sequence, sizeof(init_sequence));
+  LL_GPIO_SetOutputPin(OLED_CS_PORT, OLED_CS_PIN);
+
+  return true;
+}
+
+/**
+ * oled_flush
+ * \brief starts sending the dirty pages of a framebuffer to the display.
+ * \details ui_display_flushed() is called from the DMA interrupt when it completes.
+ * \param framebuffer 8 pages of 128 bytes in the controller's layout, untouched until the flush completes
+ * \param dirty a bit per page to send
+ * \return false if a flush is in progress or there is nothing to send
+ */
+bool oled_flush(const uint8_t *framebuffer, uint8_t dirty)
+{
+  if (flush_busy || dirty == 0)
+  {
+    return false;
+  }
+
+  flush_busy = true;
+  flush_pages = framebuffer;
+  flush_dirty = dirty;
+
+  LL_GPIO_ResetOutputPin(OLED_CS_PORT, OLED_CS_PIN);
+  next_page();
+
+  return true;
+}
+
+/**
+ * command
+ * \brief sends command bytes by polling, short sequences only.
+ */
+static void command(const uint8_t *bytes, size_t n)
+{
+  LL_GPIO_ResetOutputPin(OLED_DC_PORT, OLED_DC_PIN);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    while (!LL_SPI_IsActiveFlag_TXE(OLED_SPI))
+      ;
+    LL_SPI_TransmitData8(OLED_SPI, bytes[i]);
+  }
+
+  /* DC is sampled with the last bit, hold it until the byte is out */
+  while (!LL_SPI_IsActiveFlag_TXE(OLED_SPI) || LL_SPI_IsActiveFlag_BSY(OLED_SPI))
+    ;
+}
+
+/**
+ * next_page
+ * \brief addresses the next dirty page and starts its DMA.
+ * \return false if there are no dirty pages left
+ */
+static bool next_page(void)
+{
+  if (flush_dirty == 0)
+  {
+    return false;
+  }
+
+  uint8_t page = (uint8_t)__builtin_ctz(flush_dirty);
+  flush_dirty &= (uint8_t)(flush_dirty - 1);
+
+  uint8_t address[] = {
+      OLED_SET_PAGE | page,
+      OLED_SET_COLUMN_LOW | (OLED_COLUMN_OFFSET & 0x0F),
+      OLED_SET_COLUMN_HIGH | (OLED_COLUMN_OFFSET >> 4),
+  };
+  command(address, sizeof(address));
+
+  LL_GPIO_SetOutputPin(OLED_DC_PORT, OLED_DC_PIN);
+  OLED_DMA_CLEAR_FLAGS();
+  LL_DMA_SetMemoryAddress(OLED_DMA, OLED_DMA_STREAM, (uint32_t)&flush_pages[page * OLED_WIDTH]);
+  LL_DMA_SetDataLength(OLED_DMA, OLED_DMA_STREAM, OLED_WIDTH);
+  LL_DMA_EnableStream(OLED_DMA, OLED_DMA_STREAM);
+
+  return true;
+}
+
+/**
+ * \brief OLED DMA Interrupt Handler
+ * \note A page has been handed to the SPI, send the next one or finish the flush.
+ */
+void OLED_DMA_IRQ_HANDLER(void)
+{
+  OLED_DMA_CLEAR_FLAGS();
+
+  /* The DMA finishes as the last bytes start shifting out, let them go before changing DC */
+  while (!LL_SPI_IsActiveFlag_TXE(OLED_SPI) || LL_SPI_IsActiveFlag_BSY(OLED_SPI))
+    ;
+
+  if (next_page())
+  {
+    return;
+  }
+
+  LL_GPIO_SetOutputPin(OLED_CS_PORT, OLED_CS_PIN);
+  flush_busy = false;
+  ui_display_flushed();
+}
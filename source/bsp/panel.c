@@ -0,0 +1,509 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "sections.h"
+#include "stm32f4xx_ll_adc.h"
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_exti.h"
+#include "stm32f4xx_ll_tim.h"
+
+/*
+  Front panel, the user button and LED, driven entirely by hardware.
+
+  The button interrupts on both edges. The first edge masks the line and
+  starts a one shot debounce timer, when that expires the pin is read once
+  and the UI told if it changed. Contact bounce costs one interrupt, not one
+  per bounce, and nothing polls.
+
+  The LED plays a pattern of levels, one per step, repeating. A timer's
+  update event requests a DMA transfer each step which copies the next
+  level from a table in RAM straight into the LED PWM compare register, so
+  a running pattern needs no CPU at all. Boards without a PWM pin on the
+  LED copy port set/reset words instead and the LED is simply on or off.
+
+  The pots are scanned by ADC1, a timer triggers a scan of every channel
+  and the DMA stores it in a circular buffer. Each half of the buffer holds
+  a batch of scans, when one fills the UI decimates it in the interrupt
+  while the DMA fills the other. The CPU starts no conversions and reads
+  no ADC registers.
+
+  The encoder is counted by a timer in encoder mode, every edge of both
+  outputs up or down by direction. The UI reads the count when it wants
+  it, there are no interrupts. Contact bounce on one output counts back
+  and forth and cancels, the input filter only has to reject glitches.
+*/
+
+/* Length of a pattern step and the longest pattern */
+#define PANEL_STEP_MS (20)
+#define PANEL_PATTERN_MAX (64)
+
+/* Button settling time */
+#define PANEL_DEBOUNCE_MS (20)
+
+/* Timers count at 10kHz for the step and debounce times */
+#define PANEL_TIMER_HZ (10000)
+
+/* LED PWM, 255 levels at ~1kHz */
+#define PANEL_PWM_LEVELS (255)
+#define PANEL_PWM_HZ (1000)
+
+/* Pattern stepping, TIM3 update requests DMA1 Stream 2 Channel 5 on every board */
+#define STEP_TIM (TIM3)
+#define STEP_DMA (DMA1)
+#define STEP_DMA_STREAM (LL_DMA_STREAM_2)
+#define STEP_DMA_CHANNEL (LL_DMA_CHANNEL_5)
+#define STEP_DMA_CLEAR_FLAGS() (DMA1->LIFCR = DMA_LIFCR_CHTIF2 | DMA_LIFCR_CTCIF2 | DMA_LIFCR_CTEIF2 | DMA_LIFCR_CDMEIF2 | DMA_LIFCR_CFEIF2)
+
+/* Debounce, one shot on TIM10 */
+#define DEBOUNCE_TIM (TIM10)
+#define DEBOUNCE_IRQN (TIM1_UP_TIM10_IRQn)
+#define DEBOUNCE_IRQ_HANDLER TIM1_UP_TIM10_IRQHandler
+
+/* Pot scanning, TIM2 TRGO starts each scan, ADC1 on DMA2 Stream 0 Channel 0 */
+#define SCAN_TIM (TIM2)
+#define SCAN_HZ (2000)
+#define SCAN_BATCH (16)                 /* Scans per half buffer, 8ms at 2kHz */
+#define SCAN_ADC (ADC1)
+#define SCAN_DMA (DMA2)
+#define SCAN_DMA_STREAM (LL_DMA_STREAM_0)
+#define SCAN_DMA_CHANNEL (LL_DMA_CHANNEL_0)
+#define SCAN_DMA_IRQN (DMA2_Stream0_IRQn)
+#define SCAN_DMA_IRQ_HANDLER DMA2_Stream0_IRQHandler
+
+/* Low priority, the panel must never delay audio or MIDI */
+#define PANEL_IRQ_PRIORITY (14)
+
+/* Import the functions we need to communicate with the UI */
+extern void ui_button_changed(bool pressed);
+extern void ui_controls_ready(const uint16_t *scans, size_t n);
+
+/* The pattern the DMA is playing, in the form written to the LED register */
+static DMA_BUFFER uint32_t pattern[PANEL_PATTERN_MAX];
+
+/* Debounced button state */
+static bool button_pressed;
+
+/* Pot readings, two halves of SCAN_BATCH scans */
+static DMA_BUFFER uint16_t scans[2 * SCAN_BATCH * CONTROL_COUNT];
+
+/* Private functions */
+static bool led_init(void);
+static bool button_init(void);
+static bool scan_init(void);
+static bool encoder_init(void);
+
+/**
+ * panel_init
+ * \brief initialises the button, LED and pot hardware, the LED starts off.
+ * \return true if success, false otherwise
+ */
+bool panel_init(void)
+{
+  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM2);
+  LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_TIM3);
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_TIM10);
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_SYSCFG);
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_ADC1);
+
+  return led_init() && button_init() && scan_init() && encoder_init();
+}
+
+/**
+ * encoder_count
+ * \brief the encoder position in counts, 4 per detent, wrapping at 16 bits.
+ */
+uint16_t encoder_count(void)
+{
+  return (uint16_t)LL_TIM_GetCounter(ENC_TIM);
+}
+
+/**
+ * led_pattern
+ * \brief plays a repeating pattern on the LED.
+ * \param levels brightness of each 20ms step, 0 off to 255 full
+ * \param steps the number of steps, longer patterns are truncated
+ */
+void led_pattern(const uint8_t *levels, size_t steps)
+{
+  if (steps == 0)
+  {
+    return;
+  }
+
+  if (steps > PANEL_PATTERN_MAX)
+  {
+    steps = PANEL_PATTERN_MAX;
+  }
+
+  LL_DMA_DisableStream(STEP_DMA, STEP_DMA_STREAM);
+  while (LL_DMA_IsEnabledStream(STEP_DMA, STEP_DMA_STREAM))
+    ;
+
+  for (size_t i = 0; i < steps; i++)
+  {
+#ifdef LED_PWM_TIM
+    /* Square law, perceived brightness is far from linear in duty */
+    pattern[i] = ((uint32_t)levels[i] * levels[i] + PANEL_PWM_LEVELS - 1) / PANEL_PWM_LEVELS;
+#else
+    pattern[i] = levels[i] >= 128 ? LED_BSRR_ON : LED_BSRR_OFF;
+#endif
+  }
+
+  STEP_DMA_CLEAR_FLAGS();
+  LL_DMA_SetMemoryAddress(STEP_DMA, STEP_DMA_STREAM, (uint32_t)pattern);
+  LL_DMA_SetDataLength(STEP_DMA, STEP_DMA_STREAM, steps);
+  LL_DMA_EnableStream(STEP_DMA, STEP_DMA_STREAM);
+}
+
+/**
+ * led_init
+ * \brief sets up the LED output and the stepping timer and DMA, nothing plays until led_pattern().
+ * \return true if success, false otherwise
+ */
+static bool led_init(void)
+{
+#ifdef LED_PWM_TIM
+  uint32_t destination = (uint32_t)&LED_PWM_TIM->CCR1;
+
+  /* PWM mode 1, the output is high while the count is below the compare value */
+  if (LL_GPIO_Init(LED_PWM_PORT, &(LL_GPIO_InitTypeDef){
+          .Pin = LED_PWM_PIN,
+          .Mode = LL_GPIO_MODE_ALTERNATE,
+          .Speed = LL_GPIO_SPEED_FREQ_LOW,
+          .OutputType = LL_GPIO_OUTPUT_PUSHPULL,
+          .Pull = LL_GPIO_PULL_NO,
+          .Alternate = LED_PWM_AF}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_TIM_Init(LED_PWM_TIM, &(LL_TIM_InitTypeDef){
+          .Prescaler = FREQ / (PANEL_PWM_HZ * PANEL_PWM_LEVELS) - 1,
+          .CounterMode = LL_TIM_COUNTERMODE_UP,
+          .Autoreload = PANEL_PWM_LEVELS - 1,
+          .ClockDivision = LL_TIM_CLOCKDIVISION_DIV1}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_TIM_OC_Init(LED_PWM_TIM, LL_TIM_CHANNEL_CH1, &(LL_TIM_OC_InitTypeDef){
+          .OCMode = LL_TIM_OCMODE_PWM1,
+          .OCState = LL_TIM_OCSTATE_ENABLE,
+          .CompareValue = 0,
+          .OCPolarity = LL_TIM_OCPOLARITY_HIGH}) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* A new level takes effect at the end of the PWM period, no glitches */
+  LL_TIM_OC_EnablePreload(LED_PWM_TIM, LL_TIM_CHANNEL_CH1);
+  LL_TIM_EnableCounter(LED_PWM_TIM);
+#else
+  uint32_t destination = (uint32_t)&LED_BSRR_PORT->BSRR;
+
+  LED_BSRR_PORT->BSRR = LED_BSRR_OFF;
+#endif
+
+  if (LL_DMA_Init(STEP_DMA, STEP_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .PeriphOrM2MSrcAddress = destination,
+          .MemoryOrM2MDstAddress = (uint32_t)pattern,
+          .NbData = 1,
+          .Channel = STEP_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_MEMORY_TO_PERIPH,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_WORD,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_WORD,
+          .Mode = LL_DMA_MODE_CIRCULAR,
+          .Priority = LL_DMA_PRIORITY_LOW,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_TIM_Init(STEP_TIM, &(LL_TIM_InitTypeDef){
+          .Prescaler = FREQ / PANEL_TIMER_HZ - 1,
+          .CounterMode = LL_TIM_COUNTERMODE_UP,
+          .Autoreload = PANEL_TIMER_HZ * PANEL_STEP_MS / 1000 - 1,
+          .ClockDivision = LL_TIM_CLOCKDIVISION_DIV1}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_TIM_EnableDMAReq_UPDATE(STEP_TIM);
+  LL_TIM_EnableCounter(STEP_TIM);
+
+  return true;
+}
+
+/**
+ * button_init
+ * \brief sets up the button interrupt and its debounce timer.
+ * \note the pin itself is configured by board_init.
+ * \return true if success, false otherwise
+ */
+static bool button_init(void)
+{
+  button_pressed = USR_BTN_PRESSED();
+
+  /* Only the counter reaching the end raises the interrupt, not LL_TIM_Init's update */
+  if (LL_TIM_Init(DEBOUNCE_TIM, &(LL_TIM_InitTypeDef){
+          .Prescaler = FREQ / PANEL_TIMER_HZ - 1,
+          .CounterMode = LL_TIM_COUNTERMODE_UP,
+          .Autoreload = PANEL_TIMER_HZ * PANEL_DEBOUNCE_MS / 1000 - 1,
+          .ClockDivision = LL_TIM_CLOCKDIVISION_DIV1}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_TIM_SetOnePulseMode(DEBOUNCE_TIM, LL_TIM_ONEPULSEMODE_SINGLE);
+  LL_TIM_SetUpdateSource(DEBOUNCE_TIM, LL_TIM_UPDATESOURCE_COUNTER);
+  LL_TIM_ClearFlag_UPDATE(DEBOUNCE_TIM);
+  LL_TIM_EnableIT_UPDATE(DEBOUNCE_TIM);
+  NVIC_SetPriority(DEBOUNCE_IRQN, PANEL_IRQ_PRIORITY);
+  NVIC_EnableIRQ(DEBOUNCE_IRQN);
+
+  LL_SYSCFG_SetEXTISource(BTN_EXTI_SOURCE_PORT, BTN_EXTI_SOURCE_LINE);
+  if (LL_EXTI_Init(&(LL_EXTI_InitTypeDef){
+          .Line_0_31 = BTN_EXTI_LINE,
+          .LineCommand = ENABLE,
+          .Mode = LL_EXTI_MODE_IT,
+          .Trigger = LL_EXTI_TRIGGER_RISING_FALLING}) != SUCCESS)
+  {
+    return false;
+  }
+
+  NVIC_SetPriority(BTN_EXTI_IRQN, PANEL_IRQ_PRIORITY);
+  NVIC_EnableIRQ(BTN_EXTI_IRQN);
+
+  return true;
+}
+
+/**
+ * scan_init
+ * \brief sets up the pot pins, the ADC scan sequence and its trigger and DMA, and starts scanning.
+ * \return true if success, false otherwise
+ */
+static bool scan_init(void)
+{
+  static const uint32_t channels[CONTROL_COUNT] = CONTROL_CHANNELS;
+  static const uint32_t ranks[] = {
+      LL_ADC_REG_RANK_1, LL_ADC_REG_RANK_2, LL_ADC_REG_RANK_3, LL_ADC_REG_RANK_4,
+      LL_ADC_REG_RANK_5, LL_ADC_REG_RANK_6, LL_ADC_REG_RANK_7, LL_ADC_REG_RANK_8,
+      LL_ADC_REG_RANK_9, LL_ADC_REG_RANK_10, LL_ADC_REG_RANK_11, LL_ADC_REG_RANK_12,
+      LL_ADC_REG_RANK_13, LL_ADC_REG_RANK_14, LL_ADC_REG_RANK_15, LL_ADC_REG_RANK_16};
+
+  LL_GPIO_InitTypeDef io = {.Mode = LL_GPIO_MODE_ANALOG, .Pull = LL_GPIO_PULL_NO};
+
+  io.Pin = CONTROL_PINS_A;
+  if (LL_GPIO_Init(GPIOA, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  io.Pin = CONTROL_PINS_B;
+  if (LL_GPIO_Init(GPIOB, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+#ifdef CONTROL_PINS_C
+  io.Pin = CONTROL_PINS_C;
+  if (LL_GPIO_Init(GPIOC, &io) != SUCCESS)
+  {
+    return false;
+  }
+#endif
+
+  /* 25MHz ADC clock, 144 cycle sampling suits 10K pots, a scan of 8 takes ~50us */
+  if (LL_ADC_CommonInit(__LL_ADC_COMMON_INSTANCE(SCAN_ADC), &(LL_ADC_CommonInitTypeDef){
+          .CommonClock = LL_ADC_CLOCK_SYNC_PCLK_DIV4}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_ADC_Init(SCAN_ADC, &(LL_ADC_InitTypeDef){
+          .Resolution = LL_ADC_RESOLUTION_12B,
+          .DataAlignment = LL_ADC_DATA_ALIGN_RIGHT,
+          .SequencersScanMode = LL_ADC_SEQ_SCAN_ENABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_ADC_REG_Init(SCAN_ADC, &(LL_ADC_REG_InitTypeDef){
+          .TriggerSource = LL_ADC_REG_TRIG_EXT_TIM2_TRGO,
+          .SequencerLength = CONTROL_SEQUENCE,
+          .SequencerDiscont = LL_ADC_REG_SEQ_DISCONT_DISABLE,
+          .ContinuousMode = LL_ADC_REG_CONV_SINGLE,
+          .DMATransfer = LL_ADC_REG_DMA_TRANSFER_UNLIMITED}) != SUCCESS)
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < CONTROL_COUNT; i++)
+  {
+    LL_ADC_REG_SetSequencerRanks(SCAN_ADC, ranks[i], channels[i]);
+    LL_ADC_SetChannelSamplingTime(SCAN_ADC, channels[i], LL_ADC_SAMPLINGTIME_144CYCLES);
+  }
+
+  if (LL_DMA_Init(SCAN_DMA, SCAN_DMA_STREAM, &(LL_DMA_InitTypeDef){
+          .PeriphOrM2MSrcAddress = LL_ADC_DMA_GetRegAddr(SCAN_ADC, LL_ADC_DMA_REG_REGULAR_DATA),
+          .MemoryOrM2MDstAddress = (uint32_t)scans,
+          .NbData = 2 * SCAN_BATCH * CONTROL_COUNT,
+          .Channel = SCAN_DMA_CHANNEL,
+          .Direction = LL_DMA_DIRECTION_PERIPH_TO_MEMORY,
+          .PeriphOrM2MSrcIncMode = LL_DMA_PERIPH_NOINCREMENT,
+          .MemoryOrM2MDstIncMode = LL_DMA_MEMORY_INCREMENT,
+          .PeriphOrM2MSrcDataSize = LL_DMA_PDATAALIGN_HALFWORD,
+          .MemoryOrM2MDstDataSize = LL_DMA_MDATAALIGN_HALFWORD,
+          .Mode = LL_DMA_MODE_CIRCULAR,
+          .Priority = LL_DMA_PRIORITY_LOW,
+          .FIFOMode = LL_DMA_FIFOMODE_DISABLE}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_DMA_EnableIT_HT(SCAN_DMA, SCAN_DMA_STREAM);
+  LL_DMA_EnableIT_TC(SCAN_DMA, SCAN_DMA_STREAM);
+  NVIC_SetPriority(SCAN_DMA_IRQN, PANEL_IRQ_PRIORITY);
+  NVIC_EnableIRQ(SCAN_DMA_IRQN);
+  LL_DMA_EnableStream(SCAN_DMA, SCAN_DMA_STREAM);
+
+  LL_ADC_Enable(SCAN_ADC);
+  LL_ADC_REG_StartConversionExtTrig(SCAN_ADC, LL_ADC_REG_TRIG_EXT_RISING);
+
+  /* 1MHz count, an update (and so a scan) every 500us */
+  if (LL_TIM_Init(SCAN_TIM, &(LL_TIM_InitTypeDef){
+          .Prescaler = FREQ / 1000000 - 1,
+          .CounterMode = LL_TIM_COUNTERMODE_UP,
+          .Autoreload = 1000000 / SCAN_HZ - 1,
+          .ClockDivision = LL_TIM_CLOCKDIVISION_DIV1}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_TIM_SetTriggerOutput(SCAN_TIM, LL_TIM_TRGO_UPDATE);
+  LL_TIM_EnableCounter(SCAN_TIM);
+
+  return true;
+}
+
+/**
+ * encoder_init
+ * \brief sets up the encoder pins and its timer in x4 encoder mode, and starts counting.
+ * \return true if success, false otherwise
+ */
+static bool encoder_init(void)
+{
+  /* The encoder switches to ground */
+  LL_GPIO_InitTypeDef io = {
+      .Mode = LL_GPIO_MODE_ALTERNATE,
+      .Speed = LL_GPIO_SPEED_FREQ_LOW,
+      .Pull = LL_GPIO_PULL_UP,
+      .Alternate = ENC_AF,
+  };
+
+  io.Pin = ENC_A_PIN;
+  if (LL_GPIO_Init(ENC_A_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  io.Pin = ENC_B_PIN;
+  if (LL_GPIO_Init(ENC_B_PORT, &io) != SUCCESS)
+  {
+    return false;
+  }
+
+  /* The filter samples at 25MHz/32 and wants 8 agreeing samples, ~10us */
+  if (LL_TIM_Init(ENC_TIM, &(LL_TIM_InitTypeDef){
+          .Prescaler = 0,
+          .CounterMode = LL_TIM_COUNTERMODE_UP,
+          .Autoreload = 0xFFFF,
+          .ClockDivision = LL_TIM_CLOCKDIVISION_DIV4}) != SUCCESS)
+  {
+    return false;
+  }
+
+  if (LL_TIM_ENCODER_Init(ENC_TIM, &(LL_TIM_ENCODER_InitTypeDef){
+          .EncoderMode = LL_TIM_ENCODERMODE_X4_TI12,
+          .IC1Polarity = LL_TIM_IC_POLARITY_RISING,
+          .IC1ActiveInput = LL_TIM_ACTIVEINPUT_DIRECTTI,
+          .IC1Prescaler = LL_TIM_ICPSC_DIV1,
+          .IC1Filter = LL_TIM_IC_FILTER_FDIV32_N8,
+          .IC2Polarity = LL_TIM_IC_POLARITY_RISING,
+          .IC2ActiveInput = LL_TIM_ACTIVEINPUT_DIRECTTI,
+          .IC2Prescaler = LL_TIM_ICPSC_DIV1,
+          .IC2Filter = LL_TIM_IC_FILTER_FDIV32_N8}) != SUCCESS)
+  {
+    return false;
+  }
+
+  LL_TIM_EnableCounter(ENC_TIM);
+
+  return true;
+}
+
+/**
+ * \brief Button EXTI Interrupt Handler
+ * \note The first edge of a press or release, ignore the bounces that follow and
+ *       look again once the contacts have settled.
+ */
+void BTN_EXTI_IRQ_HANDLER(void)
+{
+  LL_EXTI_DisableIT_0_31(BTN_EXTI_LINE);
+  LL_EXTI_ClearFlag_0_31(BTN_EXTI_LINE);
+
+  LL_TIM_SetCounter(DEBOUNCE_TIM, 0);
+  LL_TIM_EnableCounter(DEBOUNCE_TIM);
+}
+
+/**
+ * \brief Debounce Timer Interrupt Handler
+ * \note The contacts have settled, pass on a change and listen for the next edge.
+ */
+void DEBOUNCE_IRQ_HANDLER(void)
+{
+  LL_TIM_ClearFlag_UPDATE(DEBOUNCE_TIM);
+
+  /* Clear before reading, an edge after the read is caught by the next interrupt */
+  LL_EXTI_ClearFlag_0_31(BTN_EXTI_LINE);
+
+  bool pressed = USR_BTN_PRESSED();
+  if (pressed != button_pressed)
+  {
+    button_pressed = pressed;
+    ui_button_changed(pressed);
+  }
+
+  LL_EXTI_EnableIT_0_31(BTN_EXTI_LINE);
+}
+
+/**
+ * \brief Pot Scan DMA Interrupt Handler
+ * \note A batch of scans is complete, the UI decimates it here before the DMA comes back to this half.
+ */
+void SCAN_DMA_IRQ_HANDLER(void)
+{
+  if (LL_DMA_IsActiveFlag_TC0(SCAN_DMA))
+  {
+    LL_DMA_ClearFlag_TC0(SCAN_DMA);
+    ui_controls_ready(&scans[SCAN_BATCH * CONTROL_COUNT], SCAN_BATCH);
+  }
+  else
+  {
+    LL_DMA_ClearFlag_HT0(SCAN_DMA);
+    ui_controls_ready(&scans[0], SCAN_BATCH);
+  }
+}
@@ -0,0 +1,35 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __SECTIONS_H__
+#define __SECTIONS_H__
+
+/*
+  Placement of code and data in the linker sections of the board scripts.
+
+  RAMFUNC code is copied to RAM with .data at reset and runs with no flash
+  wait states whether or not the ART cache holds it. Use it for the inner
+  loops that run every block, it is never inlined so a flash caller cannot
+  pull it back into flash. Build with -DRAMFUNC=OFF to leave it in flash
+  and compare the two with -DDAE_BENCHMARK=ON.
+
+  DMA_BUFFER and NOINIT data is not zeroed at reset. DMA buffers are word
+  aligned and grouped together, the code that starts the DMA clears them if
+  it needs to. NOINIT is for large state that its init function clears anyway.
+*/
+
+#ifdef RAMFUNC_IN_FLASH
+#define RAMFUNC __attribute__((noinline))
+#else
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline))
+#endif
+
+#define DMA_BUFFER __attribute__((section(".dma_buffers"), aligned(4)))
+#define NOINIT __attribute__((section(".noinit")))
+
+#endif /* __SECTIONS_H__ */
@@ -66,11 +66,11 @@
 #define configUSE_IDLE_HOOK               0
 #define configUSE_TICK_HOOK               0
 #define configMAX_PRIORITIES              (7)
-#define configSUPPORT_STATIC_ALLOCATION   0
+#define configSUPPORT_STATIC_ALLOCATION   1
+#define configSUPPORT_DYNAMIC_ALLOCATION  0  /* No heap, every task and queue is static */
 #define configCPU_CLOCK_HZ                (SystemCoreClock)
 #define configTICK_RATE_HZ                ((TickType_t)1000)
 #define configMINIMAL_STACK_SIZE          ((uint16_t)128)
-#define configTOTAL_HEAP_SIZE             ((size_t)(25 * 1024))
 #define configMAX_TASK_NAME_LEN           (16)
 #define configUSE_TRACE_FACILITY          1
 #define configUSE_16_BIT_TICKS            0
@@ -82,7 +82,27 @@
 #define configUSE_MALLOC_FAILED_HOOK      0
 #define configUSE_APPLICATION_TASK_TAG    0
 #define configUSE_COUNTING_SEMAPHORES     1
-#define configGENERATE_RUN_TIME_STATS     0
+
+/* Run-time stats on the DWT cycle counter, see bsp/stats.h. The counter is read
+   by address on every context switch, this header cannot include the CMSIS one. */
+#ifdef RUN_TIME_STATS
+  #define configGENERATE_RUN_TIME_STATS            1
+  #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() stats_timer_init()
+  #define portGET_RUN_TIME_COUNTER_VALUE()         (*(volatile uint32_t *)0xE0001004UL)
+  #if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+    void stats_timer_init(void);
+  #endif
+#else
+  #define configGENERATE_RUN_TIME_STATS            0
+#endif
+
+/* SystemView trace hooks, see bsp/sysview.h. The trace records each task's stack bounds. */
+#ifdef SYSVIEW_ENABLED
+  #define configRECORD_STACK_HIGH_ADDRESS          1
+  #if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+    #include "sysview.h"
+  #endif
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
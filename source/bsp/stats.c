@@ -0,0 +1,158 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "stats.h"
+#include "trace.h"
+
+/*
+  The report is one line per task and per timed interrupt:
+
+     cpu%  stack  name
+     41.3    212  DAE
+      0.9      -  ISR audio, max 850 cycles
+
+  cpu% is the share of the last period, stack the fewest words ever left
+  unused. The idle task's share is the headroom. A task near 0 stack words
+  is about to overflow, a DAE share near its deadline or an interrupt with
+  a long max call is the usual cause of a glitch.
+*/
+
+/* Tasks the report has room for */
+#define STATS_MAX_TASKS (10)
+
+/* Interrupts timed by the handlers */
+stats_isr_t stats_audio_isr;
+stats_isr_t stats_midi_isr;
+
+/* The stats task, allocated statically */
+#define STATS_STACK_SIZE (configMINIMAL_STACK_SIZE * 2)
+static StackType_t stats_stack[STATS_STACK_SIZE];
+static StaticTask_t stats_tcb;
+
+/* Task states, and each task's run time at the last report indexed by its task number */
+static TaskStatus_t status[STATS_MAX_TASKS];
+static uint32_t last_run_time[STATS_MAX_TASKS + 1];
+
+/* Interrupt totals at the last report */
+static uint32_t last_audio_isr;
+static uint32_t last_midi_isr;
+
+/* Private functions */
+static uint32_t permille(uint32_t part, uint32_t whole);
+static void report_isr(const char *name, stats_isr_t *isr, uint32_t *last, uint32_t elapsed);
+
+/**
+ * stats_timer_init
+ * \brief starts the DWT cycle counter, the run-time stats clock.
+ * \note called by the kernel as the scheduler starts.
+ */
+void stats_timer_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * stats_task
+ * \brief prints the run-time statistics every STATS_PERIOD_MS.
+ * \param pvParameters - unused
+ * \note this task never returns
+ */
+static void stats_task(void *pvParameters)
+{
+  uint32_t last_total = 0;
+
+  while (1)
+  {
+    vTaskDelay(pdMS_TO_TICKS(STATS_PERIOD_MS));
+
+    uint32_t total;
+    UBaseType_t n = uxTaskGetSystemState(status, STATS_MAX_TASKS, &total);
+    uint32_t elapsed = total - last_total;
+    last_total = total;
+
+    RTT_LOG("%s cpu%%  stack  name\n", RTT_CTRL_TEXT_BRIGHT_CYAN);
+
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+      UBaseType_t number = status[i].xTaskNumber;
+      uint32_t run_time = status[i].ulRunTimeCounter;
+      uint32_t share = 0;
+
+      if (number <= STATS_MAX_TASKS)
+      {
+        share = permille(run_time - last_run_time[number], elapsed);
+        last_run_time[number] = run_time;
+      }
+
+      RTT_LOG("%3u.%u  %5u  %s\n", (unsigned)(share / 10), (unsigned)(share % 10),
+              (unsigned)status[i].usStackHighWaterMark, status[i].pcTaskName);
+    }
+
+    report_isr("ISR audio", &stats_audio_isr, &last_audio_isr, elapsed);
+    report_isr("ISR midi", &stats_midi_isr, &last_midi_isr, elapsed);
+  }
+}
+
+/**
+ * report_isr
+ * \brief prints an interrupt's share of the period and its longest call.
+ * \param name the name printed
+ * \param isr the handler's times
+ * \param last the handler's total at the last report, updated
+ * \param elapsed the cycles in the period
+ */
+static void report_isr(const char *name, stats_isr_t *isr, uint32_t *last, uint32_t elapsed)
+{
+  uint32_t cycles = isr->cycles;
+  uint32_t share = permille(cycles - *last, elapsed);
+  uint32_t max = isr->max;
+
+  /* A longer call landing between the read and the clear is lost, it shows up again if it matters */
+  isr->max = 0;
+  *last = cycles;
+
+  RTT_LOG("%3u.%u      -  %s, max %u cycles\n", (unsigned)(share / 10), (unsigned)(share % 10), name, (unsigned)max);
+}
+
+/**
+ * permille
+ * \brief part as tenths of a percent of whole.
+ * \param part the part
+ * \param whole the whole, 0 gives 0
+ * \return 0 to 1000
+ */
+static uint32_t permille(uint32_t part, uint32_t whole)
+{
+  if (whole == 0)
+  {
+    return 0;
+  }
+
+  return (uint32_t)(((uint64_t)part * 1000 + whole / 2) / whole);
+}
+
+/**
+ * stats_start
+ * \brief creates the stats task.
+ * \param priority the priority level for the task, the lowest above idle keeps it out of the way
+ * \return true if created, false otherwise
+ */
+bool stats_start(UBaseType_t priority)
+{
+  if (xTaskCreateStatic(stats_task, "STATS", STATS_STACK_SIZE, NULL, priority, stats_stack, &stats_tcb) == NULL)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,72 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "stm32f411xe.h"
+#include "task.h"
+
+/*
+  Run-time statistics, built with -DRUN_TIME_STATS=ON and reported over RTT.
+
+  FreeRTOS charges the DWT cycle counter to the task switched out, a stats
+  task prints each task's share of the CPU and its unused stack every
+  STATS_PERIOD_MS. Interrupts are charged to the task they interrupt, the
+  handlers that matter time themselves with STATS_ISR_ENTER/EXIT and are
+  printed on their own lines, with the longest single call.
+
+  The cycle counter wraps every 43s at 100MHz, only differences over a
+  period are used so that is harmless. Nothing resets it, the benchmarks'
+  DWT_START() and the audio input wait take differences too.
+*/
+
+/* Reporting period */
+#ifndef STATS_PERIOD_MS
+#define STATS_PERIOD_MS (2000)
+#endif
+
+/* Time spent in an interrupt handler, written by the handler only */
+typedef struct
+{
+  volatile uint32_t cycles; /* Total, wraps */
+  volatile uint32_t calls;
+  volatile uint32_t max;    /* Longest call, cleared when printed */
+} stats_isr_t;
+
+#ifdef RUN_TIME_STATS
+#define STATS_CYCLES() (DWT->CYCCNT)
+#define STATS_ISR_ENTER() uint32_t stats_isr_entry = STATS_CYCLES()
+#define STATS_ISR_EXIT(isr)                                       \
+  do                                                              \
+  {                                                               \
+    uint32_t stats_isr_cycles = STATS_CYCLES() - stats_isr_entry; \
+    (isr)->cycles += stats_isr_cycles;                            \
+    (isr)->calls++;                                               \
+    if (stats_isr_cycles > (isr)->max)                            \
+    {                                                             \
+      (isr)->max = stats_isr_cycles;                              \
+    }                                                             \
+  } while (0)
+
+extern stats_isr_t stats_audio_isr;
+extern stats_isr_t stats_midi_isr;
+#else
+#define STATS_ISR_ENTER()
+#define STATS_ISR_EXIT(isr)
+#endif
+
+/* API */
+void stats_timer_init(void);
+bool stats_start(UBaseType_t priority);
+
+#endif /* __STATS_H__ */
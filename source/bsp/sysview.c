@@ -0,0 +1,123 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdint.h>
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "stm32f411xe.h"
+#include "board.h"
+#include "sysview.h"
+
+/* Tasks the trace has room to describe */
+#define SYSVIEW_MAX_TASKS (10)
+
+/* Tasks as created, sent again with every sync so a trace joined late still names them */
+static SEGGER_SYSVIEW_TASKINFO tasks[SYSVIEW_MAX_TASKS];
+static unsigned task_count;
+
+/* Names of the traced interrupts, by exception number */
+static char interrupts[SEGGER_SYSVIEW_MAX_STRING_LEN];
+
+/* Private functions */
+static U64 get_time(void);
+static void send_task_list(void);
+static void send_system_description(void);
+
+/* Kernel interface for the recorder */
+static const SEGGER_SYSVIEW_OS_API os_api = {get_time, send_task_list};
+
+/**
+ * sysview_init
+ * \brief starts the DWT cycle counter and the SystemView recorder.
+ * \note call before any task is created. In post-mortem mode recording
+ *       starts here, otherwise when the host connects.
+ */
+void sysview_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* Exception numbers are the IRQ numbers offset by the 16 system exceptions */
+  snprintf(interrupts, sizeof(interrupts), "I#%u=AudioDMA,I#%u=MIDI_DMA,I#%u=MIDI_UART",
+           (unsigned)(DMA_IRQN + 16), (unsigned)(MIDI_DMA_IRQN + 16), (unsigned)(MIDI_UART_IRQN + 16));
+
+  SEGGER_SYSVIEW_Init(SystemCoreClock, SystemCoreClock, &os_api, send_system_description);
+  SEGGER_SYSVIEW_SetRAMBase(SRAM1_BASE);
+
+#if (SEGGER_SYSVIEW_POST_MORTEM_MODE == 1)
+  SEGGER_SYSVIEW_Start();
+#endif
+}
+
+/**
+ * sysview_task_created
+ * \brief records a new task, called by the kernel's traceTASK_CREATE hook.
+ * \param id the task's TCB address, its id in the trace
+ * \param name the task name
+ * \param priority the task priority
+ * \param stack_base the lowest address of the stack
+ * \param stack_size the stack size in bytes
+ */
+void sysview_task_created(uint32_t id, const char *name, uint32_t priority, uint32_t stack_base, uint32_t stack_size)
+{
+  SEGGER_SYSVIEW_OnTaskCreate(id);
+
+  if (task_count == SYSVIEW_MAX_TASKS)
+  {
+    return;
+  }
+
+  SEGGER_SYSVIEW_TASKINFO *task = &tasks[task_count++];
+  task->TaskID = id;
+  task->sName = name;
+  task->Prio = priority;
+  task->StackBase = stack_base;
+  task->StackSize = stack_size;
+  task->StackUsage = 0;
+
+  SEGGER_SYSVIEW_SendTaskInfo(task);
+}
+
+/**
+ * get_time
+ * \brief the system time for the trace.
+ * \return microseconds since the scheduler started, to the tick
+ */
+static U64 get_time(void)
+{
+  return (U64)xTaskGetTickCountFromISR() * (1000000 / configTICK_RATE_HZ);
+}
+
+/**
+ * send_task_list
+ * \brief describes every task to the trace.
+ */
+static void send_task_list(void)
+{
+  for (unsigned i = 0; i < task_count; i++)
+  {
+    SEGGER_SYSVIEW_SendTaskInfo(&tasks[i]);
+  }
+}
+
+/**
+ * send_system_description
+ * \brief names the system, the traced interrupts and the markers.
+ * \note sent with every sync, the markers are named here so a post-mortem
+ *       ring that has lost its start still has them.
+ */
+static void send_system_description(void)
+{
+  SEGGER_SYSVIEW_SendSysDesc("N=" SEGGER_SYSVIEW_APP_NAME ",D=" SEGGER_SYSVIEW_DEVICE_NAME ",O=FreeRTOS");
+  SEGGER_SYSVIEW_SendSysDesc(interrupts);
+  SEGGER_SYSVIEW_NameMarker(SYSVIEW_MARKER_PROCESS, "dae_process_block");
+  SEGGER_SYSVIEW_NameMarker(SYSVIEW_MARKER_PACK, "pack_output");
+}
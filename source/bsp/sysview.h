@@ -0,0 +1,99 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __SYSVIEW_H__
+#define __SYSVIEW_H__
+
+#include <stdint.h>
+
+/*
+  SEGGER SystemView tracing, built with -DSYSVIEW=ON.
+
+  The kernel records every task switch, wake, block and suspend through
+  the trace hooks below, the audio and MIDI handlers record their entry
+  and exit and the DAE marks each block's processing and packing.
+  SystemView shows the DMA interrupt to DAE wake latency and anything that
+  preempts the block.
+
+  Live traces stream over RTT channel 1 with a J-Link. Built with
+  -DSYSVIEW_POST_MORTEM=ON the events overwrite a RAM ring instead and
+  nothing needs to read them, halt the target with any debugger, dump RAM
+  and decode it with tools/sysview_dump.py.
+
+  Events are timed by the DWT cycle counter, which nothing resets so the
+  timeline has no steps.
+
+  This header is included by FreeRTOSConfig.h, it cannot include FreeRTOS.h.
+*/
+
+/* Performance markers, named in the trace */
+#define SYSVIEW_MARKER_PROCESS (0) /* dae_process_block() */
+#define SYSVIEW_MARKER_PACK (1)    /* pack_output() */
+
+#ifdef SYSVIEW_ENABLED
+#include "SEGGER_SYSVIEW.h"
+
+#define SYSVIEW_ISR_ENTER() SEGGER_SYSVIEW_RecordEnterISR()
+#define SYSVIEW_ISR_EXIT() SEGGER_SYSVIEW_RecordExitISR()
+#define SYSVIEW_MARK_START(marker) SEGGER_SYSVIEW_MarkStart(marker)
+#define SYSVIEW_MARK_STOP(marker) SEGGER_SYSVIEW_MarkStop(marker)
+
+/*
+  Kernel trace hooks, expanded inside tasks.c and queue.c. The stock kernel
+  has no hook where a task leaves the ready list (SEGGER's patched kernel
+  adds them), so a task is recorded as blocked by the hooks of the calls
+  that block it: a delay, a notification wait, a queue or semaphore wait,
+  and as suspended by vTaskSuspend(). Each runs just before the task is
+  moved off the ready list. queue.c cannot see pxCurrentTCB, the queue
+  hooks ask for the current task instead.
+*/
+#define SYSVIEW_CAUSE_BLOCKED (1u << 2)
+#define SYSVIEW_CAUSE_SUSPENDED ((3u << 3) | 3)
+
+#define traceTASK_CREATE(pxNewTCB)                                                         \
+  sysview_task_created((uint32_t)(pxNewTCB), (pxNewTCB)->pcTaskName, (pxNewTCB)->uxPriority, \
+                       (uint32_t)(pxNewTCB)->pxStack,                                      \
+                       (uint32_t)(pxNewTCB)->pxEndOfStack - (uint32_t)(pxNewTCB)->pxStack)
+
+#define traceTASK_SWITCHED_IN()                       \
+  if (pxCurrentTCB == xIdleTaskHandle)                \
+  {                                                   \
+    SEGGER_SYSVIEW_OnIdle();                          \
+  }                                                   \
+  else                                                \
+  {                                                   \
+    SEGGER_SYSVIEW_OnTaskStartExec((U32)pxCurrentTCB); \
+  }
+
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) SEGGER_SYSVIEW_OnTaskStartReady((U32)(pxTCB))
+
+#define traceTASK_DELAY() SEGGER_SYSVIEW_OnTaskStopReady((U32)pxCurrentTCB, SYSVIEW_CAUSE_BLOCKED)
+#define traceTASK_DELAY_UNTIL(xTimeToWake) SEGGER_SYSVIEW_OnTaskStopReady((U32)pxCurrentTCB, SYSVIEW_CAUSE_BLOCKED)
+#define traceTASK_NOTIFY_TAKE_BLOCK() SEGGER_SYSVIEW_OnTaskStopReady((U32)pxCurrentTCB, SYSVIEW_CAUSE_BLOCKED)
+#define traceTASK_NOTIFY_WAIT_BLOCK() SEGGER_SYSVIEW_OnTaskStopReady((U32)pxCurrentTCB, SYSVIEW_CAUSE_BLOCKED)
+#define traceTASK_SUSPEND(pxTCB) SEGGER_SYSVIEW_OnTaskStopReady((U32)(pxTCB), SYSVIEW_CAUSE_SUSPENDED)
+
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) \
+  SEGGER_SYSVIEW_OnTaskStopReady((U32)xTaskGetCurrentTaskHandle(), SYSVIEW_CAUSE_BLOCKED)
+#define traceBLOCKING_ON_QUEUE_PEEK(pxQueue) \
+  SEGGER_SYSVIEW_OnTaskStopReady((U32)xTaskGetCurrentTaskHandle(), SYSVIEW_CAUSE_BLOCKED)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) \
+  SEGGER_SYSVIEW_OnTaskStopReady((U32)xTaskGetCurrentTaskHandle(), SYSVIEW_CAUSE_BLOCKED)
+
+#else
+#define SYSVIEW_ISR_ENTER()
+#define SYSVIEW_ISR_EXIT()
+#define SYSVIEW_MARK_START(marker)
+#define SYSVIEW_MARK_STOP(marker)
+#endif /* SYSVIEW_ENABLED */
+
+/* API */
+void sysview_init(void);
+void sysview_task_created(uint32_t id, const char *name, uint32_t priority, uint32_t stack_base, uint32_t stack_size);
+
+#endif /* __SYSVIEW_H__ */
@@ -66,21 +66,20 @@
 /** 
  * \brief DWT cycle counter setup - used for timing measurements
  * \note This initializes the ARM Cortex debug hardware for cycle counting
- *       Put this at the beginning of a function where you want to measure performance
+ *       Put this at the beginning of a function where you want to measure performance.
+ *       The counter is never reset, run-time stats and SystemView time from it too.
  */
 #define DWT_INIT()                                \
   uint32_t dwt_start, dwt_end, dwt_cycles;        \
   uint32_t dwt_time_us;                           \
   CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
-  DWT->CYCCNT = 0;                                \
   DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
 /** 
- * \brief Resets and starts the cycle counter
+ * \brief Starts a measurement, the cycles are the difference to DWT_OUTPUT()
  * \note Call this right before the code you want to measure
  */
-#define DWT_CLEAR() \
-  DWT->CYCCNT = 0;  \
+#define DWT_START() \
   dwt_start = DWT->CYCCNT;
 
 /*
@@ -109,7 +108,7 @@
 #define RTT_LOG_FLOAT(fmt, ...)
 #define RTT_ASSERT(expr)
 #define DWT_INIT()
-#define DWT_CLEAR()
+#define DWT_START()
 #define DWT_OUTPUT(function)
 
 #endif /* RTT_ENABLED */
@@ -6,34 +6,107 @@
    with or without fee is hereby granted, provided the above copyright notice and
    this permission notice appear in all copies.
 */
-#include "dae.h"
-
-/* Configuration */
-#ifndef DAE_SAMPLE_RATE
-#define DAE_SAMPLE_RATE (48000)
-#endif
+#include <assert.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
 
-#ifndef DAE_AUDIO_BLOCK_SIZE
-#define DAE_AUDIO_BLOCK_SIZE (128)
+#include "arena.h"
+#include "dae.h"
+#include "dither.h"
+#include "sections.h"
+#include "semphr.h"
+#include "sysview.h"
+
+static_assert(DAE_AUDIO_BITS == 16 || DAE_AUDIO_BITS == 24 || DAE_AUDIO_BITS == 32, "DAE_AUDIO_BITS must be 16, 24 or 32");
+
+/* Configuration, the DMA moves 16-bit transfers, a 16 bit slot is one and the longer slots two */
+#if DAE_AUDIO_BITS == 16
+#define DAE_FRAME_TRANSFERS (2)
+#else
+#define DAE_FRAME_TRANSFERS (4)
 #endif
 
-#define DAE_AUDIO_BUFFER_SIZE (DAE_AUDIO_BLOCK_SIZE * 8)
+#define DAE_AUDIO_BUFFER_SIZE (DAE_AUDIO_BLOCK_SIZE * DAE_FRAME_TRANSFERS * 2)
 
 /* Sample and audio buffers */
 static float left_buffer[DAE_AUDIO_BLOCK_SIZE];
 static float right_buffer[DAE_AUDIO_BLOCK_SIZE];
-static int16_t audio_buffer[DAE_AUDIO_BUFFER_SIZE];
+static DMA_BUFFER int16_t audio_buffer[DAE_AUDIO_BUFFER_SIZE];
+
+/* Audio input, filled by the DMA in lock step with audio_buffer, zero if the board has none */
+static float in_left_buffer[DAE_AUDIO_BLOCK_SIZE];
+static float in_right_buffer[DAE_AUDIO_BLOCK_SIZE];
+static DMA_BUFFER int16_t input_buffer[DAE_AUDIO_BUFFER_SIZE];
+
+/*
+  Engine state, allocated from the arena by dae_prepare_for_play() and fixed
+  from then on. Its init functions clear it so the arena is not cleared at reset.
+*/
+static NOINIT alignas(ARENA_ALIGN) uint8_t arena_memory[DAE_ARENA_SIZE];
+static arena_t arena;
+static bool arena_sealed;
+
+/* Output dither, only used for 16 bit words */
+static dither_t dither;
 
 /* State variables */
 static uint8_t active_buffer = PONG;
 static TaskHandle_t dae_task_handle;
 
+/* The DAE task, allocated statically */
+#define DAE_STACK_SIZE (configMINIMAL_STACK_SIZE * 4)
+static StackType_t dae_stack[DAE_STACK_SIZE];
+static StaticTask_t dae_tcb;
+
+/* True while a DMA half-buffer holds nothing but zeros, audio_buffer is zeroed before the DMA starts */
+static bool half_is_silent[2] = {true, true};
+
+/* True while the input blocks hold nothing but zeros */
+static bool input_is_silent = true;
+
+/* Blocks handed to the DMA since start, the basis of the sample clock */
+static volatile uint32_t block_count;
+
+/*
+  MIDI input, bytes are parsed in the UART interrupt and the events queued for
+  the DAE task. Both are valid zero-initialised, the UART may deliver bytes
+  before the DAE has started.
+*/
+static midi_parser_t midi_parser;
+static midi_queue_t midi_queue;
+
+/* Tempo and beat phase from incoming MIDI clock, written by the DAE task only */
+static midi_clock_t midi_clock;
+
+/* Poll interval while waiting for the DAE to hold for a flash erase */
+#define HOLD_POLL_MS (10)
+
+/*
+  Flash erase window, see dae_flash_erase(). The DAE task holds, neither
+  reading MIDI nor rendering, while hold_request is set and the output is
+  silent, held tells the erasing task it has.
+*/
+static atomic_bool hold_request;
+static atomic_bool held;
+static SemaphoreHandle_t erase_mutex;
+static StaticSemaphore_t erase_mutex_state;
+
 /* Imported functions */
-void audio_start(int16_t audio_buffer[], size_t buf_len, uint32_t sample_rate);
+uint32_t audio_start(int16_t audio_buffer[], int16_t input_buffer[], size_t buf_len, uint32_t sample_rate, uint8_t bits);
+uint32_t audio_position(void);
+bool audio_input(uint8_t buffer_idx);
+void midi_receive(bool enable);
+bool flash_erase(uint32_t address);
 
 /* Private functions */
 static void check_buffer(float *buffer, int sampleCount);
+static void pack_output(const float *restrict left, const float *restrict right, int16_t *restrict dst, size_t block_size);
+static void unpack_input(const int16_t *restrict src, float *restrict left, float *restrict right, size_t block_size);
 static void generate_test_tone(float *restrict left, float *restrict right, size_t block_size);
+#ifdef DAE_BENCHMARK
+static void benchmark(void);
+#endif
 
 /**
  * dae_task
@@ -42,39 +115,258 @@ static void generate_test_tone(float *restrict left, float *restrict right, size
  */
 static void dae_task(void *pvParameters)
 {
-  /* Starts the board audio subsystem (I2S and DMA peripherals) */
-  audio_start(audio_buffer, DAE_AUDIO_BUFFER_SIZE, DAE_SAMPLE_RATE);  
+  /* DMA buffers are not zeroed at reset, the first blocks out are silence */
+  memset(audio_buffer, 0, sizeof(audio_buffer));
 
+  /* Starts the board audio subsystem (I2S and DMA peripherals), the codec may not run at the rate asked for */
+  uint32_t sample_rate = audio_start(audio_buffer, input_buffer, DAE_AUDIO_BUFFER_SIZE, DAE_SAMPLE_RATE, DAE_AUDIO_BITS);
+  if (sample_rate == 0)
+  {
+    /* No audio, nothing to prepare or run, the rest of the unit carries on without it */
+    RTT_LOG("%sDAE audio failed to start\n", RTT_CTRL_TEXT_BRIGHT_RED);
+    vTaskSuspend(NULL);
+  }
 
   /* Configures the sound source for playing, passing it DAE parameters and obtaining the MIDI channel */
-  dae_prepare_for_play(DAE_SAMPLE_RATE,DAE_AUDIO_BLOCK_SIZE);
+  arena_init(&arena, arena_memory, sizeof(arena_memory));
+  bool prepared = dae_prepare_for_play((float)sample_rate, DAE_AUDIO_BLOCK_SIZE);
+
+#ifdef DAE_BENCHMARK
+  /* Timed on the freshly prepared engine, which is then prepared again from an empty arena */
+  if (prepared)
+  {
+    benchmark();
+    arena_init(&arena, arena_memory, sizeof(arena_memory));
+    prepared = dae_prepare_for_play((float)sample_rate, DAE_AUDIO_BLOCK_SIZE);
+  }
+#endif
+
+  /* The audio path never allocates */
+  arena_sealed = true;
+  RTT_LOG("DAE arena %u of %u bytes\n", (unsigned)arena_peak(&arena), (unsigned)sizeof(arena_memory));
+
+  /* An engine that could not be prepared is never run, the output stays silent */
+  if (!prepared)
+  {
+    RTT_LOG("%sDAE engine not prepared, output muted\n", RTT_CTRL_TEXT_BRIGHT_RED);
+  }
+
+  midi_clock_init(&midi_clock, sample_rate);
+  dither_init(&dither, 0x5EED1234u);
 
   while (1)
   {
     /* Sleep until the DMA signals us to refresh a buffer */
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-    /* Call audio source to generate the audio block */
-    dae_process_block(left_buffer, right_buffer, DAE_AUDIO_BLOCK_SIZE);
+    /* Held for a flash erase, the DMA replays the silent half-buffers until released */
+    bool hold = atomic_load_explicit(&hold_request, memory_order_acquire) && dae_is_silent();
+    atomic_store_explicit(&held, hold, memory_order_release);
+    if (hold)
+    {
+      continue;
+    }
 
-    /* Select the buffer to which audio is output */
-    int16_t *restrict ptr = (active_buffer == PING) ? audio_buffer : audio_buffer + DAE_AUDIO_BUFFER_SIZE / 2;
+    /* Deliver the MIDI that arrived during the last block */
+    midi_event_t event;
+    while (midi_queue_pop(&midi_queue, &event))
+    {
+      midi_clock_event(&midi_clock, &event);
+      if (prepared)
+      {
+        dae_midi_event(&event);
+      }
+    }
 
-/* Copy samples to audio buffer in I2S required format */
-#pragma GCC unroll 4
-    for (int i = 0; i < DAE_AUDIO_BLOCK_SIZE; i++)
+    uint8_t buffer_idx = active_buffer;
+
+    /*
+      The input captured while the last output half played, it is rendered into
+      the half that plays next so it reaches the output exactly one block after
+      it was captured.
+    */
+    if (audio_input(buffer_idx))
     {
-      int32_t l_sample = left_buffer[i] * INT32_MAX;
-      int32_t r_sample = right_buffer[i] * INT32_MAX;
+      unpack_input(buffer_idx == PING ? input_buffer : input_buffer + DAE_AUDIO_BUFFER_SIZE / 2,
+                   in_left_buffer, in_right_buffer, DAE_AUDIO_BLOCK_SIZE);
+      input_is_silent = false;
+    }
+    else if (!input_is_silent)
+    {
+      /* No input, or it stalled, the last block must not be played again */
+      memset(in_left_buffer, 0, sizeof(in_left_buffer));
+      memset(in_right_buffer, 0, sizeof(in_right_buffer));
+      input_is_silent = true;
+    }
 
-      *ptr++ = (int16_t)(r_sample >> 16);
-      *ptr++ = (int16_t)(r_sample);
-      *ptr++ = (int16_t)(l_sample >> 16);
-      *ptr++ = (int16_t)(l_sample);
+    /* Select the buffer to which audio is output */
+    int16_t *restrict ptr = (buffer_idx == PING) ? audio_buffer : audio_buffer + DAE_AUDIO_BUFFER_SIZE / 2;
+
+    /* Call audio source to generate the audio block */
+    SYSVIEW_MARK_START(SYSVIEW_MARKER_PROCESS);
+    bool playing = prepared && dae_process_block(in_left_buffer, in_right_buffer, left_buffer, right_buffer, DAE_AUDIO_BLOCK_SIZE);
+    SYSVIEW_MARK_STOP(SYSVIEW_MARKER_PROCESS);
+
+    if (!playing)
+    {
+      /*
+        Silent, the half-buffer is zeroed once and then left alone so an idle
+        engine costs nothing but the wake up.
+      */
+      if (!half_is_silent[buffer_idx])
+      {
+        memset(ptr, 0, DAE_AUDIO_BUFFER_SIZE / 2 * sizeof(int16_t));
+        half_is_silent[buffer_idx] = true;
+      }
+      continue;
     }
+
+    half_is_silent[buffer_idx] = false;
+
+    /* Copy samples to audio buffer in I2S required format */
+    SYSVIEW_MARK_START(SYSVIEW_MARKER_PACK);
+    pack_output(left_buffer, right_buffer, ptr, DAE_AUDIO_BLOCK_SIZE);
+    SYSVIEW_MARK_STOP(SYSVIEW_MARKER_PACK);
+  }
+}
+
+/**
+ * pack_output
+ * \brief converts a block to the I2S output format, the kernel is chosen by DAE_AUDIO_BITS.
+ * \details a 32 bit slot goes out as its high then low halfword, 24 bits is the
+ *          same with the low byte zero. A 16 bit slot is one halfword, dithered.
+ *          Samples beyond full scale are clipped.
+ * \param left the left samples
+ * \param right the right samples
+ * \param dst the half-buffer, right then left slot for each frame
+ * \param block_size the number of frames
+ */
+RAMFUNC static void pack_output(const float *restrict left, const float *restrict right, int16_t *restrict dst, size_t block_size)
+{
+#if DAE_AUDIO_BITS == 16
+#pragma GCC unroll 4
+  for (size_t i = 0; i < block_size; i++)
+  {
+#if DAE_DITHER == DAE_DITHER_SHAPED
+    *dst++ = dither_shaped_int16(&dither, right[i], 1);
+    *dst++ = dither_shaped_int16(&dither, left[i], 0);
+#elif DAE_DITHER == DAE_DITHER_TPDF
+    *dst++ = dither_tpdf_int16(&dither, right[i]);
+    *dst++ = dither_tpdf_int16(&dither, left[i]);
+#else
+    *dst++ = dither_round(right[i] * 32767.0f);
+    *dst++ = dither_round(left[i] * 32767.0f);
+#endif
+  }
+#else
+#pragma GCC unroll 4
+  for (size_t i = 0; i < block_size; i++)
+  {
+    /* Clipped first, a float to int conversion out of range is undefined and wraps on the M4 */
+    float l = fminf(fmaxf(left[i], -1.0f), 1.0f);
+    float r = fminf(fmaxf(right[i], -1.0f), 1.0f);
+
+#if DAE_AUDIO_BITS == 24
+    int32_t l_sample = (int32_t)(l * 8388607.0f) * 256;
+    int32_t r_sample = (int32_t)(r * 8388607.0f) * 256;
+#else
+    /* INT32_MAX rounds up to 2^31 as a float, this is the largest float below it */
+    int32_t l_sample = (int32_t)(l * 2147483520.0f);
+    int32_t r_sample = (int32_t)(r * 2147483520.0f);
+#endif
+
+    *dst++ = (int16_t)(r_sample >> 16);
+    *dst++ = (int16_t)(r_sample);
+    *dst++ = (int16_t)(l_sample >> 16);
+    *dst++ = (int16_t)(l_sample);
+  }
+#endif
+}
+
+/**
+ * unpack_input
+ * \brief converts a half-buffer of I2S input to float, the inverse of the output packing.
+ * \details each 32 bit slot arrives as its high then low halfword, one word load
+ *          and a rotate puts it back together so a sample costs a load, a rotate
+ *          and a convert. A 24 bit slot arrives the same with its low byte zero,
+ *          the input is in the output's word length.
+ * \param src the half-buffer, right then left slot for each frame
+ * \param left receives the left samples
+ * \param right receives the right samples
+ * \param block_size the number of frames
+ */
+RAMFUNC static void unpack_input(const int16_t *restrict src, float *restrict left, float *restrict right, size_t block_size)
+{
+#if DAE_AUDIO_BITS == 16
+#pragma GCC unroll 4
+  for (size_t i = 0; i < block_size; i++)
+  {
+    right[i] = (float)src[0] * (1.0f / 32768.0f);
+    left[i] = (float)src[1] * (1.0f / 32768.0f);
+    src += 2;
   }
+#else
+#pragma GCC unroll 4
+  for (size_t i = 0; i < block_size; i++)
+  {
+    uint32_t r_slot;
+    uint32_t l_slot;
+
+    memcpy(&r_slot, src, sizeof(r_slot));
+    memcpy(&l_slot, src + 2, sizeof(l_slot));
+    src += 4;
+
+    right[i] = (float)(int32_t)((r_slot << 16) | (r_slot >> 16)) * (1.0f / 2147483648.0f);
+    left[i] = (float)(int32_t)((l_slot << 16) | (l_slot >> 16)) * (1.0f / 2147483648.0f);
+  }
+#endif
 }
 
+#ifdef DAE_BENCHMARK
+/**
+ * benchmark
+ * \brief measures the cycle count of the block kernels, results go to RTT.
+ * \note run once by the DAE task when built with -DDAE_BENCHMARK=ON. It renders into a
+ *       scratch buffer, the engine must be prepared again afterwards so nothing it
+ *       rendered is heard. The kernels run from RAM unless built with -DRAMFUNC=OFF,
+ *       compare the two builds to see what the flash wait states cost.
+ */
+static void benchmark(void)
+{
+  static int16_t scratch[DAE_AUDIO_BUFFER_SIZE / 2];
+
+  DWT_INIT();
+
+#ifdef RAMFUNC_IN_FLASH
+  RTT_LOG("%sDAE kernels in flash, block %u\n", RTT_CTRL_TEXT_BRIGHT_CYAN, DAE_AUDIO_BLOCK_SIZE);
+#else
+  RTT_LOG("%sDAE kernels in RAM, block %u\n", RTT_CTRL_TEXT_BRIGHT_CYAN, DAE_AUDIO_BLOCK_SIZE);
+#endif
+
+  /* Non-silent input so the idle bypasses do not kick in */
+  for (size_t i = 0; i < DAE_AUDIO_BLOCK_SIZE; i++)
+  {
+    in_left_buffer[i] = (i & 1) ? 0.5f : -0.5f;
+    in_right_buffer[i] = in_left_buffer[i];
+  }
+
+  DWT_START();
+  dae_process_block(in_left_buffer, in_right_buffer, left_buffer, right_buffer, DAE_AUDIO_BLOCK_SIZE);
+  DWT_OUTPUT("dae_process_block");
+
+  DWT_START();
+  pack_output(left_buffer, right_buffer, scratch, DAE_AUDIO_BLOCK_SIZE);
+  DWT_OUTPUT("pack_output");
+
+  DWT_START();
+  unpack_input(scratch, in_left_buffer, in_right_buffer, DAE_AUDIO_BLOCK_SIZE);
+  DWT_OUTPUT("unpack_input");
+
+  memset(in_left_buffer, 0, sizeof(in_left_buffer));
+  memset(in_right_buffer, 0, sizeof(in_right_buffer));
+}
+#endif
+
 /**
  * dae_start
  * \brief This kicks off the DAE thread (RTOS task)
@@ -82,7 +374,14 @@ static void dae_task(void *pvParameters)
  */
 bool dae_start(UBaseType_t priority)
 {
-  if (xTaskCreate(dae_task, "DAE", configMINIMAL_STACK_SIZE * 4, NULL, priority, &dae_task_handle) != pdPASS)
+  erase_mutex = xSemaphoreCreateMutexStatic(&erase_mutex_state);
+  if (erase_mutex == NULL)
+  {
+    return false;
+  }
+
+  dae_task_handle = xTaskCreateStatic(dae_task, "DAE", DAE_STACK_SIZE, NULL, priority, dae_stack, &dae_tcb);
+  if (dae_task_handle == NULL)
   {
     return false;
   }
@@ -91,6 +390,35 @@ bool dae_start(UBaseType_t priority)
 }
 
 
+/**
+ * dae_alloc
+ * \brief allocates engine state from the DAE arena.
+ * \param size the size in bytes
+ * \return the memory, 8 byte aligned and not cleared, NULL if the arena is full
+ * \note only for dae_prepare_for_play(), the arena is sealed once audio runs and
+ *       the memory is never freed. Raise DAE_ARENA_SIZE if it fills, or lower it
+ *       to dae_arena_peak().
+ */
+void *dae_alloc(size_t size)
+{
+  RTT_ASSERT(!arena_sealed);
+
+  void *memory = arena_sealed ? NULL : arena_alloc(&arena, size);
+  RTT_ASSERT(memory != NULL);
+
+  return memory;
+}
+
+/**
+ * dae_arena_peak
+ * \brief the most engine state ever allocated, the arena high water mark.
+ * \return the peak in bytes, of DAE_ARENA_SIZE
+ */
+size_t dae_arena_peak(void)
+{
+  return arena_peak(&arena);
+}
+
 /**
  * dae_ready_for_audio
  * \brief called by the audio hardware interrupt when a new buffer of audio sample is required.
@@ -102,6 +430,7 @@ void dae_ready_for_audio(uint8_t buffer_idx)
   BaseType_t higher_task_woken = pdFALSE;
 
   active_buffer = buffer_idx;
+  block_count++;
 
   /* Notify the DAE task that it is ready to process audio */
   vTaskNotifyGiveFromISR(dae_task_handle, &higher_task_woken);
@@ -113,29 +442,183 @@ void dae_ready_for_audio(uint8_t buffer_idx)
   }
 }
 
+/**
+ * dae_sample_time
+ * \brief the DAE sample clock, the number of frames output since audio started.
+ * \note this is safe to call from interrupts, it is used to timestamp MIDI events.
+ * \return the sample time, wraps after about a day at 48kHz
+ */
+uint32_t dae_sample_time(void)
+{
+  uint32_t blocks;
+  uint32_t position;
+
+  /* Re-read if a block boundary passed while we were sampling the DMA position */
+  do
+  {
+    blocks = block_count;
+    position = audio_position();
+  } while (blocks != block_count);
+
+  return blocks * DAE_AUDIO_BLOCK_SIZE + position;
+}
+
+/**
+ * dae_block_time
+ * \brief the sample time at which the block being rendered starts to play.
+ * \note for the DAE task, it is on the same clock as dae_sample_time() so
+ *       tempo synced events can be placed sample accurately in the block.
+ */
+uint32_t dae_block_time(void)
+{
+  /* The half-buffer being filled plays once the DMA finishes the other half */
+  return (block_count + 1) * DAE_AUDIO_BLOCK_SIZE;
+}
+
+/**
+ * dae_is_silent
+ * \brief true while the output is nothing but silence, the DMA is replaying zeros
+ *        and a stall of the DAE task (e.g. by a flash erase) cannot be heard.
+ */
+bool dae_is_silent(void)
+{
+  return half_is_silent[PING] && half_is_silent[PONG];
+}
+
+/**
+ * dae_flash_erase
+ * \brief erases a flash sector in a window with no audio and no MIDI input.
+ * \details the erase stalls every flash fetch for a second or more, nothing
+ *          running from flash (tasks, interrupts) makes progress and the MIDI
+ *          receive ring would overrun. The DAE is held once its output is
+ *          silent, the DMA then replays zeros so the stall cannot be heard.
+ *          MIDI input is stopped for the window and what arrives in it is
+ *          dropped, the parser restarts with no running status so nothing
+ *          after the window is misread.
+ * \param address any address in the sector
+ * \return false if the address is not in flash, the erase failed or the output
+ *         did not go silent within DAE_HOLD_TIMEOUT_MS (a held note, a long tail,
+ *         live input), nothing is erased then
+ * \note blocks the calling task until the output is silent, call it from a task
+ *       below the DAE. Before the scheduler starts there is no audio and the
+ *       erase runs at once.
+ */
+bool dae_flash_erase(uint32_t address)
+{
+  bool scheduled = xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED;
+
+  if (scheduled)
+  {
+    xSemaphoreTake(erase_mutex, portMAX_DELAY);
+    atomic_store_explicit(&hold_request, true, memory_order_release);
+
+    for (uint32_t waited = 0; !atomic_load_explicit(&held, memory_order_acquire); waited += HOLD_POLL_MS)
+    {
+      if (waited >= DAE_HOLD_TIMEOUT_MS)
+      {
+        atomic_store_explicit(&hold_request, false, memory_order_release);
+        xSemaphoreGive(erase_mutex);
+        return false;
+      }
+
+      vTaskDelay(pdMS_TO_TICKS(HOLD_POLL_MS));
+    }
+  }
+
+  /* The UART interrupts are off and the DAE is not reading the queue, both ends can be reset */
+  midi_receive(false);
+  midi_parser_init(&midi_parser);
+  midi_queue_init(&midi_queue);
+
+  bool ok = flash_erase(address);
+
+  midi_receive(true);
+
+  if (scheduled)
+  {
+    atomic_store_explicit(&hold_request, false, memory_order_release);
+    atomic_store_explicit(&held, false, memory_order_release);
+    xSemaphoreGive(erase_mutex);
+  }
+
+  return ok;
+}
+
+/**
+ * dae_clock_read
+ * \brief reads the tempo and transport position followed from the MIDI clock input.
+ * \param state receives the clock state, use midi_clock_phase() to get a sample
+ *        accurate beat phase for the block being rendered. The clock reads as
+ *        unlocked once its ticks have stopped for MIDI_CLOCK_TIMEOUT periods.
+ * \note lock-free, this can be called from any task.
+ */
+void dae_clock_read(midi_clock_state_t *state)
+{
+  midi_clock_read(&midi_clock, dae_sample_time(), state);
+}
+
+/**
+ * dae_midi_received
+ * \brief called by the MIDI UART interrupt with each received byte.
+ * \param byte the received byte
+ * \note this is an interrupt handler, it only parses and queues, the events are
+ *       delivered to dae_midi_event() by the DAE task at the next block.
+ */
+void dae_midi_received(uint8_t byte)
+{
+  midi_event_t event;
+
+  if (midi_parse(&midi_parser, byte, &event))
+  {
+    event.timestamp = dae_sample_time();
+    midi_queue_push(&midi_queue, &event);
+  }
+}
+
 /**
  * dae_prepare_to_play
  * \brief called by the DAE when it is starting the audio task.  
  * \param sample_rate the sample rate
  * \param block_size the audio block size for dynamic buffer allocation etc. 
+ * \return true if the engine is ready, false if it could not be prepared (the arena
+ *         is full) and must not be run.
  */
-__attribute__((weak)) void dae_prepare_for_play(float sample_rate, size_t block_size)
+__attribute__((weak)) bool dae_prepare_for_play(float sample_rate, size_t block_size)
 {
   /* Override this in your audio generator */
+  return true;
 }
 
 
 /**
  * dae_process_block()
  * \brief called by the DAE when it requires a new block of samples
+ * \param in_left the left input, captured a block before this one plays, silent if the board has no input
+ * \param in_right the right input
  * \param left the left sample buffer
  * \param right the right sample buffer
  * \param block_size the number of samples required.
+ * \return true if the block holds audio, false if the whole chain is silent (all voices
+ *         and effect tails idle), the buffers need not be written and the DAE outputs
+ *         silence without running the conversion.
  */
-__attribute__((weak)) void dae_process_block(float *left, float *right, size_t block_size)
+__attribute__((weak)) bool dae_process_block(const float *in_left, const float *in_right, float *left, float *right, size_t block_size)
 {
   /* Override this in your audio generator, the default call will generate a 440Hz continuous sine tone */
   generate_test_tone(left, right, block_size);
+
+  return true;
+}
+
+
+/**
+ * dae_midi_event()
+ * \brief called by the DAE task, before dae_process_block(), for each MIDI message received.
+ * \param event the message, timestamp is the dae_sample_time() at which it arrived
+ */
+__attribute__((weak)) void dae_midi_event(const midi_event_t *event)
+{
+  /* Override this in your audio generator */
 }
 
 
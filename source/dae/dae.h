@@ -18,17 +18,67 @@
 #include "dae.h"
 
 #include "trace.h"
+#include "midi.h"
+#include "clock.h"
 
 #define PING (0)
 #define PONG (1)
 
+/* Configuration */
+#ifndef DAE_SAMPLE_RATE
+#define DAE_SAMPLE_RATE (48000)
+#endif
+
+#ifndef DAE_AUDIO_BLOCK_SIZE
+#define DAE_AUDIO_BLOCK_SIZE (128)
+#endif
+
+/*
+  Output word length, 16, 24 or 32 bits. 24 bits is sent in a 32 bit slot.
+  A 16 bit frame is half the DMA transfers and buffer of the others.
+*/
+#ifndef DAE_AUDIO_BITS
+#define DAE_AUDIO_BITS (32)
+#endif
+
+/* Dither for 16 bit output, the longer words have no use for it */
+#define DAE_DITHER_NONE (0)
+#define DAE_DITHER_TPDF (1)
+#define DAE_DITHER_SHAPED (2)
+
+#ifndef DAE_DITHER
+#define DAE_DITHER DAE_DITHER_TPDF
+#endif
+
+/* Longest a flash erase waits for the output to go silent, see dae_flash_erase() */
+#ifndef DAE_HOLD_TIMEOUT_MS
+#define DAE_HOLD_TIMEOUT_MS (2000)
+#endif
+
+/* Engine state allocated by dae_prepare_for_play(), see dae_alloc() */
+#ifndef DAE_ARENA_SIZE
+#define DAE_ARENA_SIZE (80 * 1024)
+#endif
+
+/* CPU cycles available to process one audio block (the per-block deadline), at the rate the codec runs */
+#define DAE_BLOCK_CYCLES(sample_rate) ((uint32_t)(((uint64_t)configCPU_CLOCK_HZ * DAE_AUDIO_BLOCK_SIZE) / (uint32_t)(sample_rate)))
+
 /* API */
 bool dae_start(UBaseType_t priority);
 void dae_ready_for_audio(uint8_t buffer_idx);
+void dae_midi_received(uint8_t byte);
+uint32_t dae_sample_time(void);
+uint32_t dae_block_time(void);
+bool dae_is_silent(void);
+bool dae_flash_erase(uint32_t address);
+void dae_clock_read(midi_clock_state_t *state);
+void *dae_alloc(size_t size);
+size_t dae_arena_peak(void);
 
 
 /* Callback functions */
-void dae_prepare_for_play(float sample_rate, size_t block_size);
-void dae_process_block(float *left, float *right, size_t block_size);
+bool dae_prepare_for_play(float sample_rate, size_t block_size);
+bool dae_process_block(const float *in_left, const float *in_right, float *left, float *right, size_t block_size);
+void dae_midi_event(const midi_event_t *event);
 
 #endif /* DAE_H */
\ No newline at end of file
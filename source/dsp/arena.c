@@ -0,0 +1,64 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "arena.h"
+#include "trace.h"
+
+/**
+ * arena_init
+ * \brief initialises an arena over a block of memory, empty.
+ * \param arena the arena
+ * \param memory the block, ARENA_ALIGN aligned
+ * \param size the size of the block in bytes
+ */
+void arena_init(arena_t *arena, void *memory, size_t size)
+{
+  RTT_ASSERT(arena != NULL);
+  RTT_ASSERT(((uintptr_t)memory & (ARENA_ALIGN - 1)) == 0);
+
+  arena->base = memory;
+  arena->size = size;
+  arena->used = 0;
+}
+
+/**
+ * arena_alloc
+ * \brief allocates from the arena.
+ * \param arena the arena
+ * \param size the size in bytes
+ * \return the memory, ARENA_ALIGN aligned and not cleared, NULL if the arena is full
+ */
+void *arena_alloc(arena_t *arena, size_t size)
+{
+  size_t rounded = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+  /* Both, a size within ARENA_ALIGN of SIZE_MAX rounds to a small one */
+  if (size > arena->size - arena->used || rounded > arena->size - arena->used)
+  {
+    return NULL;
+  }
+
+  size = rounded;
+
+  void *memory = arena->base + arena->used;
+
+  arena->used += size;
+
+  return memory;
+}
+
+/**
+ * arena_peak
+ * \brief the high water mark, the most ever allocated at once.
+ * \param arena the arena
+ * \return the peak in bytes
+ */
+size_t arena_peak(const arena_t *arena)
+{
+  return arena->used;
+}
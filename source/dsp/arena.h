@@ -0,0 +1,42 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Bump allocator over a fixed block of memory, for DSP state that is sized
+  when the engine is prepared rather than at compile time.
+
+  Allocation is a pointer increment and nothing is freed, a new arena_init()
+  starts again from empty. So the peak is simply what is in use, the size
+  the block actually needs.
+  Memory is handed out as is, the init function of the state clears it.
+*/
+
+/* Alignment of every allocation, enough for any scalar the DSP uses */
+#define ARENA_ALIGN (8)
+
+/* Arena instance */
+typedef struct
+{
+  uint8_t *base;
+  size_t size;
+  size_t used;
+} arena_t;
+
+/* API */
+void arena_init(arena_t *arena, void *memory, size_t size);
+void *arena_alloc(arena_t *arena, size_t size);
+size_t arena_peak(const arena_t *arena);
+
+#endif /* ARENA_H */
@@ -0,0 +1,266 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "conv.h"
+#include "trace.h"
+
+/* Private functions */
+static void spectrum_mac(float *restrict acc, const float *restrict x, const float *restrict h, size_t fft_size);
+
+/**
+ * conv_init
+ * \brief initialises a convolver with no IR loaded (output is silence).
+ * \param conv the convolver instance
+ * \param block_size samples per block, the partition size
+ * \return true if success, false if the block size is over CONV_MAX_BLOCK_SIZE
+ *         or twice it is not a supported FFT size
+ */
+bool conv_init(conv_t *conv, size_t block_size)
+{
+  RTT_ASSERT(conv != NULL);
+
+  if (block_size > CONV_MAX_BLOCK_SIZE || !fft_init(&conv->fft, 2 * block_size))
+  {
+    return false;
+  }
+
+  conv->block = block_size;
+  conv->partitions = 0;
+  conv_reset(conv);
+
+  return true;
+}
+
+/**
+ * conv_load
+ * \brief loads an impulse response, typically a const table in flash.
+ * \details The IR is partitioned and each partition transformed into the
+ *          instance, the flash copy is not referenced afterwards. This runs
+ *          a FFT per partition so call it from dae_prepare_for_play() or a
+ *          background task, not from the audio path.
+ * \param conv the convolver instance
+ * \param ir the impulse response samples
+ * \param ir_len number of samples in ir
+ * \param cycle_budget CPU cycles per block the convolver may use, e.g. DAE_BLOCK_CYCLES(rate) / 4
+ * \return the number of IR samples actually used after truncation to the budget
+ */
+size_t conv_load(conv_t *conv, const float *ir, size_t ir_len, uint32_t cycle_budget)
+{
+  RTT_ASSERT(conv != NULL);
+  RTT_ASSERT(ir != NULL || ir_len == 0);
+
+  const size_t block = conv->block;
+  size_t partitions = (ir_len + block - 1) / block;
+  size_t limit = conv_max_partitions(cycle_budget);
+
+  if (partitions > limit)
+  {
+    partitions = limit;
+    ir_len = partitions * block;
+  }
+
+  /*
+    Each partition is zero padded to the FFT size, the padding goes at the end
+    so the overlap-save output is the second half of the inverse transform.
+  */
+  for (size_t p = 0; p < partitions; p++)
+  {
+    size_t offset = p * block;
+    size_t count = ir_len - offset < block ? ir_len - offset : block;
+
+    memset(conv->ir[p], 0, sizeof(conv->ir[p]));
+    memcpy(conv->ir[p], &ir[offset], count * sizeof(float));
+    fft_forward(&conv->fft, conv->ir[p]);
+  }
+
+  conv->partitions = partitions;
+  conv_reset(conv);
+
+  return ir_len;
+}
+
+/**
+ * conv_reset
+ * \brief clears the input history so the IR tail does not ring on.
+ * \param conv the convolver instance
+ */
+void conv_reset(conv_t *conv)
+{
+  RTT_ASSERT(conv != NULL);
+
+  memset(conv->input, 0, sizeof(conv->input));
+  memset(conv->fdl, 0, sizeof(conv->fdl));
+  conv->head = 0;
+  conv->quiet = conv->partitions + 1;
+}
+
+/**
+ * conv_process
+ * \brief convolves one block of the size given to conv_init().
+ * \param conv the convolver instance
+ * \param in input samples
+ * \param out output samples, may be the same buffer as in
+ */
+void conv_process(conv_t *conv, const float *in, float *out)
+{
+  RTT_ASSERT(conv != NULL);
+  RTT_ASSERT(in != NULL);
+  RTT_ASSERT(out != NULL);
+
+  const size_t block = conv->block;
+
+  /* Idle, the history is all silence so the output is too */
+  bool silent = silence_detect(in, block);
+  if (conv->partitions == 0 || (silent && conv_is_idle(conv)))
+  {
+    memset(out, 0, block * sizeof(float));
+    return;
+  }
+
+  conv->quiet = silent ? conv->quiet + 1 : 0;
+
+  /* Slide the input window, the second half is the new block */
+  memcpy(conv->input, &conv->input[block], block * sizeof(float));
+  memcpy(&conv->input[block], in, block * sizeof(float));
+
+  /* Newest input spectrum goes to the head of the FDL */
+  conv->head = conv->head == 0 ? conv->partitions - 1 : conv->head - 1;
+  float *x = conv->fdl[conv->head];
+  memcpy(x, conv->input, 2 * block * sizeof(float));
+  fft_forward(&conv->fft, x);
+
+  /* Partition p is applied to the input spectrum from p blocks ago */
+  memset(conv->work, 0, 2 * block * sizeof(float));
+  size_t slot = conv->head;
+  for (size_t p = 0; p < conv->partitions; p++)
+  {
+    spectrum_mac(conv->work, conv->fdl[slot], conv->ir[p], 2 * block);
+    slot = slot + 1 == conv->partitions ? 0 : slot + 1;
+  }
+
+  /* Overlap-save, the first half of the result is circular wrap and is discarded */
+  fft_inverse(&conv->fft, conv->work);
+  memcpy(out, &conv->work[block], block * sizeof(float));
+
+  /* The tail has run out, clear the sub-threshold residue so we resume from a clean state */
+  if (conv_is_idle(conv))
+  {
+    conv_reset(conv);
+  }
+}
+
+/**
+ * conv_is_idle
+ * \brief true once the input has been silent for longer than the IR.
+ * \param conv the convolver instance
+ */
+bool conv_is_idle(const conv_t *conv)
+{
+  RTT_ASSERT(conv != NULL);
+
+  return conv->quiet > conv->partitions;
+}
+
+/**
+ * conv_cost_cycles
+ * \brief estimated cycles per block for the given number of partitions.
+ * \param partitions number of IR partitions
+ * \return the cycle estimate
+ */
+uint32_t conv_cost_cycles(size_t partitions)
+{
+  return CONV_FIXED_CYCLES + (uint32_t)partitions * CONV_PARTITION_CYCLES;
+}
+
+/**
+ * conv_max_partitions
+ * \brief the number of partitions that fit a cycle budget and the static storage.
+ * \param cycle_budget CPU cycles per block the convolver may use
+ * \return the partition count, may be zero if the budget is too small for the FFTs
+ */
+size_t conv_max_partitions(uint32_t cycle_budget)
+{
+  if (cycle_budget <= CONV_FIXED_CYCLES)
+  {
+    return 0;
+  }
+
+  size_t partitions = (cycle_budget - CONV_FIXED_CYCLES) / CONV_PARTITION_CYCLES;
+
+  return partitions > CONV_MAX_PARTITIONS ? CONV_MAX_PARTITIONS : partitions;
+}
+
+/**
+ * spectrum_mac
+ * \brief acc += x * h for spectra in the packed fft.h layout.
+ * \param acc accumulator spectrum
+ * \param x input spectrum
+ * \param h IR partition spectrum
+ * \param fft_size the transform size
+ */
+static void spectrum_mac(float *restrict acc, const float *restrict x, const float *restrict h, size_t fft_size)
+{
+  /* DC and Nyquist are real */
+  acc[0] += x[0] * h[0];
+  acc[1] += x[1] * h[1];
+
+#pragma GCC unroll 4
+  for (size_t i = 2; i < fft_size; i += 2)
+  {
+    acc[i] += x[i] * h[i] - x[i + 1] * h[i + 1];
+    acc[i + 1] += x[i] * h[i + 1] + x[i + 1] * h[i];
+  }
+}
+
+/**
+ * conv_benchmark
+ * \brief measures the fixed and per-partition cost, results go to RTT.
+ * \param conv a convolver instance, it is reset and left with no IR loaded
+ * \param block_size samples per block
+ * \note only available in RTT builds, use the results for CONV_FIXED_CYCLES
+ *       and CONV_PARTITION_CYCLES.
+ */
+void conv_benchmark(conv_t *conv, size_t block_size)
+{
+#ifdef RTT_ENABLED
+  RTT_ASSERT(conv != NULL);
+
+  conv_init(conv, block_size);
+
+  /* Any data will do, the cost does not depend on the values */
+  memset(conv->ir, 0, sizeof(conv->ir));
+  conv->partitions = CONV_MAX_PARTITIONS;
+
+  DWT_INIT();
+
+  RTT_LOG("%sConvolution block %u, %u partitions\n", RTT_CTRL_TEXT_BRIGHT_CYAN, (unsigned)block_size, CONV_MAX_PARTITIONS);
+
+  DWT_START();
+  fft_forward(&conv->fft, conv->work);
+  fft_inverse(&conv->fft, conv->work);
+  DWT_OUTPUT("conv fixed (2 x fft)");
+
+  DWT_START();
+  spectrum_mac(conv->work, conv->fdl[0], conv->ir[0], 2 * block_size);
+  DWT_OUTPUT("conv per partition");
+
+  /* Non-silent input so the idle bypass does not kick in */
+  for (size_t i = 0; i < block_size; i++)
+  {
+    conv->work[i] = 0.5f;
+  }
+
+  DWT_START();
+  conv_process(conv, conv->work, conv->work);
+  DWT_OUTPUT("conv_process");
+
+  conv->partitions = 0;
+#endif
+}
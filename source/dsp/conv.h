@@ -0,0 +1,93 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef CONV_H
+#define CONV_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fft.h"
+#include "silence.h"
+
+/*
+  Uniformly partitioned overlap-save convolution (UPOLS) for long impulse
+  responses such as guitar cabinets and instrument bodies.
+
+  The IR is split into partitions of one block of B samples, B being the block
+  size given to conv_init(), normally the DAE block. Each is held as the
+  spectrum of a 2B point FFT. Every block costs one forward and one inverse
+  FFT plus a complex multiply-accumulate per partition against a frequency
+  domain delay line (FDL) of past input spectra. Latency is zero beyond the
+  DAE block itself.
+
+  Once the input has been silent for longer than the IR the output is silent
+  too, the convolver then goes idle and skips the FFTs until the input returns.
+
+  Cost model per block (cycles):
+
+    conv_cost_cycles(p) = CONV_FIXED_CYCLES + p * CONV_PARTITION_CYCLES
+
+  The defaults below are conservative estimates for a 128 sample block on the
+  F411 at 100MHz, run conv_benchmark() on the target to calibrate them. The IR
+  is truncated at load time so the cost fits the budget given to conv_load().
+
+  The synth's body stage is an instance, allocated from the DAE arena. At the
+  defaults it is about 18KB and takes an IR of up to 1024 samples.
+*/
+
+/* Largest block size, the storage is sized for it */
+#ifndef CONV_MAX_BLOCK_SIZE
+#define CONV_MAX_BLOCK_SIZE (128)
+#endif
+
+#define CONV_MAX_FFT_SIZE (2 * CONV_MAX_BLOCK_SIZE)
+
+/* Storage is static, each partition costs 2 x CONV_MAX_FFT_SIZE floats of RAM */
+#ifndef CONV_MAX_PARTITIONS
+#define CONV_MAX_PARTITIONS (8)
+#endif
+
+/* Forward + inverse FFT and the overlap-save copy */
+#ifndef CONV_FIXED_CYCLES
+#define CONV_FIXED_CYCLES (20000)
+#endif
+
+/* Complex multiply-accumulate of B + 1 bins */
+#ifndef CONV_PARTITION_CYCLES
+#define CONV_PARTITION_CYCLES (1200)
+#endif
+
+/* Convolver instance, large so declare it static */
+typedef struct
+{
+  fft_t fft;
+  size_t block;      /* Block size B */
+  size_t partitions; /* Number of IR partitions in use */
+  size_t head;       /* FDL slot holding the newest input spectrum */
+  size_t quiet;      /* Consecutive silent input blocks, idle once past partitions */
+  float input[CONV_MAX_FFT_SIZE];
+  float work[CONV_MAX_FFT_SIZE];
+  float ir[CONV_MAX_PARTITIONS][CONV_MAX_FFT_SIZE];
+  float fdl[CONV_MAX_PARTITIONS][CONV_MAX_FFT_SIZE];
+} conv_t;
+
+/* API */
+bool conv_init(conv_t *conv, size_t block_size);
+size_t conv_load(conv_t *conv, const float *ir, size_t ir_len, uint32_t cycle_budget);
+void conv_reset(conv_t *conv);
+void conv_process(conv_t *conv, const float *in, float *out);
+bool conv_is_idle(const conv_t *conv);
+
+uint32_t conv_cost_cycles(size_t partitions);
+size_t conv_max_partitions(uint32_t cycle_budget);
+
+void conv_benchmark(conv_t *conv, size_t block_size);
+
+#endif /* CONV_H */
@@ -0,0 +1,123 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "dae.h"
+#include "delay.h"
+#include "sections.h"
+#include "trace.h"
+
+static_assert((DELAY_MAX_SAMPLES & (DELAY_MAX_SAMPLES - 1)) == 0, "DELAY_MAX_SAMPLES must be a power of 2");
+
+#define DELAY_MASK (DELAY_MAX_SAMPLES - 1)
+
+/* Line sample scaling */
+#define DELAY_SCALE (32767.0f)
+
+/* Time glide per sample, a fraction of the remaining distance */
+#define DELAY_GLIDE (0.0005f)
+
+/* Wet signal of the block being processed */
+static float wet[DAE_AUDIO_BLOCK_SIZE];
+
+/**
+ * delay_init
+ * \brief initialises the delay, silent and idle.
+ * \param delay the delay
+ * \param time the delay in samples
+ * \param feedback the feedback 0-1
+ */
+void delay_init(delay_t *delay, float time, float feedback)
+{
+  RTT_ASSERT(delay != NULL);
+
+  delay->feedback = fminf(fmaxf(feedback, 0.0f), 0.95f);
+  delay->write = 0;
+  delay_set_time(delay, time);
+  delay->time = delay->target;
+  memset(delay->line, 0, sizeof(delay->line));
+
+  /* A gap in the line as long as the delay can be quiet before the next repeat */
+  silence_tail_init(&delay->tail, DELAY_MAX_SAMPLES / DAE_AUDIO_BLOCK_SIZE + 1);
+}
+
+/**
+ * delay_set_time
+ * \brief sets the delay, the line glides to it.
+ * \param delay the delay
+ * \param time the delay in samples, limited to DELAY_MAX_SAMPLES
+ */
+void delay_set_time(delay_t *delay, float time)
+{
+  delay->target = fminf(fmaxf(time, 1.0f), (float)(DELAY_MAX_SAMPLES - 2));
+}
+
+/**
+ * delay_process
+ * \brief delays a block of the send bus, adding into the output.
+ * \param delay the delay
+ * \param in the send bus
+ * \param out the output, accumulated into
+ * \param n the number of samples
+ */
+RAMFUNC void delay_process(delay_t *delay, const float *restrict in, float *restrict out, size_t n)
+{
+  RTT_ASSERT(n <= DAE_AUDIO_BLOCK_SIZE);
+
+  bool input_silent = silence_detect(in, n);
+
+  if (!silence_tail_input(&delay->tail, input_silent))
+  {
+    return;
+  }
+
+  float time = delay->time;
+  uint32_t write = delay->write;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    time += (delay->target - time) * DELAY_GLIDE;
+
+    /* Linear interpolation between the two samples either side of the tap */
+    float position = (float)write - time;
+    float whole = floorf(position);
+    float frac = position - whole;
+    uint32_t tap = (uint32_t)(int32_t)whole;
+    float a = (float)delay->line[tap & DELAY_MASK];
+    float b = (float)delay->line[(tap + 1) & DELAY_MASK];
+    float delayed = (a + (b - a) * frac) * (1.0f / DELAY_SCALE);
+
+    float x = fminf(fmaxf(in[i] + delayed * delay->feedback, -1.0f), 1.0f);
+    delay->line[write & DELAY_MASK] = (int16_t)(x * DELAY_SCALE);
+
+    wet[i] = delayed;
+    out[i] += delayed;
+    write++;
+  }
+
+  delay->time = time;
+  delay->write = write;
+
+  if (silence_tail_output(&delay->tail, input_silent, wet, n))
+  {
+    memset(delay->line, 0, sizeof(delay->line));
+  }
+}
+
+/**
+ * delay_is_idle
+ * \brief true while the delay is bypassed, its input and tail are silent.
+ * \param delay the delay
+ */
+bool delay_is_idle(const delay_t *delay)
+{
+  return delay->tail.idle;
+}
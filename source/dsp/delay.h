@@ -0,0 +1,55 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef DELAY_H
+#define DELAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "silence.h"
+
+/*
+  Mono feedback delay for the send bus, computed once per block for all the
+  parts that send to it.
+
+  The line holds 16 bit samples to halve its RAM, their noise floor is far
+  below the feedback path's own loss. The time is set in samples, the synth
+  sets it from the tempo, and changes glide to the new time a sample at a
+  time. Like the reverb it goes idle once its input and tail are silent.
+*/
+
+/* Longest delay in samples, 341ms at 48kHz, must be a power of 2 */
+#ifndef DELAY_MAX_SAMPLES
+#define DELAY_MAX_SAMPLES (16384)
+#endif
+
+/* Estimated cost of a 128 sample block on the F411 */
+#ifndef DELAY_CYCLES
+#define DELAY_CYCLES (2500)
+#endif
+
+/* Delay instance, large so declare it static */
+typedef struct
+{
+  float time;                       /* Current delay in samples, glides to target */
+  float target;
+  float feedback;
+  uint32_t write;                   /* Write position */
+  silence_tail_t tail;
+  int16_t line[DELAY_MAX_SAMPLES];
+} delay_t;
+
+/* API */
+void delay_init(delay_t *delay, float time, float feedback);
+void delay_set_time(delay_t *delay, float time);
+void delay_process(delay_t *delay, const float *restrict in, float *restrict out, size_t n);
+bool delay_is_idle(const delay_t *delay);
+
+#endif /* DELAY_H */
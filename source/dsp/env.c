@@ -0,0 +1,260 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+
+#include "env.h"
+#include "sections.h"
+#include "trace.h"
+
+/* Private functions */
+static env_segment_t segment_coefs(float time, float sample_rate, float target, float ratio);
+static size_t segment_run(float *restrict out, size_t n, float *level, env_segment_t seg, float end, bool rising);
+static void fill(float *restrict out, size_t n, float value);
+
+/**
+ * env_init
+ * \brief initialises an envelope to idle with default times.
+ * \param env the envelope
+ * \param sample_rate the sample rate
+ * \param mode retrigger or legato behaviour
+ */
+void env_init(env_t *env, float sample_rate, env_mode_t mode)
+{
+  RTT_ASSERT(env != NULL);
+  RTT_ASSERT(sample_rate > 0.0f);
+
+  env->sample_rate = sample_rate;
+  env->mode = mode;
+  env_reset(env);
+  env_set_adsr(env, 0.01f, 0.1f, 0.7f, 0.2f);
+}
+
+/**
+ * env_set_adsr
+ * \brief sets the envelope parameters, safe to call while the envelope is running.
+ * \param env the envelope
+ * \param attack attack time in seconds (0 to 1)
+ * \param decay decay time in seconds (1 to 0)
+ * \param sustain sustain level 0 to 1
+ * \param release release time in seconds (1 to 0)
+ * \note this is where the expf() calls are, call it on parameter changes only.
+ */
+void env_set_adsr(env_t *env, float attack, float decay, float sustain, float release)
+{
+  RTT_ASSERT(env != NULL);
+
+  sustain = fminf(fmaxf(sustain, 0.0f), 1.0f);
+
+  env->attack = segment_coefs(attack, env->sample_rate, 1.0f + ENV_ATTACK_RATIO, ENV_ATTACK_RATIO);
+  env->decay = segment_coefs(decay, env->sample_rate, sustain - ENV_DECAY_RATIO, ENV_DECAY_RATIO);
+  env->release = segment_coefs(release, env->sample_rate, -ENV_DECAY_RATIO, ENV_DECAY_RATIO);
+  env->sustain = sustain;
+
+  if (env->stage == ENV_SUSTAIN)
+  {
+    env->level = sustain;
+  }
+}
+
+/**
+ * env_copy_adsr
+ * \brief sets the envelope parameters from another envelope, without the expf() calls.
+ * \param env the envelope
+ * \param from an envelope at the same sample rate, only its parameters are read
+ */
+void env_copy_adsr(env_t *env, const env_t *from)
+{
+  RTT_ASSERT(env != NULL && from != NULL);
+
+  env->attack = from->attack;
+  env->decay = from->decay;
+  env->release = from->release;
+  env->sustain = from->sustain;
+
+  if (env->stage == ENV_SUSTAIN)
+  {
+    env->level = env->sustain;
+  }
+}
+
+/**
+ * env_gate_on
+ * \brief note on, starts (or in legato mode continues) the envelope.
+ * \param env the envelope
+ */
+void env_gate_on(env_t *env)
+{
+  RTT_ASSERT(env != NULL);
+
+  if (env->mode == ENV_LEGATO && env->stage != ENV_IDLE && env->stage != ENV_RELEASE)
+  {
+    return;
+  }
+
+  /* The attack starts from the current level so a retrigger does not click */
+  env->stage = ENV_ATTACK;
+}
+
+/**
+ * env_gate_off
+ * \brief note off, moves the envelope to its release stage.
+ * \param env the envelope
+ */
+void env_gate_off(env_t *env)
+{
+  RTT_ASSERT(env != NULL);
+
+  if (env->stage != ENV_IDLE)
+  {
+    env->stage = ENV_RELEASE;
+  }
+}
+
+/**
+ * env_reset
+ * \brief forces the envelope to idle with zero output, e.g. when a voice is stolen.
+ * \param env the envelope
+ */
+void env_reset(env_t *env)
+{
+  RTT_ASSERT(env != NULL);
+
+  env->stage = ENV_IDLE;
+  env->level = 0.0f;
+}
+
+/**
+ * env_process
+ * \brief renders a block of envelope output.
+ * \param env the envelope
+ * \param out the output buffer
+ * \param n the number of samples
+ * \return true if the whole block is constant at env->level (sustain or idle),
+ *         the caller may then apply it as a scalar gain.
+ */
+RAMFUNC bool env_process(env_t *env, float *restrict out, size_t n)
+{
+  RTT_ASSERT(env != NULL);
+  RTT_ASSERT(out != NULL);
+
+  /* Block-constant fast path */
+  if (env->stage == ENV_IDLE || env->stage == ENV_SUSTAIN)
+  {
+    fill(out, n, env->level);
+    return true;
+  }
+
+  size_t i = 0;
+
+  if (env->stage == ENV_ATTACK)
+  {
+    i += segment_run(&out[i], n - i, &env->level, env->attack, 1.0f, true);
+    if (env->level >= 1.0f)
+    {
+      env->stage = ENV_DECAY;
+    }
+  }
+
+  if (env->stage == ENV_DECAY)
+  {
+    i += segment_run(&out[i], n - i, &env->level, env->decay, env->sustain, false);
+    if (env->level <= env->sustain)
+    {
+      env->stage = ENV_SUSTAIN;
+    }
+  }
+
+  if (env->stage == ENV_RELEASE)
+  {
+    i += segment_run(&out[i], n - i, &env->level, env->release, 0.0f, false);
+    if (env->level <= 0.0f)
+    {
+      env->stage = ENV_IDLE;
+    }
+  }
+
+  /* A segment finished early, the rest of the block is sustain or idle */
+  fill(&out[i], n - i, env->level);
+
+  return false;
+}
+
+/**
+ * segment_coefs
+ * \brief calculates the recursion for a segment.
+ * \param time the segment time in seconds
+ * \param sample_rate the sample rate
+ * \param target the level the segment heads for, past the segment end by ratio
+ * \param ratio overshoot of the target, sets the curvature
+ * \return the segment coefficients
+ */
+static env_segment_t segment_coefs(float time, float sample_rate, float target, float ratio)
+{
+  float samples = time * sample_rate;
+
+  /* Shorter than a sample, jump straight to the target */
+  if (samples < 1.0f)
+  {
+    return (env_segment_t){.coef = 0.0f, .base = target};
+  }
+
+  float coef = expf(-logf((1.0f + ratio) / ratio) / samples);
+
+  return (env_segment_t){.coef = coef, .base = target * (1.0f - coef)};
+}
+
+/**
+ * segment_run
+ * \brief runs a segment until its end level or the end of the buffer.
+ * \param out the output buffer
+ * \param n the number of samples available
+ * \param level current level, updated
+ * \param seg the segment recursion
+ * \param end the level at which the segment ends
+ * \param rising true if the segment moves upwards
+ * \return the number of samples written
+ */
+RAMFUNC static size_t segment_run(float *restrict out, size_t n, float *level, env_segment_t seg, float end, bool rising)
+{
+  float y = *level;
+  size_t i = 0;
+
+  while (i < n)
+  {
+    y = y * seg.coef + seg.base;
+
+    if (rising ? (y >= end) : (y <= end))
+    {
+      y = end;
+      out[i++] = y;
+      break;
+    }
+
+    out[i++] = y;
+  }
+
+  *level = y;
+  return i;
+}
+
+/**
+ * fill
+ * \brief sets a buffer to a constant.
+ * \param out the output buffer
+ * \param n the number of samples
+ * \param value the value to fill with
+ */
+RAMFUNC static void fill(float *restrict out, size_t n, float value)
+{
+#pragma GCC unroll 4
+  for (size_t i = 0; i < n; i++)
+  {
+    out[i] = value;
+  }
+}
@@ -0,0 +1,91 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef ENV_H
+#define ENV_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+  ADSR envelope generator with exponential segments.
+
+  Each segment is a one-pole recursion y = y.coef + base (one multiply-add
+  per sample) heading for a target just past the segment end, so it reaches
+  the end in the set time and then switches stage. expf() is only used when
+  the parameters change, never on the audio path.
+
+  Sustain and idle stages are block-constant, env_process() fills the block
+  without running the recursion and reports it so the caller can use a
+  scalar gain. A voice whose amplitude envelope is idle is silent and can
+  skip rendering altogether (env_is_idle()).
+*/
+
+/* Segment shape, smaller is more exponential, larger is closer to linear */
+#define ENV_ATTACK_RATIO (0.3f)
+#define ENV_DECAY_RATIO (0.0001f)
+
+/* Envelope stages */
+typedef enum
+{
+  ENV_IDLE,
+  ENV_ATTACK,
+  ENV_DECAY,
+  ENV_SUSTAIN,
+  ENV_RELEASE,
+} env_stage_t;
+
+/* Behaviour on a gate while the envelope is already running */
+typedef enum
+{
+  ENV_RETRIGGER, /* Restart the attack from the current level */
+  ENV_LEGATO,    /* Carry on, only a gate from idle or release starts the attack */
+} env_mode_t;
+
+/* Recursion coefficients for one segment */
+typedef struct
+{
+  float coef;
+  float base;
+} env_segment_t;
+
+/* Envelope instance */
+typedef struct
+{
+  env_stage_t stage;
+  env_mode_t mode;
+  float level;
+  float sustain;
+  float sample_rate;
+  env_segment_t attack;
+  env_segment_t decay;
+  env_segment_t release;
+} env_t;
+
+/* API */
+void env_init(env_t *env, float sample_rate, env_mode_t mode);
+void env_set_adsr(env_t *env, float attack, float decay, float sustain, float release);
+void env_copy_adsr(env_t *env, const env_t *from);
+
+void env_gate_on(env_t *env);
+void env_gate_off(env_t *env);
+void env_reset(env_t *env);
+
+bool env_process(env_t *env, float *restrict out, size_t n);
+
+/**
+ * env_is_idle
+ * \brief true if the envelope has finished and its output is zero.
+ * \param env the envelope
+ */
+static inline bool env_is_idle(const env_t *env)
+{
+  return env->stage == ENV_IDLE;
+}
+
+#endif /* ENV_H */
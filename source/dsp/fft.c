@@ -0,0 +1,484 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "fft.h"
+#include "trace.h"
+
+/* Log2 of the largest complex transform, used to scale the bit reversal table */
+#define FFT_BITREV_BITS (10)
+
+/* Private functions */
+static inline int32_t rshift(int32_t value, int shift);
+static void cfft_f32(float *restrict x, size_t m);
+static void cfft_q15(int16_t *restrict x, size_t m, bool scale);
+static void bitrev_f32(const fft_t *fft, float *restrict x);
+static void bitrev_q15(const fft_t *fft, int16_t *restrict x);
+
+/**
+ * fft_init
+ * \brief sets up a transform instance for the given size.
+ * \param fft the instance to initialise
+ * \param size the real transform length, a power of 2 from FFT_MIN_SIZE to FFT_MAX_SIZE
+ * \return true if the size is supported, false otherwise
+ */
+bool fft_init(fft_t *fft, size_t size)
+{
+  RTT_ASSERT(fft != NULL);
+
+  if (size < FFT_MIN_SIZE || size > FFT_MAX_SIZE || (size & (size - 1)) != 0)
+  {
+    return false;
+  }
+
+  uint32_t log2_half = 0;
+  while ((2u << log2_half) < size)
+  {
+    log2_half++;
+  }
+
+  fft->size = size;
+  fft->half = size / 2;
+  fft->stride = FFT_MAX_SIZE / size;
+  fft->bitrev_shift = FFT_BITREV_BITS - log2_half;
+
+  return true;
+}
+
+/**
+ * fft_forward
+ * \brief in-place real forward FFT.
+ * \param fft the transform instance
+ * \param buf N real samples in, packed N/2+1 bin spectrum out (see fft.h)
+ */
+void fft_forward(const fft_t *fft, float *buf)
+{
+  RTT_ASSERT(fft != NULL);
+  RTT_ASSERT(buf != NULL);
+
+  const size_t m = fft->half;
+
+  /* The real input is treated as m complex values z[n] = x[2n] + j.x[2n+1] */
+  cfft_f32(buf, m);
+  bitrev_f32(fft, buf);
+
+  /* DC and Nyquist are both real so share the first bin */
+  float zr = buf[0];
+  float zi = buf[1];
+  buf[0] = zr + zi;
+  buf[1] = zr - zi;
+
+  /* Split Z[k] into the spectra of the even and odd samples and recombine */
+  for (size_t k = 1; k <= m / 2; k++)
+  {
+    const float *w = &fft_twiddle_f32[2 * k * fft->stride];
+    float *a = &buf[2 * k];
+    float *b = &buf[2 * (m - k)];
+
+    float er = 0.5f * (a[0] + b[0]);
+    float ei = 0.5f * (a[1] - b[1]);
+    float odr = 0.5f * (a[1] + b[1]);
+    float odi = -0.5f * (a[0] - b[0]);
+
+    float tr = w[0] * odr + w[1] * odi;
+    float ti = w[0] * odi - w[1] * odr;
+
+    a[0] = er + tr;
+    a[1] = ei + ti;
+    b[0] = er - tr;
+    b[1] = ti - ei;
+  }
+}
+
+/**
+ * fft_inverse
+ * \brief in-place real inverse FFT, scaled by 1/N.
+ * \param fft the transform instance
+ * \param buf packed spectrum in (see fft.h), N real samples out
+ */
+void fft_inverse(const fft_t *fft, float *buf)
+{
+  RTT_ASSERT(fft != NULL);
+  RTT_ASSERT(buf != NULL);
+
+  const size_t m = fft->half;
+
+  float x0 = buf[0];
+  float xm = buf[1];
+  buf[0] = 0.5f * (x0 + xm);
+  buf[1] = -0.5f * (x0 - xm);
+
+  /*
+    Rebuild Z[k] from the even/odd spectra, the result is conjugated so the
+    forward complex transform computes the inverse.
+  */
+  for (size_t k = 1; k <= m / 2; k++)
+  {
+    const float *w = &fft_twiddle_f32[2 * k * fft->stride];
+    float *a = &buf[2 * k];
+    float *b = &buf[2 * (m - k)];
+
+    float er = 0.5f * (a[0] + b[0]);
+    float ei = 0.5f * (a[1] - b[1]);
+    float dr = 0.5f * (a[0] - b[0]);
+    float di = 0.5f * (a[1] + b[1]);
+
+    float odr = dr * w[0] - di * w[1];
+    float odi = dr * w[1] + di * w[0];
+
+    a[0] = er - odi;
+    a[1] = -(ei + odr);
+    b[0] = er + odi;
+    b[1] = ei - odr;
+  }
+
+  cfft_f32(buf, m);
+  bitrev_f32(fft, buf);
+
+  /* Undo the conjugation and apply the 1/N scaling (1/m of the complex transform) */
+  const float scale = 1.0f / (float)m;
+  for (size_t i = 0; i < 2 * m; i += 2)
+  {
+    buf[i] *= scale;
+    buf[i + 1] *= -scale;
+  }
+}
+
+/**
+ * fft_forward_q15
+ * \brief in-place real forward FFT in Q15, scaled by 1/N.
+ * \param fft the transform instance
+ * \param buf N real samples in, packed N/2+1 bin spectrum out (see fft.h)
+ */
+void fft_forward_q15(const fft_t *fft, int16_t *buf)
+{
+  RTT_ASSERT(fft != NULL);
+  RTT_ASSERT(buf != NULL);
+
+  const size_t m = fft->half;
+
+  /* Scaled complex transform, the split below contributes the final 1/2 */
+  cfft_q15(buf, m, true);
+  bitrev_q15(fft, buf);
+
+  int32_t zr = buf[0];
+  int32_t zi = buf[1];
+  buf[0] = (int16_t)rshift(zr + zi, 1);
+  buf[1] = (int16_t)rshift(zr - zi, 1);
+
+  for (size_t k = 1; k <= m / 2; k++)
+  {
+    const int16_t *w = &fft_twiddle_q15[2 * k * fft->stride];
+    int16_t *a = &buf[2 * k];
+    int16_t *b = &buf[2 * (m - k)];
+
+    /* The even/odd halving and the final 1/2 of the 1/N scaling are combined */
+    int32_t er = rshift(a[0] + b[0], 2);
+    int32_t ei = rshift(a[1] - b[1], 2);
+    int32_t odr = rshift(a[1] + b[1], 2);
+    int32_t odi = rshift(b[0] - a[0], 2);
+
+    int32_t tr = rshift(w[0] * odr + w[1] * odi, 15);
+    int32_t ti = rshift(w[0] * odi - w[1] * odr, 15);
+
+    a[0] = (int16_t)__SSAT(er + tr, 16);
+    a[1] = (int16_t)__SSAT(ei + ti, 16);
+    b[0] = (int16_t)__SSAT(er - tr, 16);
+    b[1] = (int16_t)__SSAT(ti - ei, 16);
+  }
+}
+
+/**
+ * fft_inverse_q15
+ * \brief in-place real inverse FFT in Q15, unscaled and saturating.
+ * \param fft the transform instance
+ * \param buf packed spectrum as produced by fft_forward_q15, N real samples out
+ */
+void fft_inverse_q15(const fft_t *fft, int16_t *buf)
+{
+  RTT_ASSERT(fft != NULL);
+  RTT_ASSERT(buf != NULL);
+
+  const size_t m = fft->half;
+
+  /* The forward transform was scaled by 1/N, the missing factor of 2 is restored here */
+  int32_t x0 = buf[0];
+  int32_t xm = buf[1];
+  buf[0] = (int16_t)__SSAT(x0 + xm, 16);
+  buf[1] = (int16_t)__SSAT(xm - x0, 16);
+
+  for (size_t k = 1; k <= m / 2; k++)
+  {
+    const int16_t *w = &fft_twiddle_q15[2 * k * fft->stride];
+    int16_t *a = &buf[2 * k];
+    int16_t *b = &buf[2 * (m - k)];
+
+    int32_t er = a[0] + b[0];
+    int32_t ei = a[1] - b[1];
+    int32_t dr = a[0] - b[0];
+    int32_t di = a[1] + b[1];
+
+    /* dr and di can span 17 bits, halve them so the products stay within 32 bits */
+    int32_t odr = rshift((dr >> 1) * w[0] - (di >> 1) * w[1], 14);
+    int32_t odi = rshift((dr >> 1) * w[1] + (di >> 1) * w[0], 14);
+
+    a[0] = (int16_t)__SSAT(er - odi, 16);
+    a[1] = (int16_t)__SSAT(-(ei + odr), 16);
+    b[0] = (int16_t)__SSAT(er + odi, 16);
+    b[1] = (int16_t)__SSAT(ei - odr, 16);
+  }
+
+  cfft_q15(buf, m, false);
+  bitrev_q15(fft, buf);
+
+  for (size_t i = 1; i < 2 * m; i += 2)
+  {
+    buf[i] = (int16_t)__SSAT(-buf[i], 16);
+  }
+}
+
+/**
+ * cfft_f32
+ * \brief in-place complex decimation-in-frequency FFT, output in bit reversed order.
+ * \details Each pass fuses two radix-2 stages into a radix-2^2 butterfly so it has
+ *          the load/store count and twiddles of radix-4 but keeps plain bit reversed
+ *          output ordering. An odd number of stages is finished with a radix-2 pass.
+ * \param x interleaved complex data
+ * \param m number of complex points
+ */
+static void cfft_f32(float *restrict x, size_t m)
+{
+  size_t l = m;
+
+  for (; l >= 4; l >>= 2)
+  {
+    const size_t q = l / 4;
+    const size_t step = FFT_MAX_SIZE / l;
+
+    for (size_t k = 0; k < q; k++)
+    {
+      const float *w1 = &fft_twiddle_f32[2 * k * step];
+      const float *w2 = &fft_twiddle_f32[4 * k * step];
+      const float *w3 = &fft_twiddle_f32[6 * k * step];
+
+      for (size_t j = 2 * k; j < 2 * m; j += 2 * l)
+      {
+        float *p0 = &x[j];
+        float *p1 = p0 + 2 * q;
+        float *p2 = p1 + 2 * q;
+        float *p3 = p2 + 2 * q;
+
+        float s02r = p0[0] + p2[0], s02i = p0[1] + p2[1];
+        float d02r = p0[0] - p2[0], d02i = p0[1] - p2[1];
+        float s13r = p1[0] + p3[0], s13i = p1[1] + p3[1];
+        float d13r = p1[0] - p3[0], d13i = p1[1] - p3[1];
+
+        float t1r = s02r - s13r, t1i = s02i - s13i;
+        float t2r = d02r + d13i, t2i = d02i - d13r;
+        float t3r = d02r - d13i, t3i = d02i + d13r;
+
+        p0[0] = s02r + s13r;
+        p0[1] = s02i + s13i;
+        p1[0] = t1r * w2[0] + t1i * w2[1];
+        p1[1] = t1i * w2[0] - t1r * w2[1];
+        p2[0] = t2r * w1[0] + t2i * w1[1];
+        p2[1] = t2i * w1[0] - t2r * w1[1];
+        p3[0] = t3r * w3[0] + t3i * w3[1];
+        p3[1] = t3i * w3[0] - t3r * w3[1];
+      }
+    }
+  }
+
+  if (l == 2)
+  {
+    for (size_t j = 0; j < 2 * m; j += 4)
+    {
+      float ar = x[j], ai = x[j + 1];
+      float br = x[j + 2], bi = x[j + 3];
+
+      x[j] = ar + br;
+      x[j + 1] = ai + bi;
+      x[j + 2] = ar - br;
+      x[j + 3] = ai - bi;
+    }
+  }
+}
+
+/**
+ * cfft_q15
+ * \brief Q15 version of cfft_f32.
+ * \param x interleaved complex data
+ * \param m number of complex points
+ * \param scale if true each butterfly divides by its radix so the result is scaled
+ *        by 1/m and cannot overflow, otherwise the result saturates.
+ */
+static void cfft_q15(int16_t *restrict x, size_t m, bool scale)
+{
+  const int shift4 = scale ? 2 : 0;
+  const int shift2 = scale ? 1 : 0;
+  size_t l = m;
+
+  for (; l >= 4; l >>= 2)
+  {
+    const size_t q = l / 4;
+    const size_t step = FFT_MAX_SIZE / l;
+
+    for (size_t k = 0; k < q; k++)
+    {
+      const int16_t *w1 = &fft_twiddle_q15[2 * k * step];
+      const int16_t *w2 = &fft_twiddle_q15[4 * k * step];
+      const int16_t *w3 = &fft_twiddle_q15[6 * k * step];
+
+      for (size_t j = 2 * k; j < 2 * m; j += 2 * l)
+      {
+        int16_t *p0 = &x[j];
+        int16_t *p1 = p0 + 2 * q;
+        int16_t *p2 = p1 + 2 * q;
+        int16_t *p3 = p2 + 2 * q;
+
+        int32_t s02r = p0[0] + p2[0], s02i = p0[1] + p2[1];
+        int32_t d02r = p0[0] - p2[0], d02i = p0[1] - p2[1];
+        int32_t s13r = p1[0] + p3[0], s13i = p1[1] + p3[1];
+        int32_t d13r = p1[0] - p3[0], d13i = p1[1] - p3[1];
+
+        /* Scale before the twiddle multiply to keep the products within 32 bits */
+        int32_t t0r = __SSAT(rshift(s02r + s13r, shift4), 16), t0i = __SSAT(rshift(s02i + s13i, shift4), 16);
+        int32_t t1r = __SSAT(rshift(s02r - s13r, shift4), 16), t1i = __SSAT(rshift(s02i - s13i, shift4), 16);
+        int32_t t2r = __SSAT(rshift(d02r + d13i, shift4), 16), t2i = __SSAT(rshift(d02i - d13r, shift4), 16);
+        int32_t t3r = __SSAT(rshift(d02r - d13i, shift4), 16), t3i = __SSAT(rshift(d02i + d13r, shift4), 16);
+
+        p0[0] = (int16_t)t0r;
+        p0[1] = (int16_t)t0i;
+        p1[0] = (int16_t)__SSAT(rshift(t1r * w2[0] + t1i * w2[1], 15), 16);
+        p1[1] = (int16_t)__SSAT(rshift(t1i * w2[0] - t1r * w2[1], 15), 16);
+        p2[0] = (int16_t)__SSAT(rshift(t2r * w1[0] + t2i * w1[1], 15), 16);
+        p2[1] = (int16_t)__SSAT(rshift(t2i * w1[0] - t2r * w1[1], 15), 16);
+        p3[0] = (int16_t)__SSAT(rshift(t3r * w3[0] + t3i * w3[1], 15), 16);
+        p3[1] = (int16_t)__SSAT(rshift(t3i * w3[0] - t3r * w3[1], 15), 16);
+      }
+    }
+  }
+
+  if (l == 2)
+  {
+    for (size_t j = 0; j < 2 * m; j += 4)
+    {
+      int32_t ar = x[j], ai = x[j + 1];
+      int32_t br = x[j + 2], bi = x[j + 3];
+
+      x[j] = (int16_t)__SSAT(rshift(ar + br, shift2), 16);
+      x[j + 1] = (int16_t)__SSAT(rshift(ai + bi, shift2), 16);
+      x[j + 2] = (int16_t)__SSAT(rshift(ar - br, shift2), 16);
+      x[j + 3] = (int16_t)__SSAT(rshift(ai - bi, shift2), 16);
+    }
+  }
+}
+
+/**
+ * rshift
+ * \brief arithmetic right shift with rounding, truncation bias otherwise builds up
+ *        through the stages and dominates the Q15 error.
+ * \param value the value to shift
+ * \param shift number of bits, may be zero
+ */
+static inline int32_t rshift(int32_t value, int shift)
+{
+  return (value + ((1 << shift) >> 1)) >> shift;
+}
+
+/**
+ * bitrev_f32
+ * \brief reorders the complex transform output from bit reversed to natural order.
+ * \param fft the transform instance
+ * \param x interleaved complex data
+ */
+static void bitrev_f32(const fft_t *fft, float *restrict x)
+{
+  for (size_t i = 1; i < fft->half; i++)
+  {
+    size_t j = fft_bitrev[i] >> fft->bitrev_shift;
+    if (i < j)
+    {
+      float tr = x[2 * i], ti = x[2 * i + 1];
+      x[2 * i] = x[2 * j];
+      x[2 * i + 1] = x[2 * j + 1];
+      x[2 * j] = tr;
+      x[2 * j + 1] = ti;
+    }
+  }
+}
+
+/**
+ * bitrev_q15
+ * \brief Q15 version of bitrev_f32, each complex value is moved as one word.
+ * \param fft the transform instance
+ * \param x interleaved complex data
+ */
+static void bitrev_q15(const fft_t *fft, int16_t *restrict x)
+{
+  uint32_t *restrict c = (uint32_t *)x;
+
+  for (size_t i = 1; i < fft->half; i++)
+  {
+    size_t j = fft_bitrev[i] >> fft->bitrev_shift;
+    if (i < j)
+    {
+      uint32_t t = c[i];
+      c[i] = c[j];
+      c[j] = t;
+    }
+  }
+}
+
+/**
+ * fft_benchmark
+ * \brief measures the cycle count of every transform and size, results go to RTT.
+ * \param scratch working buffer of FFT_MAX_SIZE floats, the contents are destroyed
+ * \note only available in RTT builds, call it from dae_prepare_for_play() when profiling.
+ */
+void fft_benchmark(float *scratch)
+{
+#ifdef RTT_ENABLED
+  int16_t *scratch_q15 = (int16_t *)scratch;
+  fft_t fft;
+
+  DWT_INIT();
+
+  for (size_t n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1)
+  {
+    fft_init(&fft, n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+      scratch[i] = (i & 1) ? 0.5f : -0.5f;
+    }
+
+    RTT_LOG("%sFFT size %u\n", RTT_CTRL_TEXT_BRIGHT_CYAN, (unsigned)n);
+
+    DWT_START();
+    fft_forward(&fft, scratch);
+    DWT_OUTPUT("fft_forward");
+
+    DWT_START();
+    fft_inverse(&fft, scratch);
+    DWT_OUTPUT("fft_inverse");
+
+    for (size_t i = 0; i < n; i++)
+    {
+      scratch_q15[i] = (i & 1) ? 16384 : -16384;
+    }
+
+    DWT_START();
+    fft_forward_q15(&fft, scratch_q15);
+    DWT_OUTPUT("fft_forward_q15");
+
+    DWT_START();
+    fft_inverse_q15(&fft, scratch_q15);
+    DWT_OUTPUT("fft_inverse_q15");
+  }
+#endif
+}
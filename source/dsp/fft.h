@@ -0,0 +1,77 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Real FFT/IFFT for sizes FFT_MIN_SIZE to FFT_MAX_SIZE (powers of two).
+
+  An N point real transform is computed as an N/2 point complex transform using
+  radix-4 (radix-2^2) butterflies, with a final radix-2 pass when log2(N/2) is
+  odd, followed by a split pass that separates the even/odd real sequences.
+
+  All transforms are in-place and nothing is allocated, the twiddle and bit
+  reversal tables are const and live in flash (see fft_tables.c).
+
+  The spectrum is packed in the same layout as the input buffer:
+
+    buf[0]      = Re X[0]    (DC, imaginary part is always zero)
+    buf[1]      = Re X[N/2]  (Nyquist, imaginary part is always zero)
+    buf[2k]     = Re X[k]    for 1 <= k < N/2
+    buf[2k + 1] = Im X[k]
+
+  Scaling:
+    float forward - unscaled, X[k] = sum x[n].e^(-j.2.pi.k.n/N)
+    float inverse - scaled by 1/N, so inverse(forward(x)) == x
+    q15 forward   - scaled by 1/N so it can never overflow
+    q15 inverse   - unscaled and saturating, inverse(forward(x)) ~= x
+
+  The Q15 forward transform is accurate to a couple of LSBs per bin, but that
+  quantisation is amplified by N in the inverse so the round trip is only good
+  to roughly 30-40dB at the larger sizes. Use the float variant for anything
+  that goes back to the time domain (convolution, spectral effects) and Q15 for
+  analysis such as spectrum display.
+*/
+#define FFT_MIN_SIZE (64)
+#define FFT_MAX_SIZE (2048)
+
+/* Table sizes, these must match tools/gen_fft_tables.py */
+#define FFT_TWIDDLE_COUNT (3 * FFT_MAX_SIZE / 4)
+#define FFT_BITREV_COUNT (FFT_MAX_SIZE / 2)
+
+/* Per-size transform instance, set up once by fft_init() */
+typedef struct
+{
+  size_t size;          /* Real transform length N */
+  size_t half;          /* Complex transform length N/2 */
+  uint32_t stride;      /* Twiddle table step for W_N */
+  uint32_t bitrev_shift; /* Shift applied to the bit reversal table for N/2 */
+} fft_t;
+
+/* Precomputed tables (flash) */
+extern const float fft_twiddle_f32[2 * FFT_TWIDDLE_COUNT];
+extern const int16_t fft_twiddle_q15[2 * FFT_TWIDDLE_COUNT];
+extern const uint16_t fft_bitrev[FFT_BITREV_COUNT];
+
+/* API */
+bool fft_init(fft_t *fft, size_t size);
+
+void fft_forward(const fft_t *fft, float *buf);
+void fft_inverse(const fft_t *fft, float *buf);
+
+void fft_forward_q15(const fft_t *fft, int16_t *buf);
+void fft_inverse_q15(const fft_t *fft, int16_t *buf);
+
+void fft_benchmark(float *scratch);
+
+#endif /* FFT_H */
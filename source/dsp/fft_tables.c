@@ -0,0 +1,1263 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+
+/* Generated by tools/gen_fft_tables.py, do not edit. */
+
+#include "fft.h"
+
+const float fft_twiddle_f32[3072] =
+{
+  1.000000000e+00f, 0.000000000e+00f, 9.999952938e-01f, 3.067956763e-03f,
+  9.999811753e-01f, 6.135884649e-03f, 9.999576446e-01f, 9.203754782e-03f,
+  9.999247018e-01f, 1.227153829e-02f, 9.998823475e-01f, 1.533920628e-02f,
+  9.998305818e-01f, 1.840672991e-02f, 9.997694054e-01f, 2.147408028e-02f,
+  9.996988187e-01f, 2.454122852e-02f, 9.996188225e-01f, 2.760814578e-02f,
+  9.995294175e-01f, 3.067480318e-02f, 9.994306046e-01f, 3.374117185e-02f,
+  9.993223846e-01f, 3.680722294e-02f, 9.992047586e-01f, 3.987292759e-02f,
+  9.990777278e-01f, 4.293825693e-02f, 9.989412932e-01f, 4.600318213e-02f,
+  9.987954562e-01f, 4.906767433e-02f, 9.986402182e-01f, 5.213170468e-02f,
+  9.984755806e-01f, 5.519524435e-02f, 9.983015449e-01f, 5.825826450e-02f,
+  9.981181129e-01f, 6.132073630e-02f, 9.979252862e-01f, 6.438263093e-02f,
+  9.977230666e-01f, 6.744391956e-02f, 9.975114561e-01f, 7.050457339e-02f,
+  9.972904567e-01f, 7.356456360e-02f, 9.970600703e-01f, 7.662386139e-02f,
+  9.968202993e-01f, 7.968243797e-02f, 9.965711458e-01f, 8.274026455e-02f,
+  9.963126122e-01f, 8.579731234e-02f, 9.960447009e-01f, 8.885355258e-02f,
+  9.957674145e-01f, 9.190895650e-02f, 9.954807555e-01f, 9.496349533e-02f,
+  9.951847267e-01f, 9.801714033e-02f, 9.948793308e-01f, 1.010698628e-01f,
+  9.945645707e-01f, 1.041216339e-01f, 9.942404495e-01f, 1.071724250e-01f,
+  9.939069700e-01f, 1.102222073e-01f, 9.935641355e-01f, 1.132709522e-01f,
+  9.932119492e-01f, 1.163186309e-01f, 9.928504145e-01f, 1.193652148e-01f,
+  9.924795346e-01f, 1.224106752e-01f, 9.920993131e-01f, 1.254549834e-01f,
+  9.917097537e-01f, 1.284981108e-01f, 9.913108598e-01f, 1.315400287e-01f,
+  9.909026354e-01f, 1.345807085e-01f, 9.904850843e-01f, 1.376201216e-01f,
+  9.900582103e-01f, 1.406582393e-01f, 9.896220175e-01f, 1.436950332e-01f,
+  9.891765100e-01f, 1.467304745e-01f, 9.887216920e-01f, 1.497645347e-01f,
+  9.882575677e-01f, 1.527971853e-01f, 9.877841416e-01f, 1.558283977e-01f,
+  9.873014182e-01f, 1.588581433e-01f, 9.868094018e-01f, 1.618863938e-01f,
+  9.863080972e-01f, 1.649131205e-01f, 9.857975092e-01f, 1.679382950e-01f,
+  9.852776424e-01f, 1.709618888e-01f, 9.847485018e-01f, 1.739838734e-01f,
+  9.842100924e-01f, 1.770042204e-01f, 9.836624192e-01f, 1.800229014e-01f,
+  9.831054874e-01f, 1.830398880e-01f, 9.825393023e-01f, 1.860551517e-01f,
+  9.819638691e-01f, 1.890686641e-01f, 9.813791933e-01f, 1.920803970e-01f,
+  9.807852804e-01f, 1.950903220e-01f, 9.801821360e-01f, 1.980984107e-01f,
+  9.795697657e-01f, 2.011046348e-01f, 9.789481753e-01f, 2.041089661e-01f,
+  9.783173707e-01f, 2.071113762e-01f, 9.776773578e-01f, 2.101118369e-01f,
+  9.770281427e-01f, 2.131103199e-01f, 9.763697313e-01f, 2.161067971e-01f,
+  9.757021300e-01f, 2.191012402e-01f, 9.750253451e-01f, 2.220936210e-01f,
+  9.743393828e-01f, 2.250839114e-01f, 9.736442497e-01f, 2.280720832e-01f,
+  9.729399522e-01f, 2.310581083e-01f, 9.722264971e-01f, 2.340419586e-01f,
+  9.715038910e-01f, 2.370236060e-01f, 9.707721407e-01f, 2.400030224e-01f,
+  9.700312532e-01f, 2.429801799e-01f, 9.692812354e-01f, 2.459550503e-01f,
+  9.685220943e-01f, 2.489276057e-01f, 9.677538371e-01f, 2.518978182e-01f,
+  9.669764710e-01f, 2.548656596e-01f, 9.661900034e-01f, 2.578311022e-01f,
+  9.653944417e-01f, 2.607941179e-01f, 9.645897933e-01f, 2.637546790e-01f,
+  9.637760658e-01f, 2.667127575e-01f, 9.629532669e-01f, 2.696683256e-01f,
+  9.621214043e-01f, 2.726213554e-01f, 9.612804858e-01f, 2.755718193e-01f,
+  9.604305194e-01f, 2.785196894e-01f, 9.595715131e-01f, 2.814649379e-01f,
+  9.587034749e-01f, 2.844075372e-01f, 9.578264130e-01f, 2.873474595e-01f,
+  9.569403357e-01f, 2.902846773e-01f, 9.560452513e-01f, 2.932191627e-01f,
+  9.551411683e-01f, 2.961508882e-01f, 9.542280951e-01f, 2.990798263e-01f,
+  9.533060404e-01f, 3.020059493e-01f, 9.523750127e-01f, 3.049292297e-01f,
+  9.514350210e-01f, 3.078496400e-01f, 9.504860739e-01f, 3.107671527e-01f,
+  9.495281806e-01f, 3.136817404e-01f, 9.485613499e-01f, 3.165933756e-01f,
+  9.475855910e-01f, 3.195020308e-01f, 9.466009131e-01f, 3.224076788e-01f,
+  9.456073254e-01f, 3.253102922e-01f, 9.446048373e-01f, 3.282098436e-01f,
+  9.435934582e-01f, 3.311063058e-01f, 9.425731976e-01f, 3.339996514e-01f,
+  9.415440652e-01f, 3.368898534e-01f, 9.405060706e-01f, 3.397768844e-01f,
+  9.394592236e-01f, 3.426607173e-01f, 9.384035341e-01f, 3.455413250e-01f,
+  9.373390119e-01f, 3.484186802e-01f, 9.362656672e-01f, 3.512927561e-01f,
+  9.351835099e-01f, 3.541635254e-01f, 9.340925504e-01f, 3.570309612e-01f,
+  9.329927988e-01f, 3.598950365e-01f, 9.318842656e-01f, 3.627557244e-01f,
+  9.307669611e-01f, 3.656129978e-01f, 9.296408958e-01f, 3.684668300e-01f,
+  9.285060805e-01f, 3.713171940e-01f, 9.273625257e-01f, 3.741640630e-01f,
+  9.262102421e-01f, 3.770074102e-01f, 9.250492408e-01f, 3.798472089e-01f,
+  9.238795325e-01f, 3.826834324e-01f, 9.227011283e-01f, 3.855160538e-01f,
+  9.215140393e-01f, 3.883450467e-01f, 9.203182767e-01f, 3.911703843e-01f,
+  9.191138517e-01f, 3.939920401e-01f, 9.179007756e-01f, 3.968099874e-01f,
+  9.166790599e-01f, 3.996241998e-01f, 9.154487161e-01f, 4.024346509e-01f,
+  9.142097557e-01f, 4.052413140e-01f, 9.129621904e-01f, 4.080441629e-01f,
+  9.117060320e-01f, 4.108431711e-01f, 9.104412923e-01f, 4.136383122e-01f,
+  9.091679831e-01f, 4.164295601e-01f, 9.078861165e-01f, 4.192168884e-01f,
+  9.065957045e-01f, 4.220002708e-01f, 9.052967593e-01f, 4.247796812e-01f,
+  9.039892931e-01f, 4.275550934e-01f, 9.026733182e-01f, 4.303264813e-01f,
+  9.013488470e-01f, 4.330938189e-01f, 9.000158920e-01f, 4.358570799e-01f,
+  8.986744657e-01f, 4.386162385e-01f, 8.973245807e-01f, 4.413712687e-01f,
+  8.959662498e-01f, 4.441221446e-01f, 8.945994856e-01f, 4.468688402e-01f,
+  8.932243012e-01f, 4.496113297e-01f, 8.918407094e-01f, 4.523495872e-01f,
+  8.904487232e-01f, 4.550835871e-01f, 8.890483559e-01f, 4.578133036e-01f,
+  8.876396204e-01f, 4.605387110e-01f, 8.862225301e-01f, 4.632597836e-01f,
+  8.847970984e-01f, 4.659764958e-01f, 8.833633387e-01f, 4.686888220e-01f,
+  8.819212643e-01f, 4.713967368e-01f, 8.804708891e-01f, 4.741002147e-01f,
+  8.790122264e-01f, 4.767992301e-01f, 8.775452902e-01f, 4.794937577e-01f,
+  8.760700942e-01f, 4.821837721e-01f, 8.745866523e-01f, 4.848692480e-01f,
+  8.730949784e-01f, 4.875501601e-01f, 8.715950867e-01f, 4.902264833e-01f,
+  8.700869911e-01f, 4.928981922e-01f, 8.685707060e-01f, 4.955652618e-01f,
+  8.670462455e-01f, 4.982276670e-01f, 8.655136241e-01f, 5.008853826e-01f,
+  8.639728561e-01f, 5.035383837e-01f, 8.624239561e-01f, 5.061866453e-01f,
+  8.608669386e-01f, 5.088301425e-01f, 8.593018184e-01f, 5.114688504e-01f,
+  8.577286100e-01f, 5.141027442e-01f, 8.561473284e-01f, 5.167317990e-01f,
+  8.545579884e-01f, 5.193559902e-01f, 8.529606049e-01f, 5.219752929e-01f,
+  8.513551931e-01f, 5.245896827e-01f, 8.497417680e-01f, 5.271991348e-01f,
+  8.481203448e-01f, 5.298036247e-01f, 8.464909388e-01f, 5.324031279e-01f,
+  8.448535652e-01f, 5.349976199e-01f, 8.432082396e-01f, 5.375870763e-01f,
+  8.415549774e-01f, 5.401714727e-01f, 8.398937942e-01f, 5.427507849e-01f,
+  8.382247056e-01f, 5.453249884e-01f, 8.365477272e-01f, 5.478940592e-01f,
+  8.348628750e-01f, 5.504579729e-01f, 8.331701647e-01f, 5.530167056e-01f,
+  8.314696123e-01f, 5.555702330e-01f, 8.297612338e-01f, 5.581185312e-01f,
+  8.280450453e-01f, 5.606615762e-01f, 8.263210628e-01f, 5.631993440e-01f,
+  8.245893028e-01f, 5.657318108e-01f, 8.228497814e-01f, 5.682589527e-01f,
+  8.211025150e-01f, 5.707807459e-01f, 8.193475201e-01f, 5.732971667e-01f,
+  8.175848132e-01f, 5.758081914e-01f, 8.158144108e-01f, 5.783137964e-01f,
+  8.140363297e-01f, 5.808139581e-01f, 8.122505866e-01f, 5.833086529e-01f,
+  8.104571983e-01f, 5.857978575e-01f, 8.086561816e-01f, 5.882815482e-01f,
+  8.068475535e-01f, 5.907597019e-01f, 8.050313311e-01f, 5.932322950e-01f,
+  8.032075315e-01f, 5.956993045e-01f, 8.013761717e-01f, 5.981607070e-01f,
+  7.995372691e-01f, 6.006164794e-01f, 7.976908409e-01f, 6.030665985e-01f,
+  7.958369046e-01f, 6.055110414e-01f, 7.939754776e-01f, 6.079497850e-01f,
+  7.921065773e-01f, 6.103828063e-01f, 7.902302214e-01f, 6.128100824e-01f,
+  7.883464276e-01f, 6.152315906e-01f, 7.864552136e-01f, 6.176473079e-01f,
+  7.845565972e-01f, 6.200572118e-01f, 7.826505962e-01f, 6.224612794e-01f,
+  7.807372286e-01f, 6.248594881e-01f, 7.788165124e-01f, 6.272518155e-01f,
+  7.768884657e-01f, 6.296382389e-01f, 7.749531066e-01f, 6.320187359e-01f,
+  7.730104534e-01f, 6.343932842e-01f, 7.710605243e-01f, 6.367618612e-01f,
+  7.691033376e-01f, 6.391244449e-01f, 7.671389119e-01f, 6.414810128e-01f,
+  7.651672656e-01f, 6.438315429e-01f, 7.631884173e-01f, 6.461760130e-01f,
+  7.612023855e-01f, 6.485144010e-01f, 7.592091890e-01f, 6.508466850e-01f,
+  7.572088465e-01f, 6.531728430e-01f, 7.552013769e-01f, 6.554928530e-01f,
+  7.531867990e-01f, 6.578066933e-01f, 7.511651319e-01f, 6.601143421e-01f,
+  7.491363945e-01f, 6.624157776e-01f, 7.471006060e-01f, 6.647109782e-01f,
+  7.450577854e-01f, 6.669999223e-01f, 7.430079521e-01f, 6.692825883e-01f,
+  7.409511254e-01f, 6.715589548e-01f, 7.388873245e-01f, 6.738290004e-01f,
+  7.368165689e-01f, 6.760927036e-01f, 7.347388781e-01f, 6.783500431e-01f,
+  7.326542717e-01f, 6.806009978e-01f, 7.305627692e-01f, 6.828455464e-01f,
+  7.284643904e-01f, 6.850836678e-01f, 7.263591551e-01f, 6.873153409e-01f,
+  7.242470830e-01f, 6.895405447e-01f, 7.221281939e-01f, 6.917592584e-01f,
+  7.200025080e-01f, 6.939714609e-01f, 7.178700451e-01f, 6.961771315e-01f,
+  7.157308253e-01f, 6.983762494e-01f, 7.135848688e-01f, 7.005687939e-01f,
+  7.114321957e-01f, 7.027547445e-01f, 7.092728264e-01f, 7.049340804e-01f,
+  7.071067812e-01f, 7.071067812e-01f, 7.049340804e-01f, 7.092728264e-01f,
+  7.027547445e-01f, 7.114321957e-01f, 7.005687939e-01f, 7.135848688e-01f,
+  6.983762494e-01f, 7.157308253e-01f, 6.961771315e-01f, 7.178700451e-01f,
+  6.939714609e-01f, 7.200025080e-01f, 6.917592584e-01f, 7.221281939e-01f,
+  6.895405447e-01f, 7.242470830e-01f, 6.873153409e-01f, 7.263591551e-01f,
+  6.850836678e-01f, 7.284643904e-01f, 6.828455464e-01f, 7.305627692e-01f,
+  6.806009978e-01f, 7.326542717e-01f, 6.783500431e-01f, 7.347388781e-01f,
+  6.760927036e-01f, 7.368165689e-01f, 6.738290004e-01f, 7.388873245e-01f,
+  6.715589548e-01f, 7.409511254e-01f, 6.692825883e-01f, 7.430079521e-01f,
+  6.669999223e-01f, 7.450577854e-01f, 6.647109782e-01f, 7.471006060e-01f,
+  6.624157776e-01f, 7.491363945e-01f, 6.601143421e-01f, 7.511651319e-01f,
+  6.578066933e-01f, 7.531867990e-01f, 6.554928530e-01f, 7.552013769e-01f,
+  6.531728430e-01f, 7.572088465e-01f, 6.508466850e-01f, 7.592091890e-01f,
+  6.485144010e-01f, 7.612023855e-01f, 6.461760130e-01f, 7.631884173e-01f,
+  6.438315429e-01f, 7.651672656e-01f, 6.414810128e-01f, 7.671389119e-01f,
+  6.391244449e-01f, 7.691033376e-01f, 6.367618612e-01f, 7.710605243e-01f,
+  6.343932842e-01f, 7.730104534e-01f, 6.320187359e-01f, 7.749531066e-01f,
+  6.296382389e-01f, 7.768884657e-01f, 6.272518155e-01f, 7.788165124e-01f,
+  6.248594881e-01f, 7.807372286e-01f, 6.224612794e-01f, 7.826505962e-01f,
+  6.200572118e-01f, 7.845565972e-01f, 6.176473079e-01f, 7.864552136e-01f,
+  6.152315906e-01f, 7.883464276e-01f, 6.128100824e-01f, 7.902302214e-01f,
+  6.103828063e-01f, 7.921065773e-01f, 6.079497850e-01f, 7.939754776e-01f,
+  6.055110414e-01f, 7.958369046e-01f, 6.030665985e-01f, 7.976908409e-01f,
+  6.006164794e-01f, 7.995372691e-01f, 5.981607070e-01f, 8.013761717e-01f,
+  5.956993045e-01f, 8.032075315e-01f, 5.932322950e-01f, 8.050313311e-01f,
+  5.907597019e-01f, 8.068475535e-01f, 5.882815482e-01f, 8.086561816e-01f,
+  5.857978575e-01f, 8.104571983e-01f, 5.833086529e-01f, 8.122505866e-01f,
+  5.808139581e-01f, 8.140363297e-01f, 5.783137964e-01f, 8.158144108e-01f,
+  5.758081914e-01f, 8.175848132e-01f, 5.732971667e-01f, 8.193475201e-01f,
+  5.707807459e-01f, 8.211025150e-01f, 5.682589527e-01f, 8.228497814e-01f,
+  5.657318108e-01f, 8.245893028e-01f, 5.631993440e-01f, 8.263210628e-01f,
+  5.606615762e-01f, 8.280450453e-01f, 5.581185312e-01f, 8.297612338e-01f,
+  5.555702330e-01f, 8.314696123e-01f, 5.530167056e-01f, 8.331701647e-01f,
+  5.504579729e-01f, 8.348628750e-01f, 5.478940592e-01f, 8.365477272e-01f,
+  5.453249884e-01f, 8.382247056e-01f, 5.427507849e-01f, 8.398937942e-01f,
+  5.401714727e-01f, 8.415549774e-01f, 5.375870763e-01f, 8.432082396e-01f,
+  5.349976199e-01f, 8.448535652e-01f, 5.324031279e-01f, 8.464909388e-01f,
+  5.298036247e-01f, 8.481203448e-01f, 5.271991348e-01f, 8.497417680e-01f,
+  5.245896827e-01f, 8.513551931e-01f, 5.219752929e-01f, 8.529606049e-01f,
+  5.193559902e-01f, 8.545579884e-01f, 5.167317990e-01f, 8.561473284e-01f,
+  5.141027442e-01f, 8.577286100e-01f, 5.114688504e-01f, 8.593018184e-01f,
+  5.088301425e-01f, 8.608669386e-01f, 5.061866453e-01f, 8.624239561e-01f,
+  5.035383837e-01f, 8.639728561e-01f, 5.008853826e-01f, 8.655136241e-01f,
+  4.982276670e-01f, 8.670462455e-01f, 4.955652618e-01f, 8.685707060e-01f,
+  4.928981922e-01f, 8.700869911e-01f, 4.902264833e-01f, 8.715950867e-01f,
+  4.875501601e-01f, 8.730949784e-01f, 4.848692480e-01f, 8.745866523e-01f,
+  4.821837721e-01f, 8.760700942e-01f, 4.794937577e-01f, 8.775452902e-01f,
+  4.767992301e-01f, 8.790122264e-01f, 4.741002147e-01f, 8.804708891e-01f,
+  4.713967368e-01f, 8.819212643e-01f, 4.686888220e-01f, 8.833633387e-01f,
+  4.659764958e-01f, 8.847970984e-01f, 4.632597836e-01f, 8.862225301e-01f,
+  4.605387110e-01f, 8.876396204e-01f, 4.578133036e-01f, 8.890483559e-01f,
+  4.550835871e-01f, 8.904487232e-01f, 4.523495872e-01f, 8.918407094e-01f,
+  4.496113297e-01f, 8.932243012e-01f, 4.468688402e-01f, 8.945994856e-01f,
+  4.441221446e-01f, 8.959662498e-01f, 4.413712687e-01f, 8.973245807e-01f,
+  4.386162385e-01f, 8.986744657e-01f, 4.358570799e-01f, 9.000158920e-01f,
+  4.330938189e-01f, 9.013488470e-01f, 4.303264813e-01f, 9.026733182e-01f,
+  4.275550934e-01f, 9.039892931e-01f, 4.247796812e-01f, 9.052967593e-01f,
+  4.220002708e-01f, 9.065957045e-01f, 4.192168884e-01f, 9.078861165e-01f,
+  4.164295601e-01f, 9.091679831e-01f, 4.136383122e-01f, 9.104412923e-01f,
+  4.108431711e-01f, 9.117060320e-01f, 4.080441629e-01f, 9.129621904e-01f,
+  4.052413140e-01f, 9.142097557e-01f, 4.024346509e-01f, 9.154487161e-01f,
+  3.996241998e-01f, 9.166790599e-01f, 3.968099874e-01f, 9.179007756e-01f,
+  3.939920401e-01f, 9.191138517e-01f, 3.911703843e-01f, 9.203182767e-01f,
+  3.883450467e-01f, 9.215140393e-01f, 3.855160538e-01f, 9.227011283e-01f,
+  3.826834324e-01f, 9.238795325e-01f, 3.798472089e-01f, 9.250492408e-01f,
+  3.770074102e-01f, 9.262102421e-01f, 3.741640630e-01f, 9.273625257e-01f,
+  3.713171940e-01f, 9.285060805e-01f, 3.684668300e-01f, 9.296408958e-01f,
+  3.656129978e-01f, 9.307669611e-01f, 3.627557244e-01f, 9.318842656e-01f,
+  3.598950365e-01f, 9.329927988e-01f, 3.570309612e-01f, 9.340925504e-01f,
+  3.541635254e-01f, 9.351835099e-01f, 3.512927561e-01f, 9.362656672e-01f,
+  3.484186802e-01f, 9.373390119e-01f, 3.455413250e-01f, 9.384035341e-01f,
+  3.426607173e-01f, 9.394592236e-01f, 3.397768844e-01f, 9.405060706e-01f,
+  3.368898534e-01f, 9.415440652e-01f, 3.339996514e-01f, 9.425731976e-01f,
+  3.311063058e-01f, 9.435934582e-01f, 3.282098436e-01f, 9.446048373e-01f,
+  3.253102922e-01f, 9.456073254e-01f, 3.224076788e-01f, 9.466009131e-01f,
+  3.195020308e-01f, 9.475855910e-01f, 3.165933756e-01f, 9.485613499e-01f,
+  3.136817404e-01f, 9.495281806e-01f, 3.107671527e-01f, 9.504860739e-01f,
+  3.078496400e-01f, 9.514350210e-01f, 3.049292297e-01f, 9.523750127e-01f,
+  3.020059493e-01f, 9.533060404e-01f, 2.990798263e-01f, 9.542280951e-01f,
+  2.961508882e-01f, 9.551411683e-01f, 2.932191627e-01f, 9.560452513e-01f,
+  2.902846773e-01f, 9.569403357e-01f, 2.873474595e-01f, 9.578264130e-01f,
+  2.844075372e-01f, 9.587034749e-01f, 2.814649379e-01f, 9.595715131e-01f,
+  2.785196894e-01f, 9.604305194e-01f, 2.755718193e-01f, 9.612804858e-01f,
+  2.726213554e-01f, 9.621214043e-01f, 2.696683256e-01f, 9.629532669e-01f,
+  2.667127575e-01f, 9.637760658e-01f, 2.637546790e-01f, 9.645897933e-01f,
+  2.607941179e-01f, 9.653944417e-01f, 2.578311022e-01f, 9.661900034e-01f,
+  2.548656596e-01f, 9.669764710e-01f, 2.518978182e-01f, 9.677538371e-01f,
+  2.489276057e-01f, 9.685220943e-01f, 2.459550503e-01f, 9.692812354e-01f,
+  2.429801799e-01f, 9.700312532e-01f, 2.400030224e-01f, 9.707721407e-01f,
+  2.370236060e-01f, 9.715038910e-01f, 2.340419586e-01f, 9.722264971e-01f,
+  2.310581083e-01f, 9.729399522e-01f, 2.280720832e-01f, 9.736442497e-01f,
+  2.250839114e-01f, 9.743393828e-01f, 2.220936210e-01f, 9.750253451e-01f,
+  2.191012402e-01f, 9.757021300e-01f, 2.161067971e-01f, 9.763697313e-01f,
+  2.131103199e-01f, 9.770281427e-01f, 2.101118369e-01f, 9.776773578e-01f,
+  2.071113762e-01f, 9.783173707e-01f, 2.041089661e-01f, 9.789481753e-01f,
+  2.011046348e-01f, 9.795697657e-01f, 1.980984107e-01f, 9.801821360e-01f,
+  1.950903220e-01f, 9.807852804e-01f, 1.920803970e-01f, 9.813791933e-01f,
+  1.890686641e-01f, 9.819638691e-01f, 1.860551517e-01f, 9.825393023e-01f,
+  1.830398880e-01f, 9.831054874e-01f, 1.800229014e-01f, 9.836624192e-01f,
+  1.770042204e-01f, 9.842100924e-01f, 1.739838734e-01f, 9.847485018e-01f,
+  1.709618888e-01f, 9.852776424e-01f, 1.679382950e-01f, 9.857975092e-01f,
+  1.649131205e-01f, 9.863080972e-01f, 1.618863938e-01f, 9.868094018e-01f,
+  1.588581433e-01f, 9.873014182e-01f, 1.558283977e-01f, 9.877841416e-01f,
+  1.527971853e-01f, 9.882575677e-01f, 1.497645347e-01f, 9.887216920e-01f,
+  1.467304745e-01f, 9.891765100e-01f, 1.436950332e-01f, 9.896220175e-01f,
+  1.406582393e-01f, 9.900582103e-01f, 1.376201216e-01f, 9.904850843e-01f,
+  1.345807085e-01f, 9.909026354e-01f, 1.315400287e-01f, 9.913108598e-01f,
+  1.284981108e-01f, 9.917097537e-01f, 1.254549834e-01f, 9.920993131e-01f,
+  1.224106752e-01f, 9.924795346e-01f, 1.193652148e-01f, 9.928504145e-01f,
+  1.163186309e-01f, 9.932119492e-01f, 1.132709522e-01f, 9.935641355e-01f,
+  1.102222073e-01f, 9.939069700e-01f, 1.071724250e-01f, 9.942404495e-01f,
+  1.041216339e-01f, 9.945645707e-01f, 1.010698628e-01f, 9.948793308e-01f,
+  9.801714033e-02f, 9.951847267e-01f, 9.496349533e-02f, 9.954807555e-01f,
+  9.190895650e-02f, 9.957674145e-01f, 8.885355258e-02f, 9.960447009e-01f,
+  8.579731234e-02f, 9.963126122e-01f, 8.274026455e-02f, 9.965711458e-01f,
+  7.968243797e-02f, 9.968202993e-01f, 7.662386139e-02f, 9.970600703e-01f,
+  7.356456360e-02f, 9.972904567e-01f, 7.050457339e-02f, 9.975114561e-01f,
+  6.744391956e-02f, 9.977230666e-01f, 6.438263093e-02f, 9.979252862e-01f,
+  6.132073630e-02f, 9.981181129e-01f, 5.825826450e-02f, 9.983015449e-01f,
+  5.519524435e-02f, 9.984755806e-01f, 5.213170468e-02f, 9.986402182e-01f,
+  4.906767433e-02f, 9.987954562e-01f, 4.600318213e-02f, 9.989412932e-01f,
+  4.293825693e-02f, 9.990777278e-01f, 3.987292759e-02f, 9.992047586e-01f,
+  3.680722294e-02f, 9.993223846e-01f, 3.374117185e-02f, 9.994306046e-01f,
+  3.067480318e-02f, 9.995294175e-01f, 2.760814578e-02f, 9.996188225e-01f,
+  2.454122852e-02f, 9.996988187e-01f, 2.147408028e-02f, 9.997694054e-01f,
+  1.840672991e-02f, 9.998305818e-01f, 1.533920628e-02f, 9.998823475e-01f,
+  1.227153829e-02f, 9.999247018e-01f, 9.203754782e-03f, 9.999576446e-01f,
+  6.135884649e-03f, 9.999811753e-01f, 3.067956763e-03f, 9.999952938e-01f,
+  6.123233996e-17f, 1.000000000e+00f, -3.067956763e-03f, 9.999952938e-01f,
+  -6.135884649e-03f, 9.999811753e-01f, -9.203754782e-03f, 9.999576446e-01f,
+  -1.227153829e-02f, 9.999247018e-01f, -1.533920628e-02f, 9.998823475e-01f,
+  -1.840672991e-02f, 9.998305818e-01f, -2.147408028e-02f, 9.997694054e-01f,
+  -2.454122852e-02f, 9.996988187e-01f, -2.760814578e-02f, 9.996188225e-01f,
+  -3.067480318e-02f, 9.995294175e-01f, -3.374117185e-02f, 9.994306046e-01f,
+  -3.680722294e-02f, 9.993223846e-01f, -3.987292759e-02f, 9.992047586e-01f,
+  -4.293825693e-02f, 9.990777278e-01f, -4.600318213e-02f, 9.989412932e-01f,
+  -4.906767433e-02f, 9.987954562e-01f, -5.213170468e-02f, 9.986402182e-01f,
+  -5.519524435e-02f, 9.984755806e-01f, -5.825826450e-02f, 9.983015449e-01f,
+  -6.132073630e-02f, 9.981181129e-01f, -6.438263093e-02f, 9.979252862e-01f,
+  -6.744391956e-02f, 9.977230666e-01f, -7.050457339e-02f, 9.975114561e-01f,
+  -7.356456360e-02f, 9.972904567e-01f, -7.662386139e-02f, 9.970600703e-01f,
+  -7.968243797e-02f, 9.968202993e-01f, -8.274026455e-02f, 9.965711458e-01f,
+  -8.579731234e-02f, 9.963126122e-01f, -8.885355258e-02f, 9.960447009e-01f,
+  -9.190895650e-02f, 9.957674145e-01f, -9.496349533e-02f, 9.954807555e-01f,
+  -9.801714033e-02f, 9.951847267e-01f, -1.010698628e-01f, 9.948793308e-01f,
+  -1.041216339e-01f, 9.945645707e-01f, -1.071724250e-01f, 9.942404495e-01f,
+  -1.102222073e-01f, 9.939069700e-01f, -1.132709522e-01f, 9.935641355e-01f,
+  -1.163186309e-01f, 9.932119492e-01f, -1.193652148e-01f, 9.928504145e-01f,
+  -1.224106752e-01f, 9.924795346e-01f, -1.254549834e-01f, 9.920993131e-01f,
+  -1.284981108e-01f, 9.917097537e-01f, -1.315400287e-01f, 9.913108598e-01f,
+  -1.345807085e-01f, 9.909026354e-01f, -1.376201216e-01f, 9.904850843e-01f,
+  -1.406582393e-01f, 9.900582103e-01f, -1.436950332e-01f, 9.896220175e-01f,
+  -1.467304745e-01f, 9.891765100e-01f, -1.497645347e-01f, 9.887216920e-01f,
+  -1.527971853e-01f, 9.882575677e-01f, -1.558283977e-01f, 9.877841416e-01f,
+  -1.588581433e-01f, 9.873014182e-01f, -1.618863938e-01f, 9.868094018e-01f,
+  -1.649131205e-01f, 9.863080972e-01f, -1.679382950e-01f, 9.857975092e-01f,
+  -1.709618888e-01f, 9.852776424e-01f, -1.739838734e-01f, 9.847485018e-01f,
+  -1.770042204e-01f, 9.842100924e-01f, -1.800229014e-01f, 9.836624192e-01f,
+  -1.830398880e-01f, 9.831054874e-01f, -1.860551517e-01f, 9.825393023e-01f,
+  -1.890686641e-01f, 9.819638691e-01f, -1.920803970e-01f, 9.813791933e-01f,
+  -1.950903220e-01f, 9.807852804e-01f, -1.980984107e-01f, 9.801821360e-01f,
+  -2.011046348e-01f, 9.795697657e-01f, -2.041089661e-01f, 9.789481753e-01f,
+  -2.071113762e-01f, 9.783173707e-01f, -2.101118369e-01f, 9.776773578e-01f,
+  -2.131103199e-01f, 9.770281427e-01f, -2.161067971e-01f, 9.763697313e-01f,
+  -2.191012402e-01f, 9.757021300e-01f, -2.220936210e-01f, 9.750253451e-01f,
+  -2.250839114e-01f, 9.743393828e-01f, -2.280720832e-01f, 9.736442497e-01f,
+  -2.310581083e-01f, 9.729399522e-01f, -2.340419586e-01f, 9.722264971e-01f,
+  -2.370236060e-01f, 9.715038910e-01f, -2.400030224e-01f, 9.707721407e-01f,
+  -2.429801799e-01f, 9.700312532e-01f, -2.459550503e-01f, 9.692812354e-01f,
+  -2.489276057e-01f, 9.685220943e-01f, -2.518978182e-01f, 9.677538371e-01f,
+  -2.548656596e-01f, 9.669764710e-01f, -2.578311022e-01f, 9.661900034e-01f,
+  -2.607941179e-01f, 9.653944417e-01f, -2.637546790e-01f, 9.645897933e-01f,
+  -2.667127575e-01f, 9.637760658e-01f, -2.696683256e-01f, 9.629532669e-01f,
+  -2.726213554e-01f, 9.621214043e-01f, -2.755718193e-01f, 9.612804858e-01f,
+  -2.785196894e-01f, 9.604305194e-01f, -2.814649379e-01f, 9.595715131e-01f,
+  -2.844075372e-01f, 9.587034749e-01f, -2.873474595e-01f, 9.578264130e-01f,
+  -2.902846773e-01f, 9.569403357e-01f, -2.932191627e-01f, 9.560452513e-01f,
+  -2.961508882e-01f, 9.551411683e-01f, -2.990798263e-01f, 9.542280951e-01f,
+  -3.020059493e-01f, 9.533060404e-01f, -3.049292297e-01f, 9.523750127e-01f,
+  -3.078496400e-01f, 9.514350210e-01f, -3.107671527e-01f, 9.504860739e-01f,
+  -3.136817404e-01f, 9.495281806e-01f, -3.165933756e-01f, 9.485613499e-01f,
+  -3.195020308e-01f, 9.475855910e-01f, -3.224076788e-01f, 9.466009131e-01f,
+  -3.253102922e-01f, 9.456073254e-01f, -3.282098436e-01f, 9.446048373e-01f,
+  -3.311063058e-01f, 9.435934582e-01f, -3.339996514e-01f, 9.425731976e-01f,
+  -3.368898534e-01f, 9.415440652e-01f, -3.397768844e-01f, 9.405060706e-01f,
+  -3.426607173e-01f, 9.394592236e-01f, -3.455413250e-01f, 9.384035341e-01f,
+  -3.484186802e-01f, 9.373390119e-01f, -3.512927561e-01f, 9.362656672e-01f,
+  -3.541635254e-01f, 9.351835099e-01f, -3.570309612e-01f, 9.340925504e-01f,
+  -3.598950365e-01f, 9.329927988e-01f, -3.627557244e-01f, 9.318842656e-01f,
+  -3.656129978e-01f, 9.307669611e-01f, -3.684668300e-01f, 9.296408958e-01f,
+  -3.713171940e-01f, 9.285060805e-01f, -3.741640630e-01f, 9.273625257e-01f,
+  -3.770074102e-01f, 9.262102421e-01f, -3.798472089e-01f, 9.250492408e-01f,
+  -3.826834324e-01f, 9.238795325e-01f, -3.855160538e-01f, 9.227011283e-01f,
+  -3.883450467e-01f, 9.215140393e-01f, -3.911703843e-01f, 9.203182767e-01f,
+  -3.939920401e-01f, 9.191138517e-01f, -3.968099874e-01f, 9.179007756e-01f,
+  -3.996241998e-01f, 9.166790599e-01f, -4.024346509e-01f, 9.154487161e-01f,
+  -4.052413140e-01f, 9.142097557e-01f, -4.080441629e-01f, 9.129621904e-01f,
+  -4.108431711e-01f, 9.117060320e-01f, -4.136383122e-01f, 9.104412923e-01f,
+  -4.164295601e-01f, 9.091679831e-01f, -4.192168884e-01f, 9.078861165e-01f,
+  -4.220002708e-01f, 9.065957045e-01f, -4.247796812e-01f, 9.052967593e-01f,
+  -4.275550934e-01f, 9.039892931e-01f, -4.303264813e-01f, 9.026733182e-01f,
+  -4.330938189e-01f, 9.013488470e-01f, -4.358570799e-01f, 9.000158920e-01f,
+  -4.386162385e-01f, 8.986744657e-01f, -4.413712687e-01f, 8.973245807e-01f,
+  -4.441221446e-01f, 8.959662498e-01f, -4.468688402e-01f, 8.945994856e-01f,
+  -4.496113297e-01f, 8.932243012e-01f, -4.523495872e-01f, 8.918407094e-01f,
+  -4.550835871e-01f, 8.904487232e-01f, -4.578133036e-01f, 8.890483559e-01f,
+  -4.605387110e-01f, 8.876396204e-01f, -4.632597836e-01f, 8.862225301e-01f,
+  -4.659764958e-01f, 8.847970984e-01f, -4.686888220e-01f, 8.833633387e-01f,
+  -4.713967368e-01f, 8.819212643e-01f, -4.741002147e-01f, 8.804708891e-01f,
+  -4.767992301e-01f, 8.790122264e-01f, -4.794937577e-01f, 8.775452902e-01f,
+  -4.821837721e-01f, 8.760700942e-01f, -4.848692480e-01f, 8.745866523e-01f,
+  -4.875501601e-01f, 8.730949784e-01f, -4.902264833e-01f, 8.715950867e-01f,
+  -4.928981922e-01f, 8.700869911e-01f, -4.955652618e-01f, 8.685707060e-01f,
+  -4.982276670e-01f, 8.670462455e-01f, -5.008853826e-01f, 8.655136241e-01f,
+  -5.035383837e-01f, 8.639728561e-01f, -5.061866453e-01f, 8.624239561e-01f,
+  -5.088301425e-01f, 8.608669386e-01f, -5.114688504e-01f, 8.593018184e-01f,
+  -5.141027442e-01f, 8.577286100e-01f, -5.167317990e-01f, 8.561473284e-01f,
+  -5.193559902e-01f, 8.545579884e-01f, -5.219752929e-01f, 8.529606049e-01f,
+  -5.245896827e-01f, 8.513551931e-01f, -5.271991348e-01f, 8.497417680e-01f,
+  -5.298036247e-01f, 8.481203448e-01f, -5.324031279e-01f, 8.464909388e-01f,
+  -5.349976199e-01f, 8.448535652e-01f, -5.375870763e-01f, 8.432082396e-01f,
+  -5.401714727e-01f, 8.415549774e-01f, -5.427507849e-01f, 8.398937942e-01f,
+  -5.453249884e-01f, 8.382247056e-01f, -5.478940592e-01f, 8.365477272e-01f,
+  -5.504579729e-01f, 8.348628750e-01f, -5.530167056e-01f, 8.331701647e-01f,
+  -5.555702330e-01f, 8.314696123e-01f, -5.581185312e-01f, 8.297612338e-01f,
+  -5.606615762e-01f, 8.280450453e-01f, -5.631993440e-01f, 8.263210628e-01f,
+  -5.657318108e-01f, 8.245893028e-01f, -5.682589527e-01f, 8.228497814e-01f,
+  -5.707807459e-01f, 8.211025150e-01f, -5.732971667e-01f, 8.193475201e-01f,
+  -5.758081914e-01f, 8.175848132e-01f, -5.783137964e-01f, 8.158144108e-01f,
+  -5.808139581e-01f, 8.140363297e-01f, -5.833086529e-01f, 8.122505866e-01f,
+  -5.857978575e-01f, 8.104571983e-01f, -5.882815482e-01f, 8.086561816e-01f,
+  -5.907597019e-01f, 8.068475535e-01f, -5.932322950e-01f, 8.050313311e-01f,
+  -5.956993045e-01f, 8.032075315e-01f, -5.981607070e-01f, 8.013761717e-01f,
+  -6.006164794e-01f, 7.995372691e-01f, -6.030665985e-01f, 7.976908409e-01f,
+  -6.055110414e-01f, 7.958369046e-01f, -6.079497850e-01f, 7.939754776e-01f,
+  -6.103828063e-01f, 7.921065773e-01f, -6.128100824e-01f, 7.902302214e-01f,
+  -6.152315906e-01f, 7.883464276e-01f, -6.176473079e-01f, 7.864552136e-01f,
+  -6.200572118e-01f, 7.845565972e-01f, -6.224612794e-01f, 7.826505962e-01f,
+  -6.248594881e-01f, 7.807372286e-01f, -6.272518155e-01f, 7.788165124e-01f,
+  -6.296382389e-01f, 7.768884657e-01f, -6.320187359e-01f, 7.749531066e-01f,
+  -6.343932842e-01f, 7.730104534e-01f, -6.367618612e-01f, 7.710605243e-01f,
+  -6.391244449e-01f, 7.691033376e-01f, -6.414810128e-01f, 7.671389119e-01f,
+  -6.438315429e-01f, 7.651672656e-01f, -6.461760130e-01f, 7.631884173e-01f,
+  -6.485144010e-01f, 7.612023855e-01f, -6.508466850e-01f, 7.592091890e-01f,
+  -6.531728430e-01f, 7.572088465e-01f, -6.554928530e-01f, 7.552013769e-01f,
+  -6.578066933e-01f, 7.531867990e-01f, -6.601143421e-01f, 7.511651319e-01f,
+  -6.624157776e-01f, 7.491363945e-01f, -6.647109782e-01f, 7.471006060e-01f,
+  -6.669999223e-01f, 7.450577854e-01f, -6.692825883e-01f, 7.430079521e-01f,
+  -6.715589548e-01f, 7.409511254e-01f, -6.738290004e-01f, 7.388873245e-01f,
+  -6.760927036e-01f, 7.368165689e-01f, -6.783500431e-01f, 7.347388781e-01f,
+  -6.806009978e-01f, 7.326542717e-01f, -6.828455464e-01f, 7.305627692e-01f,
+  -6.850836678e-01f, 7.284643904e-01f, -6.873153409e-01f, 7.263591551e-01f,
+  -6.895405447e-01f, 7.242470830e-01f, -6.917592584e-01f, 7.221281939e-01f,
+  -6.939714609e-01f, 7.200025080e-01f, -6.961771315e-01f, 7.178700451e-01f,
+  -6.983762494e-01f, 7.157308253e-01f, -7.005687939e-01f, 7.135848688e-01f,
+  -7.027547445e-01f, 7.114321957e-01f, -7.049340804e-01f, 7.092728264e-01f,
+  -7.071067812e-01f, 7.071067812e-01f, -7.092728264e-01f, 7.049340804e-01f,
+  -7.114321957e-01f, 7.027547445e-01f, -7.135848688e-01f, 7.005687939e-01f,
+  -7.157308253e-01f, 6.983762494e-01f, -7.178700451e-01f, 6.961771315e-01f,
+  -7.200025080e-01f, 6.939714609e-01f, -7.221281939e-01f, 6.917592584e-01f,
+  -7.242470830e-01f, 6.895405447e-01f, -7.263591551e-01f, 6.873153409e-01f,
+  -7.284643904e-01f, 6.850836678e-01f, -7.305627692e-01f, 6.828455464e-01f,
+  -7.326542717e-01f, 6.806009978e-01f, -7.347388781e-01f, 6.783500431e-01f,
+  -7.368165689e-01f, 6.760927036e-01f, -7.388873245e-01f, 6.738290004e-01f,
+  -7.409511254e-01f, 6.715589548e-01f, -7.430079521e-01f, 6.692825883e-01f,
+  -7.450577854e-01f, 6.669999223e-01f, -7.471006060e-01f, 6.647109782e-01f,
+  -7.491363945e-01f, 6.624157776e-01f, -7.511651319e-01f, 6.601143421e-01f,
+  -7.531867990e-01f, 6.578066933e-01f, -7.552013769e-01f, 6.554928530e-01f,
+  -7.572088465e-01f, 6.531728430e-01f, -7.592091890e-01f, 6.508466850e-01f,
+  -7.612023855e-01f, 6.485144010e-01f, -7.631884173e-01f, 6.461760130e-01f,
+  -7.651672656e-01f, 6.438315429e-01f, -7.671389119e-01f, 6.414810128e-01f,
+  -7.691033376e-01f, 6.391244449e-01f, -7.710605243e-01f, 6.367618612e-01f,
+  -7.730104534e-01f, 6.343932842e-01f, -7.749531066e-01f, 6.320187359e-01f,
+  -7.768884657e-01f, 6.296382389e-01f, -7.788165124e-01f, 6.272518155e-01f,
+  -7.807372286e-01f, 6.248594881e-01f, -7.826505962e-01f, 6.224612794e-01f,
+  -7.845565972e-01f, 6.200572118e-01f, -7.864552136e-01f, 6.176473079e-01f,
+  -7.883464276e-01f, 6.152315906e-01f, -7.902302214e-01f, 6.128100824e-01f,
+  -7.921065773e-01f, 6.103828063e-01f, -7.939754776e-01f, 6.079497850e-01f,
+  -7.958369046e-01f, 6.055110414e-01f, -7.976908409e-01f, 6.030665985e-01f,
+  -7.995372691e-01f, 6.006164794e-01f, -8.013761717e-01f, 5.981607070e-01f,
+  -8.032075315e-01f, 5.956993045e-01f, -8.050313311e-01f, 5.932322950e-01f,
+  -8.068475535e-01f, 5.907597019e-01f, -8.086561816e-01f, 5.882815482e-01f,
+  -8.104571983e-01f, 5.857978575e-01f, -8.122505866e-01f, 5.833086529e-01f,
+  -8.140363297e-01f, 5.808139581e-01f, -8.158144108e-01f, 5.783137964e-01f,
+  -8.175848132e-01f, 5.758081914e-01f, -8.193475201e-01f, 5.732971667e-01f,
+  -8.211025150e-01f, 5.707807459e-01f, -8.228497814e-01f, 5.682589527e-01f,
+  -8.245893028e-01f, 5.657318108e-01f, -8.263210628e-01f, 5.631993440e-01f,
+  -8.280450453e-01f, 5.606615762e-01f, -8.297612338e-01f, 5.581185312e-01f,
+  -8.314696123e-01f, 5.555702330e-01f, -8.331701647e-01f, 5.530167056e-01f,
+  -8.348628750e-01f, 5.504579729e-01f, -8.365477272e-01f, 5.478940592e-01f,
+  -8.382247056e-01f, 5.453249884e-01f, -8.398937942e-01f, 5.427507849e-01f,
+  -8.415549774e-01f, 5.401714727e-01f, -8.432082396e-01f, 5.375870763e-01f,
+  -8.448535652e-01f, 5.349976199e-01f, -8.464909388e-01f, 5.324031279e-01f,
+  -8.481203448e-01f, 5.298036247e-01f, -8.497417680e-01f, 5.271991348e-01f,
+  -8.513551931e-01f, 5.245896827e-01f, -8.529606049e-01f, 5.219752929e-01f,
+  -8.545579884e-01f, 5.193559902e-01f, -8.561473284e-01f, 5.167317990e-01f,
+  -8.577286100e-01f, 5.141027442e-01f, -8.593018184e-01f, 5.114688504e-01f,
+  -8.608669386e-01f, 5.088301425e-01f, -8.624239561e-01f, 5.061866453e-01f,
+  -8.639728561e-01f, 5.035383837e-01f, -8.655136241e-01f, 5.008853826e-01f,
+  -8.670462455e-01f, 4.982276670e-01f, -8.685707060e-01f, 4.955652618e-01f,
+  -8.700869911e-01f, 4.928981922e-01f, -8.715950867e-01f, 4.902264833e-01f,
+  -8.730949784e-01f, 4.875501601e-01f, -8.745866523e-01f, 4.848692480e-01f,
+  -8.760700942e-01f, 4.821837721e-01f, -8.775452902e-01f, 4.794937577e-01f,
+  -8.790122264e-01f, 4.767992301e-01f, -8.804708891e-01f, 4.741002147e-01f,
+  -8.819212643e-01f, 4.713967368e-01f, -8.833633387e-01f, 4.686888220e-01f,
+  -8.847970984e-01f, 4.659764958e-01f, -8.862225301e-01f, 4.632597836e-01f,
+  -8.876396204e-01f, 4.605387110e-01f, -8.890483559e-01f, 4.578133036e-01f,
+  -8.904487232e-01f, 4.550835871e-01f, -8.918407094e-01f, 4.523495872e-01f,
+  -8.932243012e-01f, 4.496113297e-01f, -8.945994856e-01f, 4.468688402e-01f,
+  -8.959662498e-01f, 4.441221446e-01f, -8.973245807e-01f, 4.413712687e-01f,
+  -8.986744657e-01f, 4.386162385e-01f, -9.000158920e-01f, 4.358570799e-01f,
+  -9.013488470e-01f, 4.330938189e-01f, -9.026733182e-01f, 4.303264813e-01f,
+  -9.039892931e-01f, 4.275550934e-01f, -9.052967593e-01f, 4.247796812e-01f,
+  -9.065957045e-01f, 4.220002708e-01f, -9.078861165e-01f, 4.192168884e-01f,
+  -9.091679831e-01f, 4.164295601e-01f, -9.104412923e-01f, 4.136383122e-01f,
+  -9.117060320e-01f, 4.108431711e-01f, -9.129621904e-01f, 4.080441629e-01f,
+  -9.142097557e-01f, 4.052413140e-01f, -9.154487161e-01f, 4.024346509e-01f,
+  -9.166790599e-01f, 3.996241998e-01f, -9.179007756e-01f, 3.968099874e-01f,
+  -9.191138517e-01f, 3.939920401e-01f, -9.203182767e-01f, 3.911703843e-01f,
+  -9.215140393e-01f, 3.883450467e-01f, -9.227011283e-01f, 3.855160538e-01f,
+  -9.238795325e-01f, 3.826834324e-01f, -9.250492408e-01f, 3.798472089e-01f,
+  -9.262102421e-01f, 3.770074102e-01f, -9.273625257e-01f, 3.741640630e-01f,
+  -9.285060805e-01f, 3.713171940e-01f, -9.296408958e-01f, 3.684668300e-01f,
+  -9.307669611e-01f, 3.656129978e-01f, -9.318842656e-01f, 3.627557244e-01f,
+  -9.329927988e-01f, 3.598950365e-01f, -9.340925504e-01f, 3.570309612e-01f,
+  -9.351835099e-01f, 3.541635254e-01f, -9.362656672e-01f, 3.512927561e-01f,
+  -9.373390119e-01f, 3.484186802e-01f, -9.384035341e-01f, 3.455413250e-01f,
+  -9.394592236e-01f, 3.426607173e-01f, -9.405060706e-01f, 3.397768844e-01f,
+  -9.415440652e-01f, 3.368898534e-01f, -9.425731976e-01f, 3.339996514e-01f,
+  -9.435934582e-01f, 3.311063058e-01f, -9.446048373e-01f, 3.282098436e-01f,
+  -9.456073254e-01f, 3.253102922e-01f, -9.466009131e-01f, 3.224076788e-01f,
+  -9.475855910e-01f, 3.195020308e-01f, -9.485613499e-01f, 3.165933756e-01f,
+  -9.495281806e-01f, 3.136817404e-01f, -9.504860739e-01f, 3.107671527e-01f,
+  -9.514350210e-01f, 3.078496400e-01f, -9.523750127e-01f, 3.049292297e-01f,
+  -9.533060404e-01f, 3.020059493e-01f, -9.542280951e-01f, 2.990798263e-01f,
+  -9.551411683e-01f, 2.961508882e-01f, -9.560452513e-01f, 2.932191627e-01f,
+  -9.569403357e-01f, 2.902846773e-01f, -9.578264130e-01f, 2.873474595e-01f,
+  -9.587034749e-01f, 2.844075372e-01f, -9.595715131e-01f, 2.814649379e-01f,
+  -9.604305194e-01f, 2.785196894e-01f, -9.612804858e-01f, 2.755718193e-01f,
+  -9.621214043e-01f, 2.726213554e-01f, -9.629532669e-01f, 2.696683256e-01f,
+  -9.637760658e-01f, 2.667127575e-01f, -9.645897933e-01f, 2.637546790e-01f,
+  -9.653944417e-01f, 2.607941179e-01f, -9.661900034e-01f, 2.578311022e-01f,
+  -9.669764710e-01f, 2.548656596e-01f, -9.677538371e-01f, 2.518978182e-01f,
+  -9.685220943e-01f, 2.489276057e-01f, -9.692812354e-01f, 2.459550503e-01f,
+  -9.700312532e-01f, 2.429801799e-01f, -9.707721407e-01f, 2.400030224e-01f,
+  -9.715038910e-01f, 2.370236060e-01f, -9.722264971e-01f, 2.340419586e-01f,
+  -9.729399522e-01f, 2.310581083e-01f, -9.736442497e-01f, 2.280720832e-01f,
+  -9.743393828e-01f, 2.250839114e-01f, -9.750253451e-01f, 2.220936210e-01f,
+  -9.757021300e-01f, 2.191012402e-01f, -9.763697313e-01f, 2.161067971e-01f,
+  -9.770281427e-01f, 2.131103199e-01f, -9.776773578e-01f, 2.101118369e-01f,
+  -9.783173707e-01f, 2.071113762e-01f, -9.789481753e-01f, 2.041089661e-01f,
+  -9.795697657e-01f, 2.011046348e-01f, -9.801821360e-01f, 1.980984107e-01f,
+  -9.807852804e-01f, 1.950903220e-01f, -9.813791933e-01f, 1.920803970e-01f,
+  -9.819638691e-01f, 1.890686641e-01f, -9.825393023e-01f, 1.860551517e-01f,
+  -9.831054874e-01f, 1.830398880e-01f, -9.836624192e-01f, 1.800229014e-01f,
+  -9.842100924e-01f, 1.770042204e-01f, -9.847485018e-01f, 1.739838734e-01f,
+  -9.852776424e-01f, 1.709618888e-01f, -9.857975092e-01f, 1.679382950e-01f,
+  -9.863080972e-01f, 1.649131205e-01f, -9.868094018e-01f, 1.618863938e-01f,
+  -9.873014182e-01f, 1.588581433e-01f, -9.877841416e-01f, 1.558283977e-01f,
+  -9.882575677e-01f, 1.527971853e-01f, -9.887216920e-01f, 1.497645347e-01f,
+  -9.891765100e-01f, 1.467304745e-01f, -9.896220175e-01f, 1.436950332e-01f,
+  -9.900582103e-01f, 1.406582393e-01f, -9.904850843e-01f, 1.376201216e-01f,
+  -9.909026354e-01f, 1.345807085e-01f, -9.913108598e-01f, 1.315400287e-01f,
+  -9.917097537e-01f, 1.284981108e-01f, -9.920993131e-01f, 1.254549834e-01f,
+  -9.924795346e-01f, 1.224106752e-01f, -9.928504145e-01f, 1.193652148e-01f,
+  -9.932119492e-01f, 1.163186309e-01f, -9.935641355e-01f, 1.132709522e-01f,
+  -9.939069700e-01f, 1.102222073e-01f, -9.942404495e-01f, 1.071724250e-01f,
+  -9.945645707e-01f, 1.041216339e-01f, -9.948793308e-01f, 1.010698628e-01f,
+  -9.951847267e-01f, 9.801714033e-02f, -9.954807555e-01f, 9.496349533e-02f,
+  -9.957674145e-01f, 9.190895650e-02f, -9.960447009e-01f, 8.885355258e-02f,
+  -9.963126122e-01f, 8.579731234e-02f, -9.965711458e-01f, 8.274026455e-02f,
+  -9.968202993e-01f, 7.968243797e-02f, -9.970600703e-01f, 7.662386139e-02f,
+  -9.972904567e-01f, 7.356456360e-02f, -9.975114561e-01f, 7.050457339e-02f,
+  -9.977230666e-01f, 6.744391956e-02f, -9.979252862e-01f, 6.438263093e-02f,
+  -9.981181129e-01f, 6.132073630e-02f, -9.983015449e-01f, 5.825826450e-02f,
+  -9.984755806e-01f, 5.519524435e-02f, -9.986402182e-01f, 5.213170468e-02f,
+  -9.987954562e-01f, 4.906767433e-02f, -9.989412932e-01f, 4.600318213e-02f,
+  -9.990777278e-01f, 4.293825693e-02f, -9.992047586e-01f, 3.987292759e-02f,
+  -9.993223846e-01f, 3.680722294e-02f, -9.994306046e-01f, 3.374117185e-02f,
+  -9.995294175e-01f, 3.067480318e-02f, -9.996188225e-01f, 2.760814578e-02f,
+  -9.996988187e-01f, 2.454122852e-02f, -9.997694054e-01f, 2.147408028e-02f,
+  -9.998305818e-01f, 1.840672991e-02f, -9.998823475e-01f, 1.533920628e-02f,
+  -9.999247018e-01f, 1.227153829e-02f, -9.999576446e-01f, 9.203754782e-03f,
+  -9.999811753e-01f, 6.135884649e-03f, -9.999952938e-01f, 3.067956763e-03f,
+  -1.000000000e+00f, 1.224646799e-16f, -9.999952938e-01f, -3.067956763e-03f,
+  -9.999811753e-01f, -6.135884649e-03f, -9.999576446e-01f, -9.203754782e-03f,
+  -9.999247018e-01f, -1.227153829e-02f, -9.998823475e-01f, -1.533920628e-02f,
+  -9.998305818e-01f, -1.840672991e-02f, -9.997694054e-01f, -2.147408028e-02f,
+  -9.996988187e-01f, -2.454122852e-02f, -9.996188225e-01f, -2.760814578e-02f,
+  -9.995294175e-01f, -3.067480318e-02f, -9.994306046e-01f, -3.374117185e-02f,
+  -9.993223846e-01f, -3.680722294e-02f, -9.992047586e-01f, -3.987292759e-02f,
+  -9.990777278e-01f, -4.293825693e-02f, -9.989412932e-01f, -4.600318213e-02f,
+  -9.987954562e-01f, -4.906767433e-02f, -9.986402182e-01f, -5.213170468e-02f,
+  -9.984755806e-01f, -5.519524435e-02f, -9.983015449e-01f, -5.825826450e-02f,
+  -9.981181129e-01f, -6.132073630e-02f, -9.979252862e-01f, -6.438263093e-02f,
+  -9.977230666e-01f, -6.744391956e-02f, -9.975114561e-01f, -7.050457339e-02f,
+  -9.972904567e-01f, -7.356456360e-02f, -9.970600703e-01f, -7.662386139e-02f,
+  -9.968202993e-01f, -7.968243797e-02f, -9.965711458e-01f, -8.274026455e-02f,
+  -9.963126122e-01f, -8.579731234e-02f, -9.960447009e-01f, -8.885355258e-02f,
+  -9.957674145e-01f, -9.190895650e-02f, -9.954807555e-01f, -9.496349533e-02f,
+  -9.951847267e-01f, -9.801714033e-02f, -9.948793308e-01f, -1.010698628e-01f,
+  -9.945645707e-01f, -1.041216339e-01f, -9.942404495e-01f, -1.071724250e-01f,
+  -9.939069700e-01f, -1.102222073e-01f, -9.935641355e-01f, -1.132709522e-01f,
+  -9.932119492e-01f, -1.163186309e-01f, -9.928504145e-01f, -1.193652148e-01f,
+  -9.924795346e-01f, -1.224106752e-01f, -9.920993131e-01f, -1.254549834e-01f,
+  -9.917097537e-01f, -1.284981108e-01f, -9.913108598e-01f, -1.315400287e-01f,
+  -9.909026354e-01f, -1.345807085e-01f, -9.904850843e-01f, -1.376201216e-01f,
+  -9.900582103e-01f, -1.406582393e-01f, -9.896220175e-01f, -1.436950332e-01f,
+  -9.891765100e-01f, -1.467304745e-01f, -9.887216920e-01f, -1.497645347e-01f,
+  -9.882575677e-01f, -1.527971853e-01f, -9.877841416e-01f, -1.558283977e-01f,
+  -9.873014182e-01f, -1.588581433e-01f, -9.868094018e-01f, -1.618863938e-01f,
+  -9.863080972e-01f, -1.649131205e-01f, -9.857975092e-01f, -1.679382950e-01f,
+  -9.852776424e-01f, -1.709618888e-01f, -9.847485018e-01f, -1.739838734e-01f,
+  -9.842100924e-01f, -1.770042204e-01f, -9.836624192e-01f, -1.800229014e-01f,
+  -9.831054874e-01f, -1.830398880e-01f, -9.825393023e-01f, -1.860551517e-01f,
+  -9.819638691e-01f, -1.890686641e-01f, -9.813791933e-01f, -1.920803970e-01f,
+  -9.807852804e-01f, -1.950903220e-01f, -9.801821360e-01f, -1.980984107e-01f,
+  -9.795697657e-01f, -2.011046348e-01f, -9.789481753e-01f, -2.041089661e-01f,
+  -9.783173707e-01f, -2.071113762e-01f, -9.776773578e-01f, -2.101118369e-01f,
+  -9.770281427e-01f, -2.131103199e-01f, -9.763697313e-01f, -2.161067971e-01f,
+  -9.757021300e-01f, -2.191012402e-01f, -9.750253451e-01f, -2.220936210e-01f,
+  -9.743393828e-01f, -2.250839114e-01f, -9.736442497e-01f, -2.280720832e-01f,
+  -9.729399522e-01f, -2.310581083e-01f, -9.722264971e-01f, -2.340419586e-01f,
+  -9.715038910e-01f, -2.370236060e-01f, -9.707721407e-01f, -2.400030224e-01f,
+  -9.700312532e-01f, -2.429801799e-01f, -9.692812354e-01f, -2.459550503e-01f,
+  -9.685220943e-01f, -2.489276057e-01f, -9.677538371e-01f, -2.518978182e-01f,
+  -9.669764710e-01f, -2.548656596e-01f, -9.661900034e-01f, -2.578311022e-01f,
+  -9.653944417e-01f, -2.607941179e-01f, -9.645897933e-01f, -2.637546790e-01f,
+  -9.637760658e-01f, -2.667127575e-01f, -9.629532669e-01f, -2.696683256e-01f,
+  -9.621214043e-01f, -2.726213554e-01f, -9.612804858e-01f, -2.755718193e-01f,
+  -9.604305194e-01f, -2.785196894e-01f, -9.595715131e-01f, -2.814649379e-01f,
+  -9.587034749e-01f, -2.844075372e-01f, -9.578264130e-01f, -2.873474595e-01f,
+  -9.569403357e-01f, -2.902846773e-01f, -9.560452513e-01f, -2.932191627e-01f,
+  -9.551411683e-01f, -2.961508882e-01f, -9.542280951e-01f, -2.990798263e-01f,
+  -9.533060404e-01f, -3.020059493e-01f, -9.523750127e-01f, -3.049292297e-01f,
+  -9.514350210e-01f, -3.078496400e-01f, -9.504860739e-01f, -3.107671527e-01f,
+  -9.495281806e-01f, -3.136817404e-01f, -9.485613499e-01f, -3.165933756e-01f,
+  -9.475855910e-01f, -3.195020308e-01f, -9.466009131e-01f, -3.224076788e-01f,
+  -9.456073254e-01f, -3.253102922e-01f, -9.446048373e-01f, -3.282098436e-01f,
+  -9.435934582e-01f, -3.311063058e-01f, -9.425731976e-01f, -3.339996514e-01f,
+  -9.415440652e-01f, -3.368898534e-01f, -9.405060706e-01f, -3.397768844e-01f,
+  -9.394592236e-01f, -3.426607173e-01f, -9.384035341e-01f, -3.455413250e-01f,
+  -9.373390119e-01f, -3.484186802e-01f, -9.362656672e-01f, -3.512927561e-01f,
+  -9.351835099e-01f, -3.541635254e-01f, -9.340925504e-01f, -3.570309612e-01f,
+  -9.329927988e-01f, -3.598950365e-01f, -9.318842656e-01f, -3.627557244e-01f,
+  -9.307669611e-01f, -3.656129978e-01f, -9.296408958e-01f, -3.684668300e-01f,
+  -9.285060805e-01f, -3.713171940e-01f, -9.273625257e-01f, -3.741640630e-01f,
+  -9.262102421e-01f, -3.770074102e-01f, -9.250492408e-01f, -3.798472089e-01f,
+  -9.238795325e-01f, -3.826834324e-01f, -9.227011283e-01f, -3.855160538e-01f,
+  -9.215140393e-01f, -3.883450467e-01f, -9.203182767e-01f, -3.911703843e-01f,
+  -9.191138517e-01f, -3.939920401e-01f, -9.179007756e-01f, -3.968099874e-01f,
+  -9.166790599e-01f, -3.996241998e-01f, -9.154487161e-01f, -4.024346509e-01f,
+  -9.142097557e-01f, -4.052413140e-01f, -9.129621904e-01f, -4.080441629e-01f,
+  -9.117060320e-01f, -4.108431711e-01f, -9.104412923e-01f, -4.136383122e-01f,
+  -9.091679831e-01f, -4.164295601e-01f, -9.078861165e-01f, -4.192168884e-01f,
+  -9.065957045e-01f, -4.220002708e-01f, -9.052967593e-01f, -4.247796812e-01f,
+  -9.039892931e-01f, -4.275550934e-01f, -9.026733182e-01f, -4.303264813e-01f,
+  -9.013488470e-01f, -4.330938189e-01f, -9.000158920e-01f, -4.358570799e-01f,
+  -8.986744657e-01f, -4.386162385e-01f, -8.973245807e-01f, -4.413712687e-01f,
+  -8.959662498e-01f, -4.441221446e-01f, -8.945994856e-01f, -4.468688402e-01f,
+  -8.932243012e-01f, -4.496113297e-01f, -8.918407094e-01f, -4.523495872e-01f,
+  -8.904487232e-01f, -4.550835871e-01f, -8.890483559e-01f, -4.578133036e-01f,
+  -8.876396204e-01f, -4.605387110e-01f, -8.862225301e-01f, -4.632597836e-01f,
+  -8.847970984e-01f, -4.659764958e-01f, -8.833633387e-01f, -4.686888220e-01f,
+  -8.819212643e-01f, -4.713967368e-01f, -8.804708891e-01f, -4.741002147e-01f,
+  -8.790122264e-01f, -4.767992301e-01f, -8.775452902e-01f, -4.794937577e-01f,
+  -8.760700942e-01f, -4.821837721e-01f, -8.745866523e-01f, -4.848692480e-01f,
+  -8.730949784e-01f, -4.875501601e-01f, -8.715950867e-01f, -4.902264833e-01f,
+  -8.700869911e-01f, -4.928981922e-01f, -8.685707060e-01f, -4.955652618e-01f,
+  -8.670462455e-01f, -4.982276670e-01f, -8.655136241e-01f, -5.008853826e-01f,
+  -8.639728561e-01f, -5.035383837e-01f, -8.624239561e-01f, -5.061866453e-01f,
+  -8.608669386e-01f, -5.088301425e-01f, -8.593018184e-01f, -5.114688504e-01f,
+  -8.577286100e-01f, -5.141027442e-01f, -8.561473284e-01f, -5.167317990e-01f,
+  -8.545579884e-01f, -5.193559902e-01f, -8.529606049e-01f, -5.219752929e-01f,
+  -8.513551931e-01f, -5.245896827e-01f, -8.497417680e-01f, -5.271991348e-01f,
+  -8.481203448e-01f, -5.298036247e-01f, -8.464909388e-01f, -5.324031279e-01f,
+  -8.448535652e-01f, -5.349976199e-01f, -8.432082396e-01f, -5.375870763e-01f,
+  -8.415549774e-01f, -5.401714727e-01f, -8.398937942e-01f, -5.427507849e-01f,
+  -8.382247056e-01f, -5.453249884e-01f, -8.365477272e-01f, -5.478940592e-01f,
+  -8.348628750e-01f, -5.504579729e-01f, -8.331701647e-01f, -5.530167056e-01f,
+  -8.314696123e-01f, -5.555702330e-01f, -8.297612338e-01f, -5.581185312e-01f,
+  -8.280450453e-01f, -5.606615762e-01f, -8.263210628e-01f, -5.631993440e-01f,
+  -8.245893028e-01f, -5.657318108e-01f, -8.228497814e-01f, -5.682589527e-01f,
+  -8.211025150e-01f, -5.707807459e-01f, -8.193475201e-01f, -5.732971667e-01f,
+  -8.175848132e-01f, -5.758081914e-01f, -8.158144108e-01f, -5.783137964e-01f,
+  -8.140363297e-01f, -5.808139581e-01f, -8.122505866e-01f, -5.833086529e-01f,
+  -8.104571983e-01f, -5.857978575e-01f, -8.086561816e-01f, -5.882815482e-01f,
+  -8.068475535e-01f, -5.907597019e-01f, -8.050313311e-01f, -5.932322950e-01f,
+  -8.032075315e-01f, -5.956993045e-01f, -8.013761717e-01f, -5.981607070e-01f,
+  -7.995372691e-01f, -6.006164794e-01f, -7.976908409e-01f, -6.030665985e-01f,
+  -7.958369046e-01f, -6.055110414e-01f, -7.939754776e-01f, -6.079497850e-01f,
+  -7.921065773e-01f, -6.103828063e-01f, -7.902302214e-01f, -6.128100824e-01f,
+  -7.883464276e-01f, -6.152315906e-01f, -7.864552136e-01f, -6.176473079e-01f,
+  -7.845565972e-01f, -6.200572118e-01f, -7.826505962e-01f, -6.224612794e-01f,
+  -7.807372286e-01f, -6.248594881e-01f, -7.788165124e-01f, -6.272518155e-01f,
+  -7.768884657e-01f, -6.296382389e-01f, -7.749531066e-01f, -6.320187359e-01f,
+  -7.730104534e-01f, -6.343932842e-01f, -7.710605243e-01f, -6.367618612e-01f,
+  -7.691033376e-01f, -6.391244449e-01f, -7.671389119e-01f, -6.414810128e-01f,
+  -7.651672656e-01f, -6.438315429e-01f, -7.631884173e-01f, -6.461760130e-01f,
+  -7.612023855e-01f, -6.485144010e-01f, -7.592091890e-01f, -6.508466850e-01f,
+  -7.572088465e-01f, -6.531728430e-01f, -7.552013769e-01f, -6.554928530e-01f,
+  -7.531867990e-01f, -6.578066933e-01f, -7.511651319e-01f, -6.601143421e-01f,
+  -7.491363945e-01f, -6.624157776e-01f, -7.471006060e-01f, -6.647109782e-01f,
+  -7.450577854e-01f, -6.669999223e-01f, -7.430079521e-01f, -6.692825883e-01f,
+  -7.409511254e-01f, -6.715589548e-01f, -7.388873245e-01f, -6.738290004e-01f,
+  -7.368165689e-01f, -6.760927036e-01f, -7.347388781e-01f, -6.783500431e-01f,
+  -7.326542717e-01f, -6.806009978e-01f, -7.305627692e-01f, -6.828455464e-01f,
+  -7.284643904e-01f, -6.850836678e-01f, -7.263591551e-01f, -6.873153409e-01f,
+  -7.242470830e-01f, -6.895405447e-01f, -7.221281939e-01f, -6.917592584e-01f,
+  -7.200025080e-01f, -6.939714609e-01f, -7.178700451e-01f, -6.961771315e-01f,
+  -7.157308253e-01f, -6.983762494e-01f, -7.135848688e-01f, -7.005687939e-01f,
+  -7.114321957e-01f, -7.027547445e-01f, -7.092728264e-01f, -7.049340804e-01f,
+  -7.071067812e-01f, -7.071067812e-01f, -7.049340804e-01f, -7.092728264e-01f,
+  -7.027547445e-01f, -7.114321957e-01f, -7.005687939e-01f, -7.135848688e-01f,
+  -6.983762494e-01f, -7.157308253e-01f, -6.961771315e-01f, -7.178700451e-01f,
+  -6.939714609e-01f, -7.200025080e-01f, -6.917592584e-01f, -7.221281939e-01f,
+  -6.895405447e-01f, -7.242470830e-01f, -6.873153409e-01f, -7.263591551e-01f,
+  -6.850836678e-01f, -7.284643904e-01f, -6.828455464e-01f, -7.305627692e-01f,
+  -6.806009978e-01f, -7.326542717e-01f, -6.783500431e-01f, -7.347388781e-01f,
+  -6.760927036e-01f, -7.368165689e-01f, -6.738290004e-01f, -7.388873245e-01f,
+  -6.715589548e-01f, -7.409511254e-01f, -6.692825883e-01f, -7.430079521e-01f,
+  -6.669999223e-01f, -7.450577854e-01f, -6.647109782e-01f, -7.471006060e-01f,
+  -6.624157776e-01f, -7.491363945e-01f, -6.601143421e-01f, -7.511651319e-01f,
+  -6.578066933e-01f, -7.531867990e-01f, -6.554928530e-01f, -7.552013769e-01f,
+  -6.531728430e-01f, -7.572088465e-01f, -6.508466850e-01f, -7.592091890e-01f,
+  -6.485144010e-01f, -7.612023855e-01f, -6.461760130e-01f, -7.631884173e-01f,
+  -6.438315429e-01f, -7.651672656e-01f, -6.414810128e-01f, -7.671389119e-01f,
+  -6.391244449e-01f, -7.691033376e-01f, -6.367618612e-01f, -7.710605243e-01f,
+  -6.343932842e-01f, -7.730104534e-01f, -6.320187359e-01f, -7.749531066e-01f,
+  -6.296382389e-01f, -7.768884657e-01f, -6.272518155e-01f, -7.788165124e-01f,
+  -6.248594881e-01f, -7.807372286e-01f, -6.224612794e-01f, -7.826505962e-01f,
+  -6.200572118e-01f, -7.845565972e-01f, -6.176473079e-01f, -7.864552136e-01f,
+  -6.152315906e-01f, -7.883464276e-01f, -6.128100824e-01f, -7.902302214e-01f,
+  -6.103828063e-01f, -7.921065773e-01f, -6.079497850e-01f, -7.939754776e-01f,
+  -6.055110414e-01f, -7.958369046e-01f, -6.030665985e-01f, -7.976908409e-01f,
+  -6.006164794e-01f, -7.995372691e-01f, -5.981607070e-01f, -8.013761717e-01f,
+  -5.956993045e-01f, -8.032075315e-01f, -5.932322950e-01f, -8.050313311e-01f,
+  -5.907597019e-01f, -8.068475535e-01f, -5.882815482e-01f, -8.086561816e-01f,
+  -5.857978575e-01f, -8.104571983e-01f, -5.833086529e-01f, -8.122505866e-01f,
+  -5.808139581e-01f, -8.140363297e-01f, -5.783137964e-01f, -8.158144108e-01f,
+  -5.758081914e-01f, -8.175848132e-01f, -5.732971667e-01f, -8.193475201e-01f,
+  -5.707807459e-01f, -8.211025150e-01f, -5.682589527e-01f, -8.228497814e-01f,
+  -5.657318108e-01f, -8.245893028e-01f, -5.631993440e-01f, -8.263210628e-01f,
+  -5.606615762e-01f, -8.280450453e-01f, -5.581185312e-01f, -8.297612338e-01f,
+  -5.555702330e-01f, -8.314696123e-01f, -5.530167056e-01f, -8.331701647e-01f,
+  -5.504579729e-01f, -8.348628750e-01f, -5.478940592e-01f, -8.365477272e-01f,
+  -5.453249884e-01f, -8.382247056e-01f, -5.427507849e-01f, -8.398937942e-01f,
+  -5.401714727e-01f, -8.415549774e-01f, -5.375870763e-01f, -8.432082396e-01f,
+  -5.349976199e-01f, -8.448535652e-01f, -5.324031279e-01f, -8.464909388e-01f,
+  -5.298036247e-01f, -8.481203448e-01f, -5.271991348e-01f, -8.497417680e-01f,
+  -5.245896827e-01f, -8.513551931e-01f, -5.219752929e-01f, -8.529606049e-01f,
+  -5.193559902e-01f, -8.545579884e-01f, -5.167317990e-01f, -8.561473284e-01f,
+  -5.141027442e-01f, -8.577286100e-01f, -5.114688504e-01f, -8.593018184e-01f,
+  -5.088301425e-01f, -8.608669386e-01f, -5.061866453e-01f, -8.624239561e-01f,
+  -5.035383837e-01f, -8.639728561e-01f, -5.008853826e-01f, -8.655136241e-01f,
+  -4.982276670e-01f, -8.670462455e-01f, -4.955652618e-01f, -8.685707060e-01f,
+  -4.928981922e-01f, -8.700869911e-01f, -4.902264833e-01f, -8.715950867e-01f,
+  -4.875501601e-01f, -8.730949784e-01f, -4.848692480e-01f, -8.745866523e-01f,
+  -4.821837721e-01f, -8.760700942e-01f, -4.794937577e-01f, -8.775452902e-01f,
+  -4.767992301e-01f, -8.790122264e-01f, -4.741002147e-01f, -8.804708891e-01f,
+  -4.713967368e-01f, -8.819212643e-01f, -4.686888220e-01f, -8.833633387e-01f,
+  -4.659764958e-01f, -8.847970984e-01f, -4.632597836e-01f, -8.862225301e-01f,
+  -4.605387110e-01f, -8.876396204e-01f, -4.578133036e-01f, -8.890483559e-01f,
+  -4.550835871e-01f, -8.904487232e-01f, -4.523495872e-01f, -8.918407094e-01f,
+  -4.496113297e-01f, -8.932243012e-01f, -4.468688402e-01f, -8.945994856e-01f,
+  -4.441221446e-01f, -8.959662498e-01f, -4.413712687e-01f, -8.973245807e-01f,
+  -4.386162385e-01f, -8.986744657e-01f, -4.358570799e-01f, -9.000158920e-01f,
+  -4.330938189e-01f, -9.013488470e-01f, -4.303264813e-01f, -9.026733182e-01f,
+  -4.275550934e-01f, -9.039892931e-01f, -4.247796812e-01f, -9.052967593e-01f,
+  -4.220002708e-01f, -9.065957045e-01f, -4.192168884e-01f, -9.078861165e-01f,
+  -4.164295601e-01f, -9.091679831e-01f, -4.136383122e-01f, -9.104412923e-01f,
+  -4.108431711e-01f, -9.117060320e-01f, -4.080441629e-01f, -9.129621904e-01f,
+  -4.052413140e-01f, -9.142097557e-01f, -4.024346509e-01f, -9.154487161e-01f,
+  -3.996241998e-01f, -9.166790599e-01f, -3.968099874e-01f, -9.179007756e-01f,
+  -3.939920401e-01f, -9.191138517e-01f, -3.911703843e-01f, -9.203182767e-01f,
+  -3.883450467e-01f, -9.215140393e-01f, -3.855160538e-01f, -9.227011283e-01f,
+  -3.826834324e-01f, -9.238795325e-01f, -3.798472089e-01f, -9.250492408e-01f,
+  -3.770074102e-01f, -9.262102421e-01f, -3.741640630e-01f, -9.273625257e-01f,
+  -3.713171940e-01f, -9.285060805e-01f, -3.684668300e-01f, -9.296408958e-01f,
+  -3.656129978e-01f, -9.307669611e-01f, -3.627557244e-01f, -9.318842656e-01f,
+  -3.598950365e-01f, -9.329927988e-01f, -3.570309612e-01f, -9.340925504e-01f,
+  -3.541635254e-01f, -9.351835099e-01f, -3.512927561e-01f, -9.362656672e-01f,
+  -3.484186802e-01f, -9.373390119e-01f, -3.455413250e-01f, -9.384035341e-01f,
+  -3.426607173e-01f, -9.394592236e-01f, -3.397768844e-01f, -9.405060706e-01f,
+  -3.368898534e-01f, -9.415440652e-01f, -3.339996514e-01f, -9.425731976e-01f,
+  -3.311063058e-01f, -9.435934582e-01f, -3.282098436e-01f, -9.446048373e-01f,
+  -3.253102922e-01f, -9.456073254e-01f, -3.224076788e-01f, -9.466009131e-01f,
+  -3.195020308e-01f, -9.475855910e-01f, -3.165933756e-01f, -9.485613499e-01f,
+  -3.136817404e-01f, -9.495281806e-01f, -3.107671527e-01f, -9.504860739e-01f,
+  -3.078496400e-01f, -9.514350210e-01f, -3.049292297e-01f, -9.523750127e-01f,
+  -3.020059493e-01f, -9.533060404e-01f, -2.990798263e-01f, -9.542280951e-01f,
+  -2.961508882e-01f, -9.551411683e-01f, -2.932191627e-01f, -9.560452513e-01f,
+  -2.902846773e-01f, -9.569403357e-01f, -2.873474595e-01f, -9.578264130e-01f,
+  -2.844075372e-01f, -9.587034749e-01f, -2.814649379e-01f, -9.595715131e-01f,
+  -2.785196894e-01f, -9.604305194e-01f, -2.755718193e-01f, -9.612804858e-01f,
+  -2.726213554e-01f, -9.621214043e-01f, -2.696683256e-01f, -9.629532669e-01f,
+  -2.667127575e-01f, -9.637760658e-01f, -2.637546790e-01f, -9.645897933e-01f,
+  -2.607941179e-01f, -9.653944417e-01f, -2.578311022e-01f, -9.661900034e-01f,
+  -2.548656596e-01f, -9.669764710e-01f, -2.518978182e-01f, -9.677538371e-01f,
+  -2.489276057e-01f, -9.685220943e-01f, -2.459550503e-01f, -9.692812354e-01f,
+  -2.429801799e-01f, -9.700312532e-01f, -2.400030224e-01f, -9.707721407e-01f,
+  -2.370236060e-01f, -9.715038910e-01f, -2.340419586e-01f, -9.722264971e-01f,
+  -2.310581083e-01f, -9.729399522e-01f, -2.280720832e-01f, -9.736442497e-01f,
+  -2.250839114e-01f, -9.743393828e-01f, -2.220936210e-01f, -9.750253451e-01f,
+  -2.191012402e-01f, -9.757021300e-01f, -2.161067971e-01f, -9.763697313e-01f,
+  -2.131103199e-01f, -9.770281427e-01f, -2.101118369e-01f, -9.776773578e-01f,
+  -2.071113762e-01f, -9.783173707e-01f, -2.041089661e-01f, -9.789481753e-01f,
+  -2.011046348e-01f, -9.795697657e-01f, -1.980984107e-01f, -9.801821360e-01f,
+  -1.950903220e-01f, -9.807852804e-01f, -1.920803970e-01f, -9.813791933e-01f,
+  -1.890686641e-01f, -9.819638691e-01f, -1.860551517e-01f, -9.825393023e-01f,
+  -1.830398880e-01f, -9.831054874e-01f, -1.800229014e-01f, -9.836624192e-01f,
+  -1.770042204e-01f, -9.842100924e-01f, -1.739838734e-01f, -9.847485018e-01f,
+  -1.709618888e-01f, -9.852776424e-01f, -1.679382950e-01f, -9.857975092e-01f,
+  -1.649131205e-01f, -9.863080972e-01f, -1.618863938e-01f, -9.868094018e-01f,
+  -1.588581433e-01f, -9.873014182e-01f, -1.558283977e-01f, -9.877841416e-01f,
+  -1.527971853e-01f, -9.882575677e-01f, -1.497645347e-01f, -9.887216920e-01f,
+  -1.467304745e-01f, -9.891765100e-01f, -1.436950332e-01f, -9.896220175e-01f,
+  -1.406582393e-01f, -9.900582103e-01f, -1.376201216e-01f, -9.904850843e-01f,
+  -1.345807085e-01f, -9.909026354e-01f, -1.315400287e-01f, -9.913108598e-01f,
+  -1.284981108e-01f, -9.917097537e-01f, -1.254549834e-01f, -9.920993131e-01f,
+  -1.224106752e-01f, -9.924795346e-01f, -1.193652148e-01f, -9.928504145e-01f,
+  -1.163186309e-01f, -9.932119492e-01f, -1.132709522e-01f, -9.935641355e-01f,
+  -1.102222073e-01f, -9.939069700e-01f, -1.071724250e-01f, -9.942404495e-01f,
+  -1.041216339e-01f, -9.945645707e-01f, -1.010698628e-01f, -9.948793308e-01f,
+  -9.801714033e-02f, -9.951847267e-01f, -9.496349533e-02f, -9.954807555e-01f,
+  -9.190895650e-02f, -9.957674145e-01f, -8.885355258e-02f, -9.960447009e-01f,
+  -8.579731234e-02f, -9.963126122e-01f, -8.274026455e-02f, -9.965711458e-01f,
+  -7.968243797e-02f, -9.968202993e-01f, -7.662386139e-02f, -9.970600703e-01f,
+  -7.356456360e-02f, -9.972904567e-01f, -7.050457339e-02f, -9.975114561e-01f,
+  -6.744391956e-02f, -9.977230666e-01f, -6.438263093e-02f, -9.979252862e-01f,
+  -6.132073630e-02f, -9.981181129e-01f, -5.825826450e-02f, -9.983015449e-01f,
+  -5.519524435e-02f, -9.984755806e-01f, -5.213170468e-02f, -9.986402182e-01f,
+  -4.906767433e-02f, -9.987954562e-01f, -4.600318213e-02f, -9.989412932e-01f,
+  -4.293825693e-02f, -9.990777278e-01f, -3.987292759e-02f, -9.992047586e-01f,
+  -3.680722294e-02f, -9.993223846e-01f, -3.374117185e-02f, -9.994306046e-01f,
+  -3.067480318e-02f, -9.995294175e-01f, -2.760814578e-02f, -9.996188225e-01f,
+  -2.454122852e-02f, -9.996988187e-01f, -2.147408028e-02f, -9.997694054e-01f,
+  -1.840672991e-02f, -9.998305818e-01f, -1.533920628e-02f, -9.998823475e-01f,
+  -1.227153829e-02f, -9.999247018e-01f, -9.203754782e-03f, -9.999576446e-01f,
+  -6.135884649e-03f, -9.999811753e-01f, -3.067956763e-03f, -9.999952938e-01f,
+};
+
+const int16_t fft_twiddle_q15[3072] =
+{
+   32767,      0,  32767,    101,  32767,    201,  32767,    302,
+   32766,    402,  32764,    503,  32762,    603,  32760,    704,
+   32758,    804,  32756,    905,  32753,   1005,  32749,   1106,
+   32746,   1206,  32742,   1307,  32738,   1407,  32733,   1507,
+   32729,   1608,  32723,   1708,  32718,   1809,  32712,   1909,
+   32706,   2009,  32700,   2110,  32693,   2210,  32686,   2310,
+   32679,   2411,  32672,   2511,  32664,   2611,  32656,   2711,
+   32647,   2811,  32638,   2912,  32629,   3012,  32620,   3112,
+   32610,   3212,  32600,   3312,  32590,   3412,  32579,   3512,
+   32568,   3612,  32557,   3712,  32546,   3812,  32534,   3911,
+   32522,   4011,  32509,   4111,  32496,   4211,  32483,   4310,
+   32470,   4410,  32456,   4510,  32442,   4609,  32428,   4709,
+   32413,   4808,  32398,   4907,  32383,   5007,  32368,   5106,
+   32352,   5205,  32336,   5305,  32319,   5404,  32303,   5503,
+   32286,   5602,  32268,   5701,  32251,   5800,  32233,   5899,
+   32214,   5998,  32196,   6097,  32177,   6195,  32158,   6294,
+   32138,   6393,  32119,   6491,  32099,   6590,  32078,   6688,
+   32058,   6787,  32037,   6885,  32015,   6983,  31994,   7081,
+   31972,   7180,  31950,   7278,  31927,   7376,  31904,   7473,
+   31881,   7571,  31858,   7669,  31834,   7767,  31810,   7864,
+   31786,   7962,  31761,   8059,  31737,   8157,  31711,   8254,
+   31686,   8351,  31660,   8449,  31634,   8546,  31608,   8643,
+   31581,   8740,  31554,   8836,  31527,   8933,  31499,   9030,
+   31471,   9127,  31443,   9223,  31415,   9319,  31386,   9416,
+   31357,   9512,  31328,   9608,  31298,   9704,  31268,   9800,
+   31238,   9896,  31207,   9992,  31177,  10088,  31146,  10183,
+   31114,  10279,  31082,  10374,  31050,  10469,  31018,  10565,
+   30986,  10660,  30953,  10755,  30920,  10850,  30886,  10945,
+   30853,  11039,  30819,  11134,  30784,  11228,  30750,  11323,
+   30715,  11417,  30680,  11511,  30644,  11605,  30608,  11699,
+   30572,  11793,  30536,  11887,  30499,  11980,  30462,  12074,
+   30425,  12167,  30388,  12261,  30350,  12354,  30312,  12447,
+   30274,  12540,  30235,  12633,  30196,  12725,  30157,  12818,
+   30118,  12910,  30078,  13003,  30038,  13095,  29997,  13187,
+   29957,  13279,  29916,  13371,  29875,  13463,  29833,  13554,
+   29792,  13646,  29750,  13737,  29707,  13828,  29665,  13919,
+   29622,  14010,  29579,  14101,  29535,  14192,  29492,  14282,
+   29448,  14373,  29404,  14463,  29359,  14553,  29314,  14643,
+   29269,  14733,  29224,  14823,  29178,  14912,  29132,  15002,
+   29086,  15091,  29040,  15180,  28993,  15269,  28946,  15358,
+   28899,  15447,  28851,  15535,  28803,  15624,  28755,  15712,
+   28707,  15800,  28658,  15888,  28610,  15976,  28560,  16064,
+   28511,  16151,  28461,  16239,  28411,  16326,  28361,  16413,
+   28311,  16500,  28260,  16587,  28209,  16673,  28158,  16760,
+   28106,  16846,  28054,  16932,  28002,  17018,  27950,  17104,
+   27897,  17190,  27844,  17275,  27791,  17361,  27738,  17446,
+   27684,  17531,  27630,  17616,  27576,  17700,  27522,  17785,
+   27467,  17869,  27412,  17953,  27357,  18037,  27301,  18121,
+   27246,  18205,  27190,  18288,  27133,  18372,  27077,  18455,
+   27020,  18538,  26963,  18621,  26906,  18703,  26848,  18786,
+   26791,  18868,  26733,  18950,  26674,  19032,  26616,  19114,
+   26557,  19195,  26498,  19277,  26439,  19358,  26379,  19439,
+   26320,  19520,  26259,  19601,  26199,  19681,  26139,  19761,
+   26078,  19841,  26017,  19921,  25956,  20001,  25894,  20081,
+   25833,  20160,  25771,  20239,  25708,  20318,  25646,  20397,
+   25583,  20475,  25520,  20554,  25457,  20632,  25394,  20710,
+   25330,  20788,  25266,  20865,  25202,  20943,  25138,  21020,
+   25073,  21097,  25008,  21174,  24943,  21251,  24878,  21327,
+   24812,  21403,  24746,  21479,  24680,  21555,  24614,  21631,
+   24548,  21706,  24481,  21781,  24414,  21856,  24347,  21931,
+   24279,  22006,  24212,  22080,  24144,  22154,  24076,  22228,
+   24008,  22302,  23939,  22375,  23870,  22449,  23801,  22522,
+   23732,  22595,  23663,  22668,  23593,  22740,  23523,  22812,
+   23453,  22884,  23383,  22956,  23312,  23028,  23241,  23099,
+   23170,  23170,  23099,  23241,  23028,  23312,  22956,  23383,
+   22884,  23453,  22812,  23523,  22740,  23593,  22668,  23663,
+   22595,  23732,  22522,  23801,  22449,  23870,  22375,  23939,
+   22302,  24008,  22228,  24076,  22154,  24144,  22080,  24212,
+   22006,  24279,  21931,  24347,  21856,  24414,  21781,  24481,
+   21706,  24548,  21631,  24614,  21555,  24680,  21479,  24746,
+   21403,  24812,  21327,  24878,  21251,  24943,  21174,  25008,
+   21097,  25073,  21020,  25138,  20943,  25202,  20865,  25266,
+   20788,  25330,  20710,  25394,  20632,  25457,  20554,  25520,
+   20475,  25583,  20397,  25646,  20318,  25708,  20239,  25771,
+   20160,  25833,  20081,  25894,  20001,  25956,  19921,  26017,
+   19841,  26078,  19761,  26139,  19681,  26199,  19601,  26259,
+   19520,  26320,  19439,  26379,  19358,  26439,  19277,  26498,
+   19195,  26557,  19114,  26616,  19032,  26674,  18950,  26733,
+   18868,  26791,  18786,  26848,  18703,  26906,  18621,  26963,
+   18538,  27020,  18455,  27077,  18372,  27133,  18288,  27190,
+   18205,  27246,  18121,  27301,  18037,  27357,  17953,  27412,
+   17869,  27467,  17785,  27522,  17700,  27576,  17616,  27630,
+   17531,  27684,  17446,  27738,  17361,  27791,  17275,  27844,
+   17190,  27897,  17104,  27950,  17018,  28002,  16932,  28054,
+   16846,  28106,  16760,  28158,  16673,  28209,  16587,  28260,
+   16500,  28311,  16413,  28361,  16326,  28411,  16239,  28461,
+   16151,  28511,  16064,  28560,  15976,  28610,  15888,  28658,
+   15800,  28707,  15712,  28755,  15624,  28803,  15535,  28851,
+   15447,  28899,  15358,  28946,  15269,  28993,  15180,  29040,
+   15091,  29086,  15002,  29132,  14912,  29178,  14823,  29224,
+   14733,  29269,  14643,  29314,  14553,  29359,  14463,  29404,
+   14373,  29448,  14282,  29492,  14192,  29535,  14101,  29579,
+   14010,  29622,  13919,  29665,  13828,  29707,  13737,  29750,
+   13646,  29792,  13554,  29833,  13463,  29875,  13371,  29916,
+   13279,  29957,  13187,  29997,  13095,  30038,  13003,  30078,
+   12910,  30118,  12818,  30157,  12725,  30196,  12633,  30235,
+   12540,  30274,  12447,  30312,  12354,  30350,  12261,  30388,
+   12167,  30425,  12074,  30462,  11980,  30499,  11887,  30536,
+   11793,  30572,  11699,  30608,  11605,  30644,  11511,  30680,
+   11417,  30715,  11323,  30750,  11228,  30784,  11134,  30819,
+   11039,  30853,  10945,  30886,  10850,  30920,  10755,  30953,
+   10660,  30986,  10565,  31018,  10469,  31050,  10374,  31082,
+   10279,  31114,  10183,  31146,  10088,  31177,   9992,  31207,
+    9896,  31238,   9800,  31268,   9704,  31298,   9608,  31328,
+    9512,  31357,   9416,  31386,   9319,  31415,   9223,  31443,
+    9127,  31471,   9030,  31499,   8933,  31527,   8836,  31554,
+    8740,  31581,   8643,  31608,   8546,  31634,   8449,  31660,
+    8351,  31686,   8254,  31711,   8157,  31737,   8059,  31761,
+    7962,  31786,   7864,  31810,   7767,  31834,   7669,  31858,
+    7571,  31881,   7473,  31904,   7376,  31927,   7278,  31950,
+    7180,  31972,   7081,  31994,   6983,  32015,   6885,  32037,
+    6787,  32058,   6688,  32078,   6590,  32099,   6491,  32119,
+    6393,  32138,   6294,  32158,   6195,  32177,   6097,  32196,
+    5998,  32214,   5899,  32233,   5800,  32251,   5701,  32268,
+    5602,  32286,   5503,  32303,   5404,  32319,   5305,  32336,
+    5205,  32352,   5106,  32368,   5007,  32383,   4907,  32398,
+    4808,  32413,   4709,  32428,   4609,  32442,   4510,  32456,
+    4410,  32470,   4310,  32483,   4211,  32496,   4111,  32509,
+    4011,  32522,   3911,  32534,   3812,  32546,   3712,  32557,
+    3612,  32568,   3512,  32579,   3412,  32590,   3312,  32600,
+    3212,  32610,   3112,  32620,   3012,  32629,   2912,  32638,
+    2811,  32647,   2711,  32656,   2611,  32664,   2511,  32672,
+    2411,  32679,   2310,  32686,   2210,  32693,   2110,  32700,
+    2009,  32706,   1909,  32712,   1809,  32718,   1708,  32723,
+    1608,  32729,   1507,  32733,   1407,  32738,   1307,  32742,
+    1206,  32746,   1106,  32749,   1005,  32753,    905,  32756,
+     804,  32758,    704,  32760,    603,  32762,    503,  32764,
+     402,  32766,    302,  32767,    201,  32767,    101,  32767,
+       0,  32767,   -101,  32767,   -201,  32767,   -302,  32767,
+    -402,  32766,   -503,  32764,   -603,  32762,   -704,  32760,
+    -804,  32758,   -905,  32756,  -1005,  32753,  -1106,  32749,
+   -1206,  32746,  -1307,  32742,  -1407,  32738,  -1507,  32733,
+   -1608,  32729,  -1708,  32723,  -1809,  32718,  -1909,  32712,
+   -2009,  32706,  -2110,  32700,  -2210,  32693,  -2310,  32686,
+   -2411,  32679,  -2511,  32672,  -2611,  32664,  -2711,  32656,
+   -2811,  32647,  -2912,  32638,  -3012,  32629,  -3112,  32620,
+   -3212,  32610,  -3312,  32600,  -3412,  32590,  -3512,  32579,
+   -3612,  32568,  -3712,  32557,  -3812,  32546,  -3911,  32534,
+   -4011,  32522,  -4111,  32509,  -4211,  32496,  -4310,  32483,
+   -4410,  32470,  -4510,  32456,  -4609,  32442,  -4709,  32428,
+   -4808,  32413,  -4907,  32398,  -5007,  32383,  -5106,  32368,
+   -5205,  32352,  -5305,  32336,  -5404,  32319,  -5503,  32303,
+   -5602,  32286,  -5701,  32268,  -5800,  32251,  -5899,  32233,
+   -5998,  32214,  -6097,  32196,  -6195,  32177,  -6294,  32158,
+   -6393,  32138,  -6491,  32119,  -6590,  32099,  -6688,  32078,
+   -6787,  32058,  -6885,  32037,  -6983,  32015,  -7081,  31994,
+   -7180,  31972,  -7278,  31950,  -7376,  31927,  -7473,  31904,
+   -7571,  31881,  -7669,  31858,  -7767,  31834,  -7864,  31810,
+   -7962,  31786,  -8059,  31761,  -8157,  31737,  -8254,  31711,
+   -8351,  31686,  -8449,  31660,  -8546,  31634,  -8643,  31608,
+   -8740,  31581,  -8836,  31554,  -8933,  31527,  -9030,  31499,
+   -9127,  31471,  -9223,  31443,  -9319,  31415,  -9416,  31386,
+   -9512,  31357,  -9608,  31328,  -9704,  31298,  -9800,  31268,
+   -9896,  31238,  -9992,  31207, -10088,  31177, -10183,  31146,
+  -10279,  31114, -10374,  31082, -10469,  31050, -10565,  31018,
+  -10660,  30986, -10755,  30953, -10850,  30920, -10945,  30886,
+  -11039,  30853, -11134,  30819, -11228,  30784, -11323,  30750,
+  -11417,  30715, -11511,  30680, -11605,  30644, -11699,  30608,
+  -11793,  30572, -11887,  30536, -11980,  30499, -12074,  30462,
+  -12167,  30425, -12261,  30388, -12354,  30350, -12447,  30312,
+  -12540,  30274, -12633,  30235, -12725,  30196, -12818,  30157,
+  -12910,  30118, -13003,  30078, -13095,  30038, -13187,  29997,
+  -13279,  29957, -13371,  29916, -13463,  29875, -13554,  29833,
+  -13646,  29792, -13737,  29750, -13828,  29707, -13919,  29665,
+  -14010,  29622, -14101,  29579, -14192,  29535, -14282,  29492,
+  -14373,  29448, -14463,  29404, -14553,  29359, -14643,  29314,
+  -14733,  29269, -14823,  29224, -14912,  29178, -15002,  29132,
+  -15091,  29086, -15180,  29040, -15269,  28993, -15358,  28946,
+  -15447,  28899, -15535,  28851, -15624,  28803, -15712,  28755,
+  -15800,  28707, -15888,  28658, -15976,  28610, -16064,  28560,
+  -16151,  28511, -16239,  28461, -16326,  28411, -16413,  28361,
+  -16500,  28311, -16587,  28260, -16673,  28209, -16760,  28158,
+  -16846,  28106, -16932,  28054, -17018,  28002, -17104,  27950,
+  -17190,  27897, -17275,  27844, -17361,  27791, -17446,  27738,
+  -17531,  27684, -17616,  27630, -17700,  27576, -17785,  27522,
+  -17869,  27467, -17953,  27412, -18037,  27357, -18121,  27301,
+  -18205,  27246, -18288,  27190, -18372,  27133, -18455,  27077,
+  -18538,  27020, -18621,  26963, -18703,  26906, -18786,  26848,
+  -18868,  26791, -18950,  26733, -19032,  26674, -19114,  26616,
+  -19195,  26557, -19277,  26498, -19358,  26439, -19439,  26379,
+  -19520,  26320, -19601,  26259, -19681,  26199, -19761,  26139,
+  -19841,  26078, -19921,  26017, -20001,  25956, -20081,  25894,
+  -20160,  25833, -20239,  25771, -20318,  25708, -20397,  25646,
+  -20475,  25583, -20554,  25520, -20632,  25457, -20710,  25394,
+  -20788,  25330, -20865,  25266, -20943,  25202, -21020,  25138,
+  -21097,  25073, -21174,  25008, -21251,  24943, -21327,  24878,
+  -21403,  24812, -21479,  24746, -21555,  24680, -21631,  24614,
+  -21706,  24548, -21781,  24481, -21856,  24414, -21931,  24347,
+  -22006,  24279, -22080,  24212, -22154,  24144, -22228,  24076,
+  -22302,  24008, -22375,  23939, -22449,  23870, -22522,  23801,
+  -22595,  23732, -22668,  23663, -22740,  23593, -22812,  23523,
+  -22884,  23453, -22956,  23383, -23028,  23312, -23099,  23241,
+  -23170,  23170, -23241,  23099, -23312,  23028, -23383,  22956,
+  -23453,  22884, -23523,  22812, -23593,  22740, -23663,  22668,
+  -23732,  22595, -23801,  22522, -23870,  22449, -23939,  22375,
+  -24008,  22302, -24076,  22228, -24144,  22154, -24212,  22080,
+  -24279,  22006, -24347,  21931, -24414,  21856, -24481,  21781,
+  -24548,  21706, -24614,  21631, -24680,  21555, -24746,  21479,
+  -24812,  21403, -24878,  21327, -24943,  21251, -25008,  21174,
+  -25073,  21097, -25138,  21020, -25202,  20943, -25266,  20865,
+  -25330,  20788, -25394,  20710, -25457,  20632, -25520,  20554,
+  -25583,  20475, -25646,  20397, -25708,  20318, -25771,  20239,
+  -25833,  20160, -25894,  20081, -25956,  20001, -26017,  19921,
+  -26078,  19841, -26139,  19761, -26199,  19681, -26259,  19601,
+  -26320,  19520, -26379,  19439, -26439,  19358, -26498,  19277,
+  -26557,  19195, -26616,  19114, -26674,  19032, -26733,  18950,
+  -26791,  18868, -26848,  18786, -26906,  18703, -26963,  18621,
+  -27020,  18538, -27077,  18455, -27133,  18372, -27190,  18288,
+  -27246,  18205, -27301,  18121, -27357,  18037, -27412,  17953,
+  -27467,  17869, -27522,  17785, -27576,  17700, -27630,  17616,
+  -27684,  17531, -27738,  17446, -27791,  17361, -27844,  17275,
+  -27897,  17190, -27950,  17104, -28002,  17018, -28054,  16932,
+  -28106,  16846, -28158,  16760, -28209,  16673, -28260,  16587,
+  -28311,  16500, -28361,  16413, -28411,  16326, -28461,  16239,
+  -28511,  16151, -28560,  16064, -28610,  15976, -28658,  15888,
+  -28707,  15800, -28755,  15712, -28803,  15624, -28851,  15535,
+  -28899,  15447, -28946,  15358, -28993,  15269, -29040,  15180,
+  -29086,  15091, -29132,  15002, -29178,  14912, -29224,  14823,
+  -29269,  14733, -29314,  14643, -29359,  14553, -29404,  14463,
+  -29448,  14373, -29492,  14282, -29535,  14192, -29579,  14101,
+  -29622,  14010, -29665,  13919, -29707,  13828, -29750,  13737,
+  -29792,  13646, -29833,  13554, -29875,  13463, -29916,  13371,
+  -29957,  13279, -29997,  13187, -30038,  13095, -30078,  13003,
+  -30118,  12910, -30157,  12818, -30196,  12725, -30235,  12633,
+  -30274,  12540, -30312,  12447, -30350,  12354, -30388,  12261,
+  -30425,  12167, -30462,  12074, -30499,  11980, -30536,  11887,
+  -30572,  11793, -30608,  11699, -30644,  11605, -30680,  11511,
+  -30715,  11417, -30750,  11323, -30784,  11228, -30819,  11134,
+  -30853,  11039, -30886,  10945, -30920,  10850, -30953,  10755,
+  -30986,  10660, -31018,  10565, -31050,  10469, -31082,  10374,
+  -31114,  10279, -31146,  10183, -31177,  10088, -31207,   9992,
+  -31238,   9896, -31268,   9800, -31298,   9704, -31328,   9608,
+  -31357,   9512, -31386,   9416, -31415,   9319, -31443,   9223,
+  -31471,   9127, -31499,   9030, -31527,   8933, -31554,   8836,
+  -31581,   8740, -31608,   8643, -31634,   8546, -31660,   8449,
+  -31686,   8351, -31711,   8254, -31737,   8157, -31761,   8059,
+  -31786,   7962, -31810,   7864, -31834,   7767, -31858,   7669,
+  -31881,   7571, -31904,   7473, -31927,   7376, -31950,   7278,
+  -31972,   7180, -31994,   7081, -32015,   6983, -32037,   6885,
+  -32058,   6787, -32078,   6688, -32099,   6590, -32119,   6491,
+  -32138,   6393, -32158,   6294, -32177,   6195, -32196,   6097,
+  -32214,   5998, -32233,   5899, -32251,   5800, -32268,   5701,
+  -32286,   5602, -32303,   5503, -32319,   5404, -32336,   5305,
+  -32352,   5205, -32368,   5106, -32383,   5007, -32398,   4907,
+  -32413,   4808, -32428,   4709, -32442,   4609, -32456,   4510,
+  -32470,   4410, -32483,   4310, -32496,   4211, -32509,   4111,
+  -32522,   4011, -32534,   3911, -32546,   3812, -32557,   3712,
+  -32568,   3612, -32579,   3512, -32590,   3412, -32600,   3312,
+  -32610,   3212, -32620,   3112, -32629,   3012, -32638,   2912,
+  -32647,   2811, -32656,   2711, -32664,   2611, -32672,   2511,
+  -32679,   2411, -32686,   2310, -32693,   2210, -32700,   2110,
+  -32706,   2009, -32712,   1909, -32718,   1809, -32723,   1708,
+  -32729,   1608, -32733,   1507, -32738,   1407, -32742,   1307,
+  -32746,   1206, -32749,   1106, -32753,   1005, -32756,    905,
+  -32758,    804, -32760,    704, -32762,    603, -32764,    503,
+  -32766,    402, -32767,    302, -32767,    201, -32768,    101,
+  -32768,      0, -32768,   -101, -32767,   -201, -32767,   -302,
+  -32766,   -402, -32764,   -503, -32762,   -603, -32760,   -704,
+  -32758,   -804, -32756,   -905, -32753,  -1005, -32749,  -1106,
+  -32746,  -1206, -32742,  -1307, -32738,  -1407, -32733,  -1507,
+  -32729,  -1608, -32723,  -1708, -32718,  -1809, -32712,  -1909,
+  -32706,  -2009, -32700,  -2110, -32693,  -2210, -32686,  -2310,
+  -32679,  -2411, -32672,  -2511, -32664,  -2611, -32656,  -2711,
+  -32647,  -2811, -32638,  -2912, -32629,  -3012, -32620,  -3112,
+  -32610,  -3212, -32600,  -3312, -32590,  -3412, -32579,  -3512,
+  -32568,  -3612, -32557,  -3712, -32546,  -3812, -32534,  -3911,
+  -32522,  -4011, -32509,  -4111, -32496,  -4211, -32483,  -4310,
+  -32470,  -4410, -32456,  -4510, -32442,  -4609, -32428,  -4709,
+  -32413,  -4808, -32398,  -4907, -32383,  -5007, -32368,  -5106,
+  -32352,  -5205, -32336,  -5305, -32319,  -5404, -32303,  -5503,
+  -32286,  -5602, -32268,  -5701, -32251,  -5800, -32233,  -5899,
+  -32214,  -5998, -32196,  -6097, -32177,  -6195, -32158,  -6294,
+  -32138,  -6393, -32119,  -6491, -32099,  -6590, -32078,  -6688,
+  -32058,  -6787, -32037,  -6885, -32015,  -6983, -31994,  -7081,
+  -31972,  -7180, -31950,  -7278, -31927,  -7376, -31904,  -7473,
+  -31881,  -7571, -31858,  -7669, -31834,  -7767, -31810,  -7864,
+  -31786,  -7962, -31761,  -8059, -31737,  -8157, -31711,  -8254,
+  -31686,  -8351, -31660,  -8449, -31634,  -8546, -31608,  -8643,
+  -31581,  -8740, -31554,  -8836, -31527,  -8933, -31499,  -9030,
+  -31471,  -9127, -31443,  -9223, -31415,  -9319, -31386,  -9416,
+  -31357,  -9512, -31328,  -9608, -31298,  -9704, -31268,  -9800,
+  -31238,  -9896, -31207,  -9992, -31177, -10088, -31146, -10183,
+  -31114, -10279, -31082, -10374, -31050, -10469, -31018, -10565,
+  -30986, -10660, -30953, -10755, -30920, -10850, -30886, -10945,
+  -30853, -11039, -30819, -11134, -30784, -11228, -30750, -11323,
+  -30715, -11417, -30680, -11511, -30644, -11605, -30608, -11699,
+  -30572, -11793, -30536, -11887, -30499, -11980, -30462, -12074,
+  -30425, -12167, -30388, -12261, -30350, -12354, -30312, -12447,
+  -30274, -12540, -30235, -12633, -30196, -12725, -30157, -12818,
+  -30118, -12910, -30078, -13003, -30038, -13095, -29997, -13187,
+  -29957, -13279, -29916, -13371, -29875, -13463, -29833, -13554,
+  -29792, -13646, -29750, -13737, -29707, -13828, -29665, -13919,
+  -29622, -14010, -29579, -14101, -29535, -14192, -29492, -14282,
+  -29448, -14373, -29404, -14463, -29359, -14553, -29314, -14643,
+  -29269, -14733, -29224, -14823, -29178, -14912, -29132, -15002,
+  -29086, -15091, -29040, -15180, -28993, -15269, -28946, -15358,
+  -28899, -15447, -28851, -15535, -28803, -15624, -28755, -15712,
+  -28707, -15800, -28658, -15888, -28610, -15976, -28560, -16064,
+  -28511, -16151, -28461, -16239, -28411, -16326, -28361, -16413,
+  -28311, -16500, -28260, -16587, -28209, -16673, -28158, -16760,
+  -28106, -16846, -28054, -16932, -28002, -17018, -27950, -17104,
+  -27897, -17190, -27844, -17275, -27791, -17361, -27738, -17446,
+  -27684, -17531, -27630, -17616, -27576, -17700, -27522, -17785,
+  -27467, -17869, -27412, -17953, -27357, -18037, -27301, -18121,
+  -27246, -18205, -27190, -18288, -27133, -18372, -27077, -18455,
+  -27020, -18538, -26963, -18621, -26906, -18703, -26848, -18786,
+  -26791, -18868, -26733, -18950, -26674, -19032, -26616, -19114,
+  -26557, -19195, -26498, -19277, -26439, -19358, -26379, -19439,
+  -26320, -19520, -26259, -19601, -26199, -19681, -26139, -19761,
+  -26078, -19841, -26017, -19921, -25956, -20001, -25894, -20081,
+  -25833, -20160, -25771, -20239, -25708, -20318, -25646, -20397,
+  -25583, -20475, -25520, -20554, -25457, -20632, -25394, -20710,
+  -25330, -20788, -25266, -20865, -25202, -20943, -25138, -21020,
+  -25073, -21097, -25008, -21174, -24943, -21251, -24878, -21327,
+  -24812, -21403, -24746, -21479, -24680, -21555, -24614, -21631,
+  -24548, -21706, -24481, -21781, -24414, -21856, -24347, -21931,
+  -24279, -22006, -24212, -22080, -24144, -22154, -24076, -22228,
+  -24008, -22302, -23939, -22375, -23870, -22449, -23801, -22522,
+  -23732, -22595, -23663, -22668, -23593, -22740, -23523, -22812,
+  -23453, -22884, -23383, -22956, -23312, -23028, -23241, -23099,
+  -23170, -23170, -23099, -23241, -23028, -23312, -22956, -23383,
+  -22884, -23453, -22812, -23523, -22740, -23593, -22668, -23663,
+  -22595, -23732, -22522, -23801, -22449, -23870, -22375, -23939,
+  -22302, -24008, -22228, -24076, -22154, -24144, -22080, -24212,
+  -22006, -24279, -21931, -24347, -21856, -24414, -21781, -24481,
+  -21706, -24548, -21631, -24614, -21555, -24680, -21479, -24746,
+  -21403, -24812, -21327, -24878, -21251, -24943, -21174, -25008,
+  -21097, -25073, -21020, -25138, -20943, -25202, -20865, -25266,
+  -20788, -25330, -20710, -25394, -20632, -25457, -20554, -25520,
+  -20475, -25583, -20397, -25646, -20318, -25708, -20239, -25771,
+  -20160, -25833, -20081, -25894, -20001, -25956, -19921, -26017,
+  -19841, -26078, -19761, -26139, -19681, -26199, -19601, -26259,
+  -19520, -26320, -19439, -26379, -19358, -26439, -19277, -26498,
+  -19195, -26557, -19114, -26616, -19032, -26674, -18950, -26733,
+  -18868, -26791, -18786, -26848, -18703, -26906, -18621, -26963,
+  -18538, -27020, -18455, -27077, -18372, -27133, -18288, -27190,
+  -18205, -27246, -18121, -27301, -18037, -27357, -17953, -27412,
+  -17869, -27467, -17785, -27522, -17700, -27576, -17616, -27630,
+  -17531, -27684, -17446, -27738, -17361, -27791, -17275, -27844,
+  -17190, -27897, -17104, -27950, -17018, -28002, -16932, -28054,
+  -16846, -28106, -16760, -28158, -16673, -28209, -16587, -28260,
+  -16500, -28311, -16413, -28361, -16326, -28411, -16239, -28461,
+  -16151, -28511, -16064, -28560, -15976, -28610, -15888, -28658,
+  -15800, -28707, -15712, -28755, -15624, -28803, -15535, -28851,
+  -15447, -28899, -15358, -28946, -15269, -28993, -15180, -29040,
+  -15091, -29086, -15002, -29132, -14912, -29178, -14823, -29224,
+  -14733, -29269, -14643, -29314, -14553, -29359, -14463, -29404,
+  -14373, -29448, -14282, -29492, -14192, -29535, -14101, -29579,
+  -14010, -29622, -13919, -29665, -13828, -29707, -13737, -29750,
+  -13646, -29792, -13554, -29833, -13463, -29875, -13371, -29916,
+  -13279, -29957, -13187, -29997, -13095, -30038, -13003, -30078,
+  -12910, -30118, -12818, -30157, -12725, -30196, -12633, -30235,
+  -12540, -30274, -12447, -30312, -12354, -30350, -12261, -30388,
+  -12167, -30425, -12074, -30462, -11980, -30499, -11887, -30536,
+  -11793, -30572, -11699, -30608, -11605, -30644, -11511, -30680,
+  -11417, -30715, -11323, -30750, -11228, -30784, -11134, -30819,
+  -11039, -30853, -10945, -30886, -10850, -30920, -10755, -30953,
+  -10660, -30986, -10565, -31018, -10469, -31050, -10374, -31082,
+  -10279, -31114, -10183, -31146, -10088, -31177,  -9992, -31207,
+   -9896, -31238,  -9800, -31268,  -9704, -31298,  -9608, -31328,
+   -9512, -31357,  -9416, -31386,  -9319, -31415,  -9223, -31443,
+   -9127, -31471,  -9030, -31499,  -8933, -31527,  -8836, -31554,
+   -8740, -31581,  -8643, -31608,  -8546, -31634,  -8449, -31660,
+   -8351, -31686,  -8254, -31711,  -8157, -31737,  -8059, -31761,
+   -7962, -31786,  -7864, -31810,  -7767, -31834,  -7669, -31858,
+   -7571, -31881,  -7473, -31904,  -7376, -31927,  -7278, -31950,
+   -7180, -31972,  -7081, -31994,  -6983, -32015,  -6885, -32037,
+   -6787, -32058,  -6688, -32078,  -6590, -32099,  -6491, -32119,
+   -6393, -32138,  -6294, -32158,  -6195, -32177,  -6097, -32196,
+   -5998, -32214,  -5899, -32233,  -5800, -32251,  -5701, -32268,
+   -5602, -32286,  -5503, -32303,  -5404, -32319,  -5305, -32336,
+   -5205, -32352,  -5106, -32368,  -5007, -32383,  -4907, -32398,
+   -4808, -32413,  -4709, -32428,  -4609, -32442,  -4510, -32456,
+   -4410, -32470,  -4310, -32483,  -4211, -32496,  -4111, -32509,
+   -4011, -32522,  -3911, -32534,  -3812, -32546,  -3712, -32557,
+   -3612, -32568,  -3512, -32579,  -3412, -32590,  -3312, -32600,
+   -3212, -32610,  -3112, -32620,  -3012, -32629,  -2912, -32638,
+   -2811, -32647,  -2711, -32656,  -2611, -32664,  -2511, -32672,
+   -2411, -32679,  -2310, -32686,  -2210, -32693,  -2110, -32700,
+   -2009, -32706,  -1909, -32712,  -1809, -32718,  -1708, -32723,
+   -1608, -32729,  -1507, -32733,  -1407, -32738,  -1307, -32742,
+   -1206, -32746,  -1106, -32749,  -1005, -32753,   -905, -32756,
+    -804, -32758,   -704, -32760,   -603, -32762,   -503, -32764,
+    -402, -32766,   -302, -32767,   -201, -32767,   -101, -32768,
+};
+
+const uint16_t fft_bitrev[1024] =
+{
+     0,  512,  256,  768,  128,  640,  384,  896,   64,  576,  320,  832,
+   192,  704,  448,  960,   32,  544,  288,  800,  160,  672,  416,  928,
+    96,  608,  352,  864,  224,  736,  480,  992,   16,  528,  272,  784,
+   144,  656,  400,  912,   80,  592,  336,  848,  208,  720,  464,  976,
+    48,  560,  304,  816,  176,  688,  432,  944,  112,  624,  368,  880,
+   240,  752,  496, 1008,    8,  520,  264,  776,  136,  648,  392,  904,
+    72,  584,  328,  840,  200,  712,  456,  968,   40,  552,  296,  808,
+   168,  680,  424,  936,  104,  616,  360,  872,  232,  744,  488, 1000,
+    24,  536,  280,  792,  152,  664,  408,  920,   88,  600,  344,  856,
+   216,  728,  472,  984,   56,  568,  312,  824,  184,  696,  440,  952,
+   120,  632,  376,  888,  248,  760,  504, 1016,    4,  516,  260,  772,
+   132,  644,  388,  900,   68,  580,  324,  836,  196,  708,  452,  964,
+    36,  548,  292,  804,  164,  676,  420,  932,  100,  612,  356,  868,
+   228,  740,  484,  996,   20,  532,  276,  788,  148,  660,  404,  916,
+    84,  596,  340,  852,  212,  724,  468,  980,   52,  564,  308,  820,
+   180,  692,  436,  948,  116,  628,  372,  884,  244,  756,  500, 1012,
+    12,  524,  268,  780,  140,  652,  396,  908,   76,  588,  332,  844,
+   204,  716,  460,  972,   44,  556,  300,  812,  172,  684,  428,  940,
+   108,  620,  364,  876,  236,  748,  492, 1004,   28,  540,  284,  796,
+   156,  668,  412,  924,   92,  604,  348,  860,  220,  732,  476,  988,
+    60,  572,  316,  828,  188,  700,  444,  956,  124,  636,  380,  892,
+   252,  764,  508, 1020,    2,  514,  258,  770,  130,  642,  386,  898,
+    66,  578,  322,  834,  194,  706,  450,  962,   34,  546,  290,  802,
+   162,  674,  418,  930,   98,  610,  354,  866,  226,  738,  482,  994,
+    18,  530,  274,  786,  146,  658,  402,  914,   82,  594,  338,  850,
+   210,  722,  466,  978,   50,  562,  306,  818,  178,  690,  434,  946,
+   114,  626,  370,  882,  242,  754,  498, 1010,   10,  522,  266,  778,
+   138,  650,  394,  906,   74,  586,  330,  842,  202,  714,  458,  970,
+    42,  554,  298,  810,  170,  682,  426,  938,  106,  618,  362,  874,
+   234,  746,  490, 1002,   26,  538,  282,  794,  154,  666,  410,  922,
+    90,  602,  346,  858,  218,  730,  474,  986,   58,  570,  314,  826,
+   186,  698,  442,  954,  122,  634,  378,  890,  250,  762,  506, 1018,
+     6,  518,  262,  774,  134,  646,  390,  902,   70,  582,  326,  838,
+   198,  710,  454,  966,   38,  550,  294,  806,  166,  678,  422,  934,
+   102,  614,  358,  870,  230,  742,  486,  998,   22,  534,  278,  790,
+   150,  662,  406,  918,   86,  598,  342,  854,  214,  726,  470,  982,
+    54,  566,  310,  822,  182,  694,  438,  950,  118,  630,  374,  886,
+   246,  758,  502, 1014,   14,  526,  270,  782,  142,  654,  398,  910,
+    78,  590,  334,  846,  206,  718,  462,  974,   46,  558,  302,  814,
+   174,  686,  430,  942,  110,  622,  366,  878,  238,  750,  494, 1006,
+    30,  542,  286,  798,  158,  670,  414,  926,   94,  606,  350,  862,
+   222,  734,  478,  990,   62,  574,  318,  830,  190,  702,  446,  958,
+   126,  638,  382,  894,  254,  766,  510, 1022,    1,  513,  257,  769,
+   129,  641,  385,  897,   65,  577,  321,  833,  193,  705,  449,  961,
+    33,  545,  289,  801,  161,  673,  417,  929,   97,  609,  353,  865,
+   225,  737,  481,  993,   17,  529,  273,  785,  145,  657,  401,  913,
+    81,  593,  337,  849,  209,  721,  465,  977,   49,  561,  305,  817,
+   177,  689,  433,  945,  113,  625,  369,  881,  241,  753,  497, 1009,
+     9,  521,  265,  777,  137,  649,  393,  905,   73,  585,  329,  841,
+   201,  713,  457,  969,   41,  553,  297,  809,  169,  681,  425,  937,
+   105,  617,  361,  873,  233,  745,  489, 1001,   25,  537,  281,  793,
+   153,  665,  409,  921,   89,  601,  345,  857,  217,  729,  473,  985,
+    57,  569,  313,  825,  185,  697,  441,  953,  121,  633,  377,  889,
+   249,  761,  505, 1017,    5,  517,  261,  773,  133,  645,  389,  901,
+    69,  581,  325,  837,  197,  709,  453,  965,   37,  549,  293,  805,
+   165,  677,  421,  933,  101,  613,  357,  869,  229,  741,  485,  997,
+    21,  533,  277,  789,  149,  661,  405,  917,   85,  597,  341,  853,
+   213,  725,  469,  981,   53,  565,  309,  821,  181,  693,  437,  949,
+   117,  629,  373,  885,  245,  757,  501, 1013,   13,  525,  269,  781,
+   141,  653,  397,  909,   77,  589,  333,  845,  205,  717,  461,  973,
+    45,  557,  301,  813,  173,  685,  429,  941,  109,  621,  365,  877,
+   237,  749,  493, 1005,   29,  541,  285,  797,  157,  669,  413,  925,
+    93,  605,  349,  861,  221,  733,  477,  989,   61,  573,  317,  829,
+   189,  701,  445,  957,  125,  637,  381,  893,  253,  765,  509, 1021,
+     3,  515,  259,  771,  131,  643,  387,  899,   67,  579,  323,  835,
+   195,  707,  451,  963,   35,  547,  291,  803,  163,  675,  419,  931,
+    99,  611,  355,  867,  227,  739,  483,  995,   19,  531,  275,  787,
+   147,  659,  403,  915,   83,  595,  339,  851,  211,  723,  467,  979,
+    51,  563,  307,  819,  179,  691,  435,  947,  115,  627,  371,  883,
+   243,  755,  499, 1011,   11,  523,  267,  779,  139,  651,  395,  907,
+    75,  587,  331,  843,  203,  715,  459,  971,   43,  555,  299,  811,
+   171,  683,  427,  939,  107,  619,  363,  875,  235,  747,  491, 1003,
+    27,  539,  283,  795,  155,  667,  411,  923,   91,  603,  347,  859,
+   219,  731,  475,  987,   59,  571,  315,  827,  187,  699,  443,  955,
+   123,  635,  379,  891,  251,  763,  507, 1019,    7,  519,  263,  775,
+   135,  647,  391,  903,   71,  583,  327,  839,  199,  711,  455,  967,
+    39,  551,  295,  807,  167,  679,  423,  935,  103,  615,  359,  871,
+   231,  743,  487,  999,   23,  535,  279,  791,  151,  663,  407,  919,
+    87,  599,  343,  855,  215,  727,  471,  983,   55,  567,  311,  823,
+   183,  695,  439,  951,  119,  631,  375,  887,  247,  759,  503, 1015,
+    15,  527,  271,  783,  143,  655,  399,  911,   79,  591,  335,  847,
+   207,  719,  463,  975,   47,  559,  303,  815,  175,  687,  431,  943,
+   111,  623,  367,  879,  239,  751,  495, 1007,   31,  543,  287,  799,
+   159,  671,  415,  927,   95,  607,  351,  863,  223,  735,  479,  991,
+    63,  575,  319,  831,  191,  703,  447,  959,  127,  639,  383,  895,
+   255,  767,  511, 1023,
+};
+
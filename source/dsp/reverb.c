@@ -0,0 +1,148 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "dae.h"
+#include "reverb.h"
+#include "sections.h"
+#include "trace.h"
+
+/* Input gain into the combs, their sum is about 1/(1-feedback) louder */
+#define REVERB_INPUT_GAIN (0.015f)
+
+/* Allpass feedback */
+#define REVERB_ALLPASS_GAIN (0.5f)
+
+/* Quiet blocks before going idle, longer than the longest line so a gap in it is not mistaken for the end */
+#define REVERB_HOLD_BLOCKS (16)
+
+/* Wet signal of the block being processed */
+static float wet[DAE_AUDIO_BLOCK_SIZE];
+
+/**
+ * reverb_init
+ * \brief initialises the reverb, silent and idle.
+ * \param reverb the reverb
+ * \param size room size 0-1, sets the decay time
+ * \param damping high frequency damping 0-1
+ */
+void reverb_init(reverb_t *reverb, float size, float damping)
+{
+  RTT_ASSERT(reverb != NULL);
+
+  static const size_t lengths[] = REVERB_COMB_LENGTHS;
+  static const size_t allpasses[] = REVERB_ALLPASS_LENGTHS;
+  float *line = reverb->buffer;
+
+  for (int i = 0; i < REVERB_COMBS + REVERB_ALLPASSES; i++)
+  {
+    reverb->length[i] = i < REVERB_COMBS ? lengths[i] : allpasses[i - REVERB_COMBS];
+    reverb->index[i] = 0;
+    reverb->line[i] = line;
+    line += reverb->length[i];
+  }
+
+  reverb->feedback = 0.7f + 0.28f * size;
+  reverb->damping = 0.4f * damping;
+  memset(reverb->store, 0, sizeof(reverb->store));
+  memset(reverb->buffer, 0, sizeof(reverb->buffer));
+  silence_tail_init(&reverb->tail, REVERB_HOLD_BLOCKS);
+}
+
+/**
+ * reverb_process
+ * \brief reverberates a block of the send bus, adding into the output.
+ * \param reverb the reverb
+ * \param in the send bus
+ * \param out the output, accumulated into
+ * \param n the number of samples
+ */
+RAMFUNC void reverb_process(reverb_t *reverb, const float *restrict in, float *restrict out, size_t n)
+{
+  RTT_ASSERT(n <= DAE_AUDIO_BLOCK_SIZE);
+
+  bool input_silent = silence_detect(in, n);
+
+  if (!silence_tail_input(&reverb->tail, input_silent))
+  {
+    return;
+  }
+
+  memset(wet, 0, n * sizeof(float));
+
+  /* One comb at a time over the block keeps its state in registers */
+  for (int c = 0; c < REVERB_COMBS; c++)
+  {
+    float *line = reverb->line[c];
+    size_t length = reverb->length[c];
+    size_t index = reverb->index[c];
+    float store = reverb->store[c];
+
+    for (size_t i = 0; i < n; i++)
+    {
+      float delayed = line[index];
+
+      store = delayed + (store - delayed) * reverb->damping;
+      line[index] = in[i] * REVERB_INPUT_GAIN + store * reverb->feedback;
+      wet[i] += delayed;
+
+      if (++index == length)
+      {
+        index = 0;
+      }
+    }
+
+    reverb->index[c] = index;
+    reverb->store[c] = store;
+  }
+
+  for (int a = REVERB_COMBS; a < REVERB_COMBS + REVERB_ALLPASSES; a++)
+  {
+    float *line = reverb->line[a];
+    size_t length = reverb->length[a];
+    size_t index = reverb->index[a];
+
+    for (size_t i = 0; i < n; i++)
+    {
+      float delayed = line[index];
+
+      line[index] = wet[i] + delayed * REVERB_ALLPASS_GAIN;
+      wet[i] = delayed - wet[i];
+
+      if (++index == length)
+      {
+        index = 0;
+      }
+    }
+
+    reverb->index[a] = index;
+  }
+
+  for (size_t i = 0; i < n; i++)
+  {
+    out[i] += wet[i];
+  }
+
+  if (silence_tail_output(&reverb->tail, input_silent, wet, n))
+  {
+    /* Clear the denormal-sized remains so the tail restarts from silence */
+    memset(reverb->store, 0, sizeof(reverb->store));
+    memset(reverb->buffer, 0, sizeof(reverb->buffer));
+  }
+}
+
+/**
+ * reverb_is_idle
+ * \brief true while the reverb is bypassed, its input and tail are silent.
+ * \param reverb the reverb
+ */
+bool reverb_is_idle(const reverb_t *reverb)
+{
+  return reverb->tail.idle;
+}
@@ -0,0 +1,57 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef REVERB_H
+#define REVERB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "silence.h"
+
+/*
+  Mono reverb, four damped feedback combs in parallel into two allpasses in
+  series (Schroeder, with the Freeverb tunings scaled to 48kHz).
+
+  It runs on a send bus, every part feeds it through its send level and it
+  is computed once per block whatever the number of parts. Once its input
+  is silent and the tail has decayed it goes idle and costs nothing.
+*/
+
+#define REVERB_COMBS (4)
+#define REVERB_ALLPASSES (2)
+
+/* Delay line lengths in samples, mutually prime */
+#define REVERB_COMB_LENGTHS {1213, 1291, 1389, 1475}
+#define REVERB_ALLPASS_LENGTHS {605, 479}
+#define REVERB_STORAGE (1213 + 1291 + 1389 + 1475 + 605 + 479)
+
+/* Estimated cost of a 128 sample block on the F411 */
+#ifndef REVERB_CYCLES
+#define REVERB_CYCLES (9000)
+#endif
+
+/* Reverb instance, large so declare it static */
+typedef struct
+{
+  float feedback;                   /* Comb feedback, sets the decay time */
+  float damping;                    /* Comb lowpass, 0 bright to 1 dark */
+  float store[REVERB_COMBS];        /* Comb lowpass state */
+  size_t length[REVERB_COMBS + REVERB_ALLPASSES];
+  size_t index[REVERB_COMBS + REVERB_ALLPASSES];
+  float *line[REVERB_COMBS + REVERB_ALLPASSES];
+  float buffer[REVERB_STORAGE];
+  silence_tail_t tail;
+} reverb_t;
+
+/* API */
+void reverb_init(reverb_t *reverb, float size, float damping);
+void reverb_process(reverb_t *reverb, const float *restrict in, float *restrict out, size_t n);
+bool reverb_is_idle(const reverb_t *reverb);
+
+#endif /* REVERB_H */
@@ -0,0 +1,117 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef SILENCE_H
+#define SILENCE_H
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Silence tracking so idle parts of the signal chain can skip their work.
+
+  Voices report idle from their amplitude envelope (env_is_idle()). Effects
+  with a tail (delay, reverb, convolution) keep producing output after their
+  input stops, they use a silence_tail_t to find out when the tail has decayed
+  below SILENCE_THRESHOLD and they can be bypassed until the input returns.
+  When the whole chain is silent dae_process_block() returns false and the DAE
+  skips the output conversion.
+*/
+
+/* Anything below -120dBFS counts as silence */
+#ifndef SILENCE_THRESHOLD
+#define SILENCE_THRESHOLD (1.0e-6f)
+#endif
+
+/* Tail tracker for an effect */
+typedef struct
+{
+  bool idle;           /* True when the effect can be bypassed */
+  uint32_t hold;       /* Quiet blocks required before going idle */
+  uint32_t quiet;      /* Consecutive blocks with silent input and output */
+} silence_tail_t;
+
+/**
+ * silence_detect
+ * \brief true if every sample in the buffer is below SILENCE_THRESHOLD.
+ * \param buf the samples
+ * \param n the number of samples
+ */
+static inline bool silence_detect(const float *buf, size_t n)
+{
+  float peak = 0.0f;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    peak = fmaxf(peak, fabsf(buf[i]));
+  }
+
+  return peak < SILENCE_THRESHOLD;
+}
+
+/**
+ * silence_tail_init
+ * \brief initialises a tail tracker.
+ * \param tail the tracker
+ * \param hold number of consecutive quiet blocks before the effect goes idle, this
+ *        covers effects whose output can be quiet mid-tail (e.g. a delay line gap)
+ */
+static inline void silence_tail_init(silence_tail_t *tail, uint32_t hold)
+{
+  tail->idle = true;
+  tail->hold = hold;
+  tail->quiet = hold;
+}
+
+/**
+ * silence_tail_input
+ * \brief call before processing, wakes the effect if the input is not silent.
+ * \param tail the tracker
+ * \param input_silent result of silence_detect() on the effect input
+ * \return true if the effect must process this block, false if it can be bypassed
+ */
+static inline bool silence_tail_input(silence_tail_t *tail, bool input_silent)
+{
+  if (!input_silent)
+  {
+    tail->idle = false;
+    tail->quiet = 0;
+  }
+
+  return !tail->idle;
+}
+
+/**
+ * silence_tail_output
+ * \brief call after processing with the effect output.
+ * \param tail the tracker
+ * \param input_silent result of silence_detect() on the effect input
+ * \param out the effect output
+ * \param n the number of samples
+ * \return true once the tail has decayed, the effect should then clear its state
+ */
+static inline bool silence_tail_output(silence_tail_t *tail, bool input_silent, const float *out, size_t n)
+{
+  if (input_silent && silence_detect(out, n))
+  {
+    if (++tail->quiet >= tail->hold)
+    {
+      tail->idle = true;
+    }
+  }
+  else
+  {
+    tail->quiet = 0;
+  }
+
+  return tail->idle;
+}
+
+#endif /* SILENCE_H */
@@ -13,6 +13,15 @@
 #include "trace.h"
 #include "ui.h"
 #include "dae.h"
+#include "bank.h"
+#include "patch.h"
+#include "synth.h"
+#ifdef RUN_TIME_STATS
+#include "stats.h"
+#endif
+#ifdef SYSVIEW_ENABLED
+#include "sysview.h"
+#endif
 
 
 /* Import the hardware initialisation function */
@@ -22,6 +31,11 @@ int main(void)
 {
     init();    
 
+#ifdef SYSVIEW_ENABLED
+    /* Before any task is created so the trace knows them all */
+    sysview_init();
+#endif
+
     if (!ui_start(tskIDLE_PRIORITY + 1))
     {
         RTT_LOG("UI task failed to start\n");
@@ -36,6 +50,36 @@ int main(void)
             ;
     }
 
+    if (!synth_start(tskIDLE_PRIORITY + 3))
+    {
+        RTT_LOG("SYNTH task failed to start\n");
+        while (1)
+            ;
+    }
+
+    if (!bank_start(tskIDLE_PRIORITY + 2))
+    {
+        RTT_LOG("BANK task failed to start\n");
+        while (1)
+            ;
+    }
+
+    if (!patch_start(tskIDLE_PRIORITY + 2))
+    {
+        RTT_LOG("PATCH task failed to start\n");
+        while (1)
+            ;
+    }
+
+#ifdef RUN_TIME_STATS
+    if (!stats_start(tskIDLE_PRIORITY + 1))
+    {
+        RTT_LOG("STATS task failed to start\n");
+        while (1)
+            ;
+    }
+#endif
+
     vTaskStartScheduler();
 
     /* We shouldn't get here, the RTOS scheduler must have failed to start. */
@@ -46,6 +90,17 @@ int main(void)
     return 0;
 }
 
+/* Memory for the idle task, the kernel has no heap to create it from */
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize)
+{
+    static StaticTask_t idle_tcb;
+    static StackType_t idle_stack[configMINIMAL_STACK_SIZE];
+
+    *ppxIdleTaskTCBBuffer = &idle_tcb;
+    *ppxIdleTaskStackBuffer = idle_stack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
 /* This will be called if RTOS detects that we're stomping over the stack */
 void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
 {
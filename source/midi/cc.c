@@ -0,0 +1,135 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "cc.h"
+
+/* Private functions */
+static bool parameter(const midi_cc_t *cc, uint8_t channel, midi_control_t *control);
+
+/**
+ * midi_cc_init
+ * \brief resets the decoder, no parameters are selected and all pairs are zero.
+ * \param cc the decoder
+ */
+void midi_cc_init(midi_cc_t *cc)
+{
+  for (uint8_t channel = 0; channel < MIDI_CC_CHANNELS; channel++)
+  {
+    for (uint8_t i = 0; i < 32; i++)
+    {
+      cc->msb[channel][i] = 0;
+    }
+
+    cc->parameter[channel] = MIDI_RPN_NULL;
+    cc->nrpn[channel] = false;
+    cc->data[channel] = 0;
+  }
+}
+
+/**
+ * midi_cc_decode
+ * \brief decodes one control change message.
+ * \param cc the decoder
+ * \param channel the channel (0-15)
+ * \param controller the controller number
+ * \param value the controller value
+ * \param control filled in when the message changes a control
+ * \return true if control is valid, false for parameter selection and orphaned data entry
+ */
+bool midi_cc_decode(midi_cc_t *cc, uint8_t channel, uint8_t controller, uint8_t value, midi_control_t *control)
+{
+  uint16_t data = cc->data[channel];
+
+  control->type = MIDI_CONTROL_CC;
+  control->channel = channel;
+
+  switch (controller)
+  {
+  case MIDI_CC_DATA_ENTRY:
+    /* A new MSB clears the LSB */
+    cc->data[channel] = (uint16_t)(value << 7);
+    return parameter(cc, channel, control);
+
+  case MIDI_CC_DATA_ENTRY_LSB:
+    cc->data[channel] = (uint16_t)((data & 0x3F80) | value);
+    return parameter(cc, channel, control);
+
+  /* One step of the MSB, most editors treat parameters as 7 bit */
+  case MIDI_CC_DATA_INCREMENT:
+    cc->data[channel] = (uint16_t)(data > MIDI_CONTROL_MAX - 0x80 ? MIDI_CONTROL_MAX : data + 0x80);
+    return parameter(cc, channel, control);
+
+  case MIDI_CC_DATA_DECREMENT:
+    cc->data[channel] = (uint16_t)(data < 0x80 ? 0 : data - 0x80);
+    return parameter(cc, channel, control);
+
+  case MIDI_CC_NRPN_MSB:
+  case MIDI_CC_RPN_MSB:
+    cc->nrpn[channel] = controller == MIDI_CC_NRPN_MSB;
+    cc->parameter[channel] = (uint16_t)((value << 7) | (cc->parameter[channel] & 0x7F));
+    return false;
+
+  case MIDI_CC_NRPN_LSB:
+  case MIDI_CC_RPN_LSB:
+    cc->nrpn[channel] = controller == MIDI_CC_NRPN_LSB;
+    cc->parameter[channel] = (uint16_t)((cc->parameter[channel] & 0x3F80) | value);
+    return false;
+
+  default:
+    break;
+  }
+
+  if (controller < 32)
+  {
+    cc->msb[channel][controller] = value;
+    control->number = controller;
+    control->value = (uint16_t)(value << 7);
+  }
+  else if (controller < 64)
+  {
+    control->number = controller - 32;
+    control->value = (uint16_t)((cc->msb[channel][controller - 32] << 7) | value);
+  }
+  else if (controller >= MIDI_CC_CHANNEL_MODE)
+  {
+    control->number = controller;
+    control->value = value;
+  }
+  else
+  {
+    /* Replicate the top bits so 127 is full scale */
+    control->number = controller;
+    control->value = (uint16_t)((value << 7) | value);
+  }
+
+  return true;
+}
+
+/**
+ * parameter
+ * \brief fills in a RPN/NRPN control from the current selection and data.
+ * \param cc the decoder
+ * \param channel the channel
+ * \param control the control
+ * \return false if no parameter is selected
+ */
+static bool parameter(const midi_cc_t *cc, uint8_t channel, midi_control_t *control)
+{
+  uint16_t number = cc->parameter[channel];
+
+  if (number == MIDI_RPN_NULL)
+  {
+    return false;
+  }
+
+  control->type = cc->nrpn[channel] ? MIDI_CONTROL_NRPN : MIDI_CONTROL_RPN;
+  control->number = number;
+  control->value = cc->data[channel];
+
+  return true;
+}
@@ -0,0 +1,94 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef CC_H
+#define CC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  Control change decoder, turns the raw controller stream into 14 bit
+  controls.
+
+    - CC 0-31 are the MSB of a 14 bit pair whose LSB is CC 32-63. The MSB
+      alone gives a control (with the LSB taken as zero, as the MIDI spec
+      requires) and each LSB refines it, so 7 bit senders still work.
+    - CC 99/98 select a NRPN, CC 101/100 a RPN, data entry (CC 6/38) and
+      increment/decrement (CC 96/97) then give the parameter value. RPN
+      127/127 (null) deselects.
+    - Everything else (CC 64-95, 102-119) is a plain 7 bit control, scaled
+      to 14 bits so all controls share one range.
+
+  Channel mode messages (CC 120-127) are passed through unchanged, the
+  value is the raw 7 bit value since it is a setting (local control on/off,
+  the mono channel count) rather than a position.
+*/
+
+#define MIDI_CC_CHANNELS (16)
+
+/* Data entry and parameter selection controllers */
+#define MIDI_CC_DATA_ENTRY (6)
+#define MIDI_CC_DATA_ENTRY_LSB (38)
+#define MIDI_CC_DATA_INCREMENT (96)
+#define MIDI_CC_DATA_DECREMENT (97)
+#define MIDI_CC_NRPN_LSB (98)
+#define MIDI_CC_NRPN_MSB (99)
+#define MIDI_CC_RPN_LSB (100)
+#define MIDI_CC_RPN_MSB (101)
+
+/* First channel mode message */
+#define MIDI_CC_CHANNEL_MODE (120)
+
+/* No parameter selected */
+#define MIDI_RPN_NULL (0x3FFF)
+
+/* Full scale 14 bit value */
+#define MIDI_CONTROL_MAX (0x3FFF)
+
+/* Kind of control */
+typedef enum
+{
+  MIDI_CONTROL_CC,   /* number is the controller, the MSB number for a 14 bit pair */
+  MIDI_CONTROL_RPN,  /* number is the 14 bit registered parameter number */
+  MIDI_CONTROL_NRPN, /* number is the 14 bit non-registered parameter number */
+} midi_control_type_t;
+
+/* A decoded control */
+typedef struct
+{
+  midi_control_type_t type;
+  uint8_t channel;
+  uint16_t number;
+  uint16_t value;    /* 0 - MIDI_CONTROL_MAX */
+} midi_control_t;
+
+/* Decoder state */
+typedef struct
+{
+  uint8_t msb[MIDI_CC_CHANNELS][32];         /* Latest MSB of each 14 bit pair */
+  uint16_t parameter[MIDI_CC_CHANNELS];      /* Selected RPN/NRPN, MIDI_RPN_NULL if none */
+  bool nrpn[MIDI_CC_CHANNELS];               /* The selection is a NRPN */
+  uint16_t data[MIDI_CC_CHANNELS];           /* Latest data entry value */
+} midi_cc_t;
+
+/* API */
+void midi_cc_init(midi_cc_t *cc);
+bool midi_cc_decode(midi_cc_t *cc, uint8_t channel, uint8_t controller, uint8_t value, midi_control_t *control);
+
+/**
+ * midi_control_unit
+ * \brief the control value as 0-1.
+ * \param control the control
+ */
+static inline float midi_control_unit(const midi_control_t *control)
+{
+  return (float)control->value * (1.0f / (float)MIDI_CONTROL_MAX);
+}
+
+#endif /* CC_H */
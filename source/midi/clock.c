@@ -0,0 +1,279 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+
+#include "clock.h"
+
+/* Private functions */
+static void tick(midi_clock_t *clock, uint32_t time);
+static void acquire(midi_clock_t *clock, uint32_t time);
+static void publish(midi_clock_t *clock);
+
+/**
+ * midi_clock_init
+ * \brief initialises the follower, the clock is unlocked and the transport stopped.
+ * \param clock the follower instance
+ * \param sample_rate the DAE sample rate, the unit of the event timestamps
+ */
+void midi_clock_init(midi_clock_t *clock, float sample_rate)
+{
+  clock->sample_rate = sample_rate;
+  clock->min_period = sample_rate * 60.0f / (MIDI_CLOCK_MAX_BPM * MIDI_CLOCK_PPQN);
+  clock->max_period = sample_rate * 60.0f / (MIDI_CLOCK_MIN_BPM * MIDI_CLOCK_PPQN);
+  clock->est_time = 0;
+  clock->est_frac = 0.0f;
+  clock->period = 0.0f;
+  clock->count = 0;
+  clock->outliers = 0;
+  clock->tick = 0;
+  clock->position = 0;
+  clock->running = false;
+
+  atomic_init(&clock->seq, 0);
+  clock->state.time = 0;
+  clock->state.tick = 0;
+  clock->state.period = 0.0f;
+  clock->state.running = false;
+}
+
+/**
+ * midi_clock_event
+ * \brief feeds a MIDI event to the follower, anything but clock and transport is ignored.
+ * \param clock the follower instance
+ * \param event the event, timestamped with the DAE sample time
+ * \note there must be a single writer, normally the DAE task from dae_midi_event().
+ */
+void midi_clock_event(midi_clock_t *clock, const midi_event_t *event)
+{
+  switch (event->status)
+  {
+  case MIDI_CLOCK:
+    tick(clock, event->timestamp);
+    return;
+
+  case MIDI_START:
+    /* The first tick after Start is the downbeat */
+    clock->tick = 0;
+    clock->position = 0;
+    clock->running = true;
+    break;
+
+  case MIDI_CONTINUE:
+    clock->running = true;
+    break;
+
+  case MIDI_STOP:
+    clock->running = false;
+    break;
+
+  case MIDI_SONG_POSITION:
+    /* Song position is in 16th notes */
+    clock->position = (uint32_t)(event->data[0] | (event->data[1] << 7)) * (MIDI_CLOCK_PPQN / 4);
+    clock->tick = clock->position;
+    break;
+
+  default:
+    return;
+  }
+
+  publish(clock);
+}
+
+/**
+ * midi_clock_read
+ * \brief takes a consistent copy of the published state, lock-free.
+ * \param clock the follower instance
+ * \param sample_time the current DAE sample time
+ * \param state receives the state, unlocked if no tick has arrived within MIDI_CLOCK_TIMEOUT periods
+ * \note safe from any task, it retries if the writer updated the state mid copy.
+ */
+void midi_clock_read(const midi_clock_t *clock, uint32_t sample_time, midi_clock_state_t *state)
+{
+  unsigned seq;
+
+  do
+  {
+    seq = atomic_load_explicit(&clock->seq, memory_order_acquire);
+    *state = clock->state;
+    atomic_thread_fence(memory_order_acquire);
+  } while ((seq & 1) || seq != atomic_load_explicit(&clock->seq, memory_order_relaxed));
+
+  /* The ticks have stopped, the subtraction handles the sample clock wrapping */
+  if ((float)(int32_t)(sample_time - state->time) > MIDI_CLOCK_TIMEOUT * state->period)
+  {
+    state->period = 0.0f;
+  }
+}
+
+/**
+ * midi_clock_bpm
+ * \brief the tempo in quarter notes per minute.
+ * \param state the clock state from midi_clock_read()
+ * \param sample_rate the DAE sample rate
+ * \return the tempo, 0 if the clock is not locked
+ */
+float midi_clock_bpm(const midi_clock_state_t *state, float sample_rate)
+{
+  if (state->period <= 0.0f)
+  {
+    return 0.0f;
+  }
+
+  return sample_rate * 60.0f / (state->period * MIDI_CLOCK_PPQN);
+}
+
+/**
+ * midi_clock_phase
+ * \brief the position within a cycle of ticks at a given sample time.
+ * \param state the clock state from midi_clock_read()
+ * \param sample_time the DAE sample time, e.g. the first sample of the block being rendered
+ * \param ticks_per_cycle the cycle length, MIDI_CLOCK_PPQN for a beat, 4 * MIDI_CLOCK_PPQN for a 4/4 bar
+ * \return the phase in [0, 1), it advances between ticks while the transport runs
+ */
+float midi_clock_phase(const midi_clock_state_t *state, uint32_t sample_time, uint32_t ticks_per_cycle)
+{
+  float ticks = (float)(state->tick % ticks_per_cycle);
+
+  /* Extrapolate from the latest tick, the subtraction handles the sample clock wrapping */
+  if (state->running && state->period > 0.0f)
+  {
+    ticks += (float)(int32_t)(sample_time - state->time) / state->period;
+  }
+
+  float cycles = ticks / (float)ticks_per_cycle;
+
+  return cycles - floorf(cycles);
+}
+
+/**
+ * tick
+ * \brief runs the filter for one clock tick.
+ * \param clock the follower instance
+ * \param time the tick timestamp
+ */
+static void tick(midi_clock_t *clock, uint32_t time)
+{
+  if (clock->running)
+  {
+    clock->tick = clock->position++;
+  }
+
+  /* First tick, nothing to measure a period from */
+  if (clock->count == 0)
+  {
+    acquire(clock, time);
+    publish(clock);
+    return;
+  }
+
+  float elapsed = (float)(int32_t)(time - clock->est_time) - clock->est_frac;
+
+  /* Second tick, take the raw interval as the first period estimate */
+  if (clock->count == 1)
+  {
+    if (elapsed >= clock->min_period && elapsed <= clock->max_period)
+    {
+      clock->period = elapsed;
+      clock->count = 2;
+      clock->est_time = time;
+      clock->est_frac = 0.0f;
+    }
+    else
+    {
+      acquire(clock, time);
+    }
+
+    publish(clock);
+    return;
+  }
+
+  /* Lost the clock, e.g. the sender stopped and restarted */
+  if (elapsed < 0.0f || elapsed > MIDI_CLOCK_TIMEOUT * clock->period)
+  {
+    acquire(clock, time);
+    publish(clock);
+    return;
+  }
+
+  /*
+    A single wild tick is ignored, the estimate coasts on the predicted
+    period. Two in a row is a tempo jump, re-acquire from this tick.
+  */
+  float error = elapsed - clock->period;
+  float offset = clock->est_frac + clock->period;
+
+  if (fabsf(error) > 0.5f * clock->period)
+  {
+    if (++clock->outliers > 1)
+    {
+      acquire(clock, time);
+      publish(clock);
+      return;
+    }
+  }
+  else
+  {
+    /*
+      Gains of the growing memory (least squares) filter for the n'th tick,
+      floored at the steady state values.
+    */
+    float n = (float)(clock->count + 1);
+    float alpha = fmaxf(2.0f * (2.0f * n - 1.0f) / (n * (n + 1.0f)), MIDI_CLOCK_ALPHA);
+    float beta = fmaxf(6.0f / (n * (n + 1.0f)), MIDI_CLOCK_BETA);
+
+    offset += alpha * error;
+    clock->period = fminf(fmaxf(clock->period + beta * error, clock->min_period), clock->max_period);
+    clock->outliers = 0;
+
+    if (clock->count < UINT32_MAX)
+    {
+      clock->count++;
+    }
+  }
+
+  float whole = floorf(offset);
+  clock->est_time += (uint32_t)(int32_t)whole;
+  clock->est_frac = offset - whole;
+
+  publish(clock);
+}
+
+/**
+ * acquire
+ * \brief restarts the filter from a tick, the previous period is published until a new one is measured.
+ * \param clock the follower instance
+ * \param time the tick timestamp
+ */
+static void acquire(midi_clock_t *clock, uint32_t time)
+{
+  clock->est_time = time;
+  clock->est_frac = 0.0f;
+  clock->count = 1;
+  clock->outliers = 0;
+}
+
+/**
+ * publish
+ * \brief updates the published state for readers.
+ * \param clock the follower instance
+ */
+static void publish(midi_clock_t *clock)
+{
+  unsigned seq = atomic_load_explicit(&clock->seq, memory_order_relaxed);
+
+  atomic_store_explicit(&clock->seq, seq + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  clock->state.tick = clock->tick;
+  clock->state.time = clock->est_time + (clock->est_frac >= 0.5f ? 1 : 0);
+  clock->state.period = clock->period;
+  clock->state.running = clock->running;
+
+  atomic_store_explicit(&clock->seq, seq + 2, memory_order_release);
+}
@@ -0,0 +1,98 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "midi.h"
+
+/*
+  MIDI clock follower.
+
+  Incoming 0xF8 ticks (24 per quarter note) are timestamped against the DAE
+  sample clock, the raw intervals jitter by the UART byte time, the sender's
+  own scheduling and the interrupt latency. The follower tracks the tick
+  period and the time of the latest tick with an alpha-beta filter (a second
+  order PLL), the gains start wide so it locks in a few ticks and narrow to
+  MIDI_CLOCK_ALPHA / MIDI_CLOCK_BETA as it settles, like a Kalman filter
+  reaching its steady state.
+
+  The filtered state is published with a sequence counter so tempo synced
+  DSP (LFOs, delays, arpeggiators) can read it lock-free from any task and
+  extrapolate a sample accurate phase with midi_clock_phase(). A clock that
+  stops sending ticks has nothing to run the filter, so the timeout is
+  checked as the state is read, against the reader's sample time.
+
+  Start, Stop, Continue and Song Position set the transport, the tempo is
+  tracked whether or not the transport is running.
+*/
+
+/* Ticks per quarter note */
+#define MIDI_CLOCK_PPQN (24)
+
+/* Tempo range accepted, ticks outside it are treated as a dropout */
+#define MIDI_CLOCK_MIN_BPM (20.0f)
+#define MIDI_CLOCK_MAX_BPM (300.0f)
+
+/* Steady state loop gains, smaller is smoother but slower to follow tempo changes */
+#ifndef MIDI_CLOCK_ALPHA
+#define MIDI_CLOCK_ALPHA (0.05f)
+#endif
+
+#ifndef MIDI_CLOCK_BETA
+#define MIDI_CLOCK_BETA (0.0013f)
+#endif
+
+/*
+  Clock is lost if no tick arrives within this many periods, readers see it
+  unlocked from then on and the next tick re-acquires it
+*/
+#define MIDI_CLOCK_TIMEOUT (4)
+
+/* Published clock state */
+typedef struct
+{
+  uint32_t time;       /* Filtered sample time of the latest tick */
+  uint32_t tick;       /* Song position of the latest tick, in ticks */
+  float period;        /* Filtered samples per tick, 0 if not locked */
+  bool running;        /* Transport is running, the position advances */
+} midi_clock_state_t;
+
+/* Clock follower instance */
+typedef struct
+{
+  atomic_uint seq;            /* Odd while the published state is being written */
+  midi_clock_state_t state;   /* Published state, read with midi_clock_read() */
+
+  /* Filter state, private to the writer */
+  float sample_rate;
+  float min_period;
+  float max_period;
+  uint32_t est_time;          /* Integer part of the estimated latest tick time */
+  float est_frac;             /* Fractional part, kept separately for precision */
+  float period;               /* Estimated samples per tick */
+  uint32_t count;             /* Ticks since acquisition, drives the gain schedule */
+  uint32_t outliers;          /* Consecutive ticks too far from the prediction */
+  uint32_t tick;              /* Song position of the latest tick */
+  uint32_t position;          /* Song position of the next tick */
+  bool running;
+} midi_clock_t;
+
+/* API */
+void midi_clock_init(midi_clock_t *clock, float sample_rate);
+void midi_clock_event(midi_clock_t *clock, const midi_event_t *event);
+
+void midi_clock_read(const midi_clock_t *clock, uint32_t sample_time, midi_clock_state_t *state);
+float midi_clock_bpm(const midi_clock_state_t *state, float sample_rate);
+float midi_clock_phase(const midi_clock_state_t *state, uint32_t sample_time, uint32_t ticks_per_cycle);
+
+#endif /* CLOCK_H */
@@ -0,0 +1,210 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "midi.h"
+
+/* Private functions */
+static uint8_t data_length(uint8_t status);
+static void emit(midi_event_t *event, uint8_t status, uint8_t data0, uint8_t data1);
+
+/**
+ * midi_parser_init
+ * \brief resets the parser, there is no running status afterwards.
+ * \param parser the parser
+ */
+void midi_parser_init(midi_parser_t *parser)
+{
+  parser->status = 0;
+  parser->expected = 0;
+  parser->count = 0;
+  parser->data[0] = 0;
+  parser->data[1] = 0;
+  parser->sysex = false;
+}
+
+/**
+ * midi_parse
+ * \brief feeds one byte to the parser.
+ * \param parser the parser
+ * \param byte the received byte
+ * \param event filled in when a message completes, the timestamp is left to the caller
+ * \return true if event holds a complete message
+ */
+bool midi_parse(midi_parser_t *parser, uint8_t byte, midi_event_t *event)
+{
+  /* Realtime, can appear anywhere and must not affect the message in progress */
+  if (byte >= MIDI_CLOCK)
+  {
+    emit(event, byte, 0, 0);
+    return true;
+  }
+
+  /* Data byte */
+  if (byte < 0x80)
+  {
+    if (parser->sysex)
+    {
+      emit(event, MIDI_SYSEX, byte, 0);
+      return true;
+    }
+
+    /* No running status, e.g. we joined a stream part way through */
+    if (parser->status == 0)
+    {
+      return false;
+    }
+
+    parser->data[parser->count++] = byte;
+    if (parser->count < parser->expected)
+    {
+      return false;
+    }
+
+    emit(event, parser->status, parser->data[0], parser->count > 1 ? parser->data[1] : 0);
+    parser->count = 0;
+
+    /* Running status only applies to channel messages */
+    if (parser->status >= MIDI_SYSEX)
+    {
+      parser->status = 0;
+    }
+
+    return true;
+  }
+
+  /* Any status byte (other than realtime) terminates a SysEx */
+  bool ended_sysex = parser->sysex;
+  parser->sysex = false;
+  parser->count = 0;
+
+  if (byte == MIDI_SYSEX)
+  {
+    parser->status = 0;
+    parser->sysex = true;
+  }
+  else if (byte == MIDI_SYSEX_END || byte == 0xF4 || byte == 0xF5)
+  {
+    parser->status = 0;
+  }
+  else if (byte == MIDI_TUNE_REQUEST)
+  {
+    /* Only one event per byte, a tune request that ends a SysEx is dropped */
+    parser->status = 0;
+    if (!ended_sysex)
+    {
+      emit(event, byte, 0, 0);
+      return true;
+    }
+  }
+  else
+  {
+    parser->status = byte;
+    parser->expected = data_length(byte);
+  }
+
+  if (ended_sysex)
+  {
+    emit(event, MIDI_SYSEX_END, 0, 0);
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * midi_queue_init
+ * \brief empties the queue.
+ * \param queue the queue
+ */
+void midi_queue_init(midi_queue_t *queue)
+{
+  atomic_init(&queue->head, 0);
+  atomic_init(&queue->tail, 0);
+}
+
+/**
+ * midi_queue_push
+ * \brief adds an event, producer side only.
+ * \param queue the queue
+ * \param event the event to add
+ * \return false if the queue was full and the event dropped
+ */
+bool midi_queue_push(midi_queue_t *queue, const midi_event_t *event)
+{
+  uint_fast16_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  uint_fast16_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  if ((uint_fast16_t)(head - tail) >= MIDI_QUEUE_SIZE)
+  {
+    return false;
+  }
+
+  queue->events[head & (MIDI_QUEUE_SIZE - 1)] = *event;
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+  return true;
+}
+
+/**
+ * midi_queue_pop
+ * \brief removes the oldest event, consumer side only.
+ * \param queue the queue
+ * \param event receives the event
+ * \return false if the queue was empty
+ */
+bool midi_queue_pop(midi_queue_t *queue, midi_event_t *event)
+{
+  uint_fast16_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  uint_fast16_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+  if (head == tail)
+  {
+    return false;
+  }
+
+  *event = queue->events[tail & (MIDI_QUEUE_SIZE - 1)];
+  atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+  return true;
+}
+
+/**
+ * data_length
+ * \brief number of data bytes that follow a status byte.
+ * \param status the status byte (not realtime or SysEx)
+ */
+static uint8_t data_length(uint8_t status)
+{
+  switch (status & 0xF0)
+  {
+  case MIDI_PROGRAM_CHANGE:
+  case MIDI_CHANNEL_PRESSURE:
+    return 1;
+
+  case 0xF0:
+    return (status == MIDI_SONG_POSITION) ? 2 : 1;
+
+  default:
+    return 2;
+  }
+}
+
+/**
+ * emit
+ * \brief fills in a completed event.
+ * \param event the event
+ * \param status the status byte
+ * \param data0 first data byte
+ * \param data1 second data byte
+ */
+static void emit(midi_event_t *event, uint8_t status, uint8_t data0, uint8_t data1)
+{
+  event->status = status;
+  event->data[0] = data0;
+  event->data[1] = data1;
+}
@@ -0,0 +1,118 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef MIDI_H
+#define MIDI_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  MIDI 1.0 byte stream parser and event queue.
+
+  The parser is a small state machine fed one byte at a time, it never
+  allocates and has no dependencies on the hardware or RTOS so any byte
+  sequence can be pushed through it on the host. It handles:
+
+    - running status for channel messages
+    - realtime bytes (0xF8-0xFF) interleaved anywhere, even inside another
+      message or a SysEx, they are emitted immediately and do not disturb
+      the message being assembled
+    - system common messages, which cancel running status
+    - SysEx, each data byte is emitted as a MIDI_SYSEX event so it can be
+      streamed, the end (0xF7 or any other status byte) as MIDI_SYSEX_END
+
+  The queue is a single producer, single consumer ring so the UART interrupt
+  can hand timestamped events to the audio task without locking.
+*/
+
+/* Channel message types (status high nibble) */
+#define MIDI_NOTE_OFF (0x80)
+#define MIDI_NOTE_ON (0x90)
+#define MIDI_POLY_PRESSURE (0xA0)
+#define MIDI_CONTROL_CHANGE (0xB0)
+#define MIDI_PROGRAM_CHANGE (0xC0)
+#define MIDI_CHANNEL_PRESSURE (0xD0)
+#define MIDI_PITCH_BEND (0xE0)
+
+/* System messages */
+#define MIDI_SYSEX (0xF0)
+#define MIDI_TIME_CODE (0xF1)
+#define MIDI_SONG_POSITION (0xF2)
+#define MIDI_SONG_SELECT (0xF3)
+#define MIDI_TUNE_REQUEST (0xF6)
+#define MIDI_SYSEX_END (0xF7)
+#define MIDI_CLOCK (0xF8)
+#define MIDI_START (0xFA)
+#define MIDI_CONTINUE (0xFB)
+#define MIDI_STOP (0xFC)
+#define MIDI_ACTIVE_SENSING (0xFE)
+#define MIDI_RESET (0xFF)
+
+/* Queue length, must be a power of 2 */
+#ifndef MIDI_QUEUE_SIZE
+#define MIDI_QUEUE_SIZE (64)
+#endif
+
+/* A complete MIDI message */
+typedef struct
+{
+  uint32_t timestamp; /* DAE sample time at which the message arrived */
+  uint8_t status;     /* Status byte, for channel messages the channel is in the low nibble */
+  uint8_t data[2];    /* Data bytes, unused bytes are zero */
+} midi_event_t;
+
+/* Parser state */
+typedef struct
+{
+  uint8_t status;   /* Running status, or the system common message being assembled, 0 if none */
+  uint8_t expected; /* Data bytes needed to complete the message */
+  uint8_t count;    /* Data bytes received so far */
+  uint8_t data[2];
+  bool sysex;       /* Inside a SysEx message */
+} midi_parser_t;
+
+/* Lock-free single producer, single consumer event queue */
+typedef struct
+{
+  atomic_uint_fast16_t head; /* Written by the producer only */
+  atomic_uint_fast16_t tail; /* Written by the consumer only */
+  midi_event_t events[MIDI_QUEUE_SIZE];
+} midi_queue_t;
+
+/* API */
+void midi_parser_init(midi_parser_t *parser);
+bool midi_parse(midi_parser_t *parser, uint8_t byte, midi_event_t *event);
+
+void midi_queue_init(midi_queue_t *queue);
+bool midi_queue_push(midi_queue_t *queue, const midi_event_t *event);
+bool midi_queue_pop(midi_queue_t *queue, midi_event_t *event);
+
+/**
+ * midi_type
+ * \brief the message type, channel messages have the channel masked off.
+ * \param event the event
+ */
+static inline uint8_t midi_type(const midi_event_t *event)
+{
+  return event->status < 0xF0 ? (event->status & 0xF0) : event->status;
+}
+
+/**
+ * midi_channel
+ * \brief the channel (0-15) of a channel message.
+ * \param event the event
+ */
+static inline uint8_t midi_channel(const midi_event_t *event)
+{
+  return event->status & 0x0F;
+}
+
+#endif /* MIDI_H */
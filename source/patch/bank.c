@@ -0,0 +1,587 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdatomic.h>
+#include <string.h>
+
+#include "bank.h"
+#include "dae.h"
+#include "trace.h"
+
+/* Header written at the start of the bank sector once a transfer verifies */
+#define BANK_MAGIC (0x4B4E4142U) /* "BANK" */
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t length; /* Data bytes */
+  uint32_t crc;    /* CRC of the data padded to whole words */
+  uint32_t reserved;
+} bank_header_t;
+
+/* id, device, cmd, seq (2), payload, checksum */
+#define PACKET_OVERHEAD (6)
+#define PACKET_MAX (PACKET_OVERHEAD + BANK_PACKED_SIZE(BANK_PACKET_DATA))
+
+/* Linker symbols bounding the bank sector */
+extern const uint32_t __bank_start__[];
+extern const uint32_t __bank_end__[];
+
+/* Imported functions */
+bool flash_program(uint32_t address, const uint32_t *data, size_t words);
+uint32_t flash_crc(const uint32_t *data, size_t words);
+bool midi_transmit(const uint8_t *data, size_t len);
+bool midi_transmit_busy(void);
+
+/*
+  Incoming packet, filled by the DAE task from SysEx events and handed to the
+  bank task when complete. While packet_ready is set the bank task owns the
+  buffer and further SysEx is dropped, the sender waits for an ACK before
+  sending more so this only happens with a misbehaving sender.
+*/
+static uint8_t packet[PACKET_MAX];
+static size_t packet_length;
+static bool packet_overflow;
+static atomic_bool packet_ready;
+
+/* Transfer into flash, bank task only */
+static struct
+{
+  bool active;
+  uint32_t length;   /* Announced data bytes */
+  uint32_t received; /* Data bytes received */
+  uint16_t seq;      /* Next expected data packet */
+  uint32_t word;     /* Bytes waiting to be programmed as a word */
+} transfer;
+
+/* Outgoing message, reused once the UART DMA has sent the previous one */
+static uint8_t reply[PACKET_MAX + 2];
+
+static TaskHandle_t bank_task_handle;
+
+#define BANK_STACK_SIZE (configMINIMAL_STACK_SIZE * 2)
+static StackType_t bank_stack[BANK_STACK_SIZE];
+static StaticTask_t bank_tcb;
+static atomic_bool bank_valid;
+
+/* Private functions */
+static void bank_task(void *pvParameters);
+static void receive(uint8_t *p, size_t len);
+static void begin(uint16_t seq, const uint8_t *payload, size_t len);
+static void data(uint16_t seq, uint8_t *payload, size_t len);
+static void end(uint16_t seq, const uint8_t *payload, size_t len);
+static void dump(void);
+static bool store(uint8_t byte);
+static bool verify(void);
+static size_t unpack(const uint8_t *in, size_t len, uint8_t *out);
+static size_t pack(const uint8_t *in, size_t len, uint8_t *out);
+static uint32_t read_number(const uint8_t *p, size_t digits);
+static void write_number(uint32_t value, size_t digits, uint8_t *p);
+static void send(uint8_t cmd, uint16_t seq, const uint8_t *payload, size_t len);
+static void ack(uint8_t cmd, uint16_t seq);
+static void nak(uint8_t cmd, uint16_t seq, bank_error_t error);
+
+static inline uint32_t data_address(void)
+{
+  return (uint32_t)(uintptr_t)__bank_start__ + sizeof(bank_header_t);
+}
+
+static inline uint32_t capacity(void)
+{
+  return (uint32_t)((uintptr_t)__bank_end__ - (uintptr_t)__bank_start__) - sizeof(bank_header_t);
+}
+
+/**
+ * bank_start
+ * \brief checks the stored bank and starts the task handling transfers.
+ * \param priority The FreeRTOS task priority, below the DAE.
+ */
+bool bank_start(UBaseType_t priority)
+{
+  atomic_store(&bank_valid, verify());
+
+  bank_task_handle = xTaskCreateStatic(bank_task, "BANK", BANK_STACK_SIZE, NULL, priority, bank_stack, &bank_tcb);
+  if (bank_task_handle == NULL)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * bank_sysex
+ * \brief collects SysEx bytes, called by the DAE task with MIDI_SYSEX and MIDI_SYSEX_END events.
+ * \param event the event, data[0] holds the SysEx byte
+ */
+void bank_sysex(const midi_event_t *event)
+{
+  if (atomic_load_explicit(&packet_ready, memory_order_acquire))
+  {
+    return;
+  }
+
+  if (event->status == MIDI_SYSEX)
+  {
+    if (packet_length < PACKET_MAX)
+    {
+      packet[packet_length++] = event->data[0];
+    }
+    else
+    {
+      packet_overflow = true;
+    }
+    return;
+  }
+
+  if (event->status != MIDI_SYSEX_END)
+  {
+    return;
+  }
+
+  bool ours = !packet_overflow && packet_length >= PACKET_OVERHEAD &&
+              packet[0] == BANK_SYSEX_ID && packet[1] == BANK_SYSEX_DEVICE;
+
+  packet_overflow = false;
+
+  if (!ours || bank_task_handle == NULL)
+  {
+    packet_length = 0;
+    return;
+  }
+
+  atomic_store_explicit(&packet_ready, true, memory_order_release);
+  xTaskNotifyGive(bank_task_handle);
+}
+
+/**
+ * bank_data
+ * \brief the stored bank, read in place from flash.
+ * \param length receives the length in bytes
+ * \return the bank data, NULL if there is no valid bank or a transfer is in progress
+ */
+const uint8_t *bank_data(size_t *length)
+{
+  if (!atomic_load(&bank_valid))
+  {
+    *length = 0;
+    return NULL;
+  }
+
+  *length = ((const bank_header_t *)__bank_start__)->length;
+  return (const uint8_t *)(uintptr_t)data_address();
+}
+
+/**
+ * bank_task
+ * \brief handles each complete packet, this is where flash is written.
+ * \param pvParameters - unused
+ */
+static void bank_task(void *pvParameters)
+{
+  while (1)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    receive(packet, packet_length);
+
+    packet_length = 0;
+    atomic_store_explicit(&packet_ready, false, memory_order_release);
+  }
+}
+
+/**
+ * receive
+ * \brief checks a packet and dispatches it on its command.
+ * \param p the packet without F0 and F7, data is unpacked in place
+ * \param len its length, at least PACKET_OVERHEAD
+ */
+static void receive(uint8_t *p, size_t len)
+{
+  uint8_t cmd = p[2];
+  uint16_t seq = (uint16_t)read_number(&p[3], 2);
+  uint8_t *payload = &p[5];
+  size_t payload_len = len - PACKET_OVERHEAD;
+
+  uint8_t checksum = 0;
+  for (size_t i = 2; i < len - 1; i++)
+  {
+    checksum ^= p[i];
+  }
+
+  if (checksum != p[len - 1])
+  {
+    nak(cmd, seq, BANK_ERROR_CHECKSUM);
+    return;
+  }
+
+  switch (cmd)
+  {
+  case BANK_BEGIN:
+    begin(seq, payload, payload_len);
+    break;
+  case BANK_DATA:
+    data(seq, payload, payload_len);
+    break;
+  case BANK_END:
+    end(seq, payload, payload_len);
+    break;
+  case BANK_DUMP:
+    dump();
+    break;
+  case BANK_ACK:
+  case BANK_NAK:
+    /* Replies from another device on the same cable */
+    break;
+  default:
+    nak(cmd, seq, BANK_ERROR_COMMAND);
+    break;
+  }
+}
+
+/**
+ * begin
+ * \brief starts a transfer, erasing the bank in a window with no audio or MIDI.
+ */
+static void begin(uint16_t seq, const uint8_t *payload, size_t len)
+{
+  transfer.active = false;
+
+  uint32_t length = len == 4 ? read_number(payload, 4) : UINT32_MAX;
+
+  if (length > capacity())
+  {
+    nak(BANK_BEGIN, seq, BANK_ERROR_LENGTH);
+    return;
+  }
+
+  atomic_store(&bank_valid, false);
+
+  /* Waits for the output to go silent, refused if it does not, the sender waits for the reply and sends nothing meanwhile */
+  if (!dae_flash_erase((uint32_t)(uintptr_t)__bank_start__))
+  {
+    nak(BANK_BEGIN, seq, BANK_ERROR_FLASH);
+    return;
+  }
+
+  transfer.active = true;
+  transfer.length = length;
+  transfer.received = 0;
+  transfer.seq = 0;
+  transfer.word = 0;
+
+  ack(BANK_BEGIN, seq);
+}
+
+/**
+ * data
+ * \brief programs a data packet, a repeat of the last packet (lost ACK) is acknowledged again.
+ */
+static void data(uint16_t seq, uint8_t *payload, size_t len)
+{
+  if (transfer.active && transfer.seq > 0 && seq == transfer.seq - 1)
+  {
+    ack(BANK_DATA, seq);
+    return;
+  }
+
+  if (!transfer.active || seq != transfer.seq)
+  {
+    nak(BANK_DATA, seq, BANK_ERROR_SEQUENCE);
+    return;
+  }
+
+  /* Unpack in place, the output never overtakes the input */
+  uint8_t *raw = payload;
+  size_t count = unpack(payload, len, raw);
+
+  if (count > transfer.length - transfer.received)
+  {
+    transfer.active = false;
+    nak(BANK_DATA, seq, BANK_ERROR_LENGTH);
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++)
+  {
+    if (!store(raw[i]))
+    {
+      transfer.active = false;
+      nak(BANK_DATA, seq, BANK_ERROR_FLASH);
+      return;
+    }
+  }
+
+  transfer.seq = (transfer.seq + 1) & 0x3FFF;
+  ack(BANK_DATA, seq);
+}
+
+/**
+ * end
+ * \brief verifies the data and commits the bank by writing its header.
+ * \details the header is programmed last, a transfer cut short by power loss
+ *          or a bad CRC leaves no header and the bank reads as empty.
+ */
+static void end(uint16_t seq, const uint8_t *payload, size_t len)
+{
+  if (!transfer.active)
+  {
+    nak(BANK_END, seq, BANK_ERROR_SEQUENCE);
+    return;
+  }
+
+  transfer.active = false;
+
+  if (len != 5 || transfer.received != transfer.length)
+  {
+    nak(BANK_END, seq, BANK_ERROR_LENGTH);
+    return;
+  }
+
+  /* Pad the final word */
+  while (transfer.received % sizeof(uint32_t) != 0)
+  {
+    if (!store(0xFF))
+    {
+      nak(BANK_END, seq, BANK_ERROR_FLASH);
+      return;
+    }
+  }
+
+  size_t words = transfer.length / sizeof(uint32_t) + (transfer.length % sizeof(uint32_t) != 0);
+  uint32_t crc = flash_crc((const uint32_t *)(uintptr_t)data_address(), words);
+
+  if (crc != read_number(payload, 5))
+  {
+    nak(BANK_END, seq, BANK_ERROR_CRC);
+    return;
+  }
+
+  bank_header_t header = {BANK_MAGIC, transfer.length, crc, UINT32_MAX};
+
+  if (!flash_program((uint32_t)(uintptr_t)__bank_start__, (const uint32_t *)&header, sizeof(header) / sizeof(uint32_t)))
+  {
+    nak(BANK_END, seq, BANK_ERROR_FLASH);
+    return;
+  }
+
+  atomic_store(&bank_valid, true);
+  ack(BANK_END, seq);
+}
+
+/**
+ * dump
+ * \brief sends the stored bank, paced by the UART rather than by ACKs.
+ */
+static void dump(void)
+{
+  size_t length;
+  const uint8_t *bank = bank_data(&length);
+
+  if (bank == NULL)
+  {
+    nak(BANK_DUMP, 0, BANK_ERROR_EMPTY);
+    return;
+  }
+
+  static uint8_t packed[BANK_PACKED_SIZE(BANK_PACKET_DATA)];
+  uint8_t number[5];
+
+  write_number((uint32_t)length, 4, number);
+  send(BANK_BEGIN, 0, number, 4);
+
+  uint16_t seq = 0;
+  for (size_t offset = 0; offset < length; offset += BANK_PACKET_DATA)
+  {
+    size_t count = length - offset < BANK_PACKET_DATA ? length - offset : BANK_PACKET_DATA;
+
+    send(BANK_DATA, seq, packed, pack(bank + offset, count, packed));
+    seq = (seq + 1) & 0x3FFF;
+  }
+
+  write_number(((const bank_header_t *)__bank_start__)->crc, 5, number);
+  send(BANK_END, 0, number, 5);
+}
+
+/**
+ * store
+ * \brief appends a data byte, programming each word as it completes.
+ * \return false on a programming error
+ */
+static bool store(uint8_t byte)
+{
+  uint32_t offset = transfer.received++;
+  uint32_t shift = (offset % sizeof(uint32_t)) * 8;
+
+  transfer.word |= (uint32_t)byte << shift;
+
+  if (shift < 24)
+  {
+    return true;
+  }
+
+  uint32_t word = transfer.word;
+  transfer.word = 0;
+
+  return flash_program(data_address() + offset - 3, &word, 1);
+}
+
+/**
+ * verify
+ * \brief checks the stored bank header and CRC.
+ * \return true if the bank holds a complete, verified transfer
+ */
+static bool verify(void)
+{
+  const bank_header_t *header = (const bank_header_t *)__bank_start__;
+
+  if (header->magic != BANK_MAGIC || header->length > capacity())
+  {
+    return false;
+  }
+
+  size_t words = header->length / sizeof(uint32_t) + (header->length % sizeof(uint32_t) != 0);
+
+  return flash_crc((const uint32_t *)(uintptr_t)data_address(), words) == header->crc;
+}
+
+/**
+ * unpack
+ * \brief decodes 8 to 7 packed SysEx data.
+ * \param in packed bytes
+ * \param len number of packed bytes
+ * \param out decoded bytes, may be in
+ * \return number of decoded bytes
+ */
+static size_t unpack(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t count = 0;
+
+  for (size_t i = 0; i < len; i += 8)
+  {
+    uint8_t msbs = in[i];
+
+    for (size_t j = 1; j < 8 && i + j < len; j++)
+    {
+      out[count++] = (uint8_t)((in[i + j] & 0x7F) | (((msbs >> (j - 1)) & 1) << 7));
+    }
+  }
+
+  return count;
+}
+
+/**
+ * pack
+ * \brief encodes data 8 to 7 for SysEx.
+ * \param in data bytes
+ * \param len number of data bytes
+ * \param out packed bytes, BANK_PACKED_SIZE(len) long
+ * \return number of packed bytes
+ */
+static size_t pack(const uint8_t *in, size_t len, uint8_t *out)
+{
+  size_t count = 0;
+
+  for (size_t i = 0; i < len; i += 7)
+  {
+    uint8_t *msbs = &out[count++];
+    *msbs = 0;
+
+    for (size_t j = 0; j < 7 && i + j < len; j++)
+    {
+      *msbs |= (uint8_t)((in[i + j] >> 7) << j);
+      out[count++] = in[i + j] & 0x7F;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * read_number
+ * \brief reads a number sent 7 bits at a time, least significant first.
+ */
+static uint32_t read_number(const uint8_t *p, size_t digits)
+{
+  uint32_t value = 0;
+
+  for (size_t i = 0; i < digits; i++)
+  {
+    value |= (uint32_t)(p[i] & 0x7F) << (7 * i);
+  }
+
+  return value;
+}
+
+/**
+ * write_number
+ * \brief writes a number 7 bits at a time, least significant first.
+ */
+static void write_number(uint32_t value, size_t digits, uint8_t *p)
+{
+  for (size_t i = 0; i < digits; i++)
+  {
+    p[i] = value & 0x7F;
+    value >>= 7;
+  }
+}
+
+/**
+ * send
+ * \brief frames and transmits a message, waiting for the previous one to go.
+ */
+static void send(uint8_t cmd, uint16_t seq, const uint8_t *payload, size_t len)
+{
+  RTT_ASSERT(len <= BANK_PACKED_SIZE(BANK_PACKET_DATA));
+
+  while (midi_transmit_busy())
+  {
+    vTaskDelay(1);
+  }
+
+  size_t n = 0;
+  reply[n++] = MIDI_SYSEX;
+  reply[n++] = BANK_SYSEX_ID;
+  reply[n++] = BANK_SYSEX_DEVICE;
+  reply[n++] = cmd;
+  write_number(seq, 2, &reply[n]);
+  n += 2;
+  memcpy(&reply[n], payload, len);
+  n += len;
+
+  uint8_t checksum = 0;
+  for (size_t i = 3; i < n; i++)
+  {
+    checksum ^= reply[i];
+  }
+
+  reply[n++] = checksum;
+  reply[n++] = MIDI_SYSEX_END;
+
+  midi_transmit(reply, n);
+}
+
+/**
+ * ack
+ * \brief acknowledges a command, echoing its packet number.
+ */
+static void ack(uint8_t cmd, uint16_t seq)
+{
+  send(BANK_ACK, seq, &cmd, 1);
+}
+
+/**
+ * nak
+ * \brief refuses a command, the sender may retry or abandon the transfer.
+ */
+static void nak(uint8_t cmd, uint16_t seq, bank_error_t error)
+{
+  uint8_t payload[2] = {cmd, (uint8_t)error};
+
+  send(BANK_NAK, seq, payload, 2);
+}
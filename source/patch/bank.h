@@ -0,0 +1,98 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef BANK_H
+#define BANK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "midi.h"
+
+/*
+  Patch bank backup and restore over SysEx.
+
+  A bank is an opaque block of up to 128KB held in its own flash sector
+  (BANK in the linker script), it is read in place through bank_data().
+  Transfers are handshaked, each packet is acknowledged before the sender
+  sends the next, so nothing is lost while the receiver is writing flash.
+  Received data is streamed through a single packet buffer and programmed
+  into flash word by word, the bank is never held in RAM.
+
+  Every message has the form
+
+    F0 7D 00 <cmd> <seq lo> <seq hi> <payload...> <checksum> F7
+
+  where 7D is the non-commercial manufacturer ID, 00 the device, seq a 14
+  bit packet number and checksum the XOR of cmd to the end of the payload.
+  Multi-byte numbers are sent 7 bits at a time, least significant first.
+
+    BANK_BEGIN    payload: length (4 bytes), the bank sector is erased
+    BANK_DATA     payload: up to BANK_PACKET_DATA bytes packed 8 to 7,
+                  seq counts from 0 after BANK_BEGIN
+    BANK_END      payload: CRC (5 bytes), the bank is committed if the CRC
+                  matches the flash contents
+    BANK_DUMP     no payload, the device sends its bank as BEGIN, DATA...
+                  END packets (unacknowledged)
+    BANK_ACK      payload: the command acknowledged, seq is echoed
+    BANK_NAK      payload: the command refused and a bank_error_t
+
+  Packing 8 to 7: each group of up to 7 data bytes is sent as a byte holding
+  their top bits (bit n for byte n) followed by the 7 low bits of each byte.
+
+  The CRC is CRC-32/MPEG-2 (polynomial 0x04C11DB7, initial 0xFFFFFFFF, no
+  reflection or final XOR) over the data as little endian 32 bit words,
+  padded to a whole word with 0xFF. This is what the STM32 CRC unit computes.
+
+  Erasing the sector stalls everything running from flash for a second or
+  more, so BANK_BEGIN is only acted on once the DAE output is silent, the
+  audio never glitches. MIDI input is off during the erase (see
+  dae_flash_erase()), the ACK follows once it is done and the sender must
+  not send anything before then. If the output does not go silent within
+  DAE_HOLD_TIMEOUT_MS the BEGIN is refused with BANK_ERROR_FLASH and can
+  be sent again once the notes and tails have ended.
+*/
+
+#define BANK_SYSEX_ID (0x7D)
+#define BANK_SYSEX_DEVICE (0x00)
+
+/* Raw bytes per data packet */
+#define BANK_PACKET_DATA (256)
+
+/* Packed size of n raw bytes */
+#define BANK_PACKED_SIZE(n) ((n) + ((n) + 6) / 7)
+
+/* Commands */
+#define BANK_BEGIN (0x01)
+#define BANK_DATA (0x02)
+#define BANK_END (0x03)
+#define BANK_DUMP (0x10)
+#define BANK_NAK (0x7E)
+#define BANK_ACK (0x7F)
+
+/* NAK reasons */
+typedef enum
+{
+  BANK_ERROR_CHECKSUM = 1, /* Packet checksum mismatch, resend it */
+  BANK_ERROR_SEQUENCE,     /* Unexpected packet number or no transfer in progress */
+  BANK_ERROR_LENGTH,       /* Bank too large, or more or less data than announced */
+  BANK_ERROR_FLASH,        /* Erase or program failed, or no silence to erase in */
+  BANK_ERROR_CRC,          /* Data did not verify, the bank is not committed */
+  BANK_ERROR_EMPTY,        /* Dump requested with no valid bank */
+  BANK_ERROR_COMMAND,      /* Unknown command */
+} bank_error_t;
+
+/* API */
+bool bank_start(UBaseType_t priority);
+void bank_sysex(const midi_event_t *event);
+const uint8_t *bank_data(size_t *length);
+
+#endif /* BANK_H */
@@ -0,0 +1,560 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "dae.h"
+#include "patch.h"
+#include "queue.h"
+#include "trace.h"
+
+#define PATCH_SECTOR_MAGIC (0x43544150U) /* "PATC" */
+#define PATCH_RECORD_MAGIC (0x5250U)     /* "PR" */
+
+#define ERASED (0xFFFFFFFFU)
+
+/* Record size in words for a number of values: header, values, CRC */
+#define RECORD_WORDS(count) ((sizeof(patch_t) + (count) * sizeof(uint16_t) + 3) / 4 + 1)
+#define RECORD_WORDS_MIN RECORD_WORDS(0)
+#define RECORD_WORDS_MAX RECORD_WORDS(PARAM_COUNT)
+
+#define SAVE_QUEUE_LENGTH (4)
+
+/* Poll interval while waiting for the output to go silent before an erase */
+#define SILENCE_POLL_MS (10)
+
+/* Header at the start of each sector */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t generation;  /* Incremented at each compaction, the highest active sector is current */
+  uint32_t erase_count;
+  uint32_t active;      /* ERASED while being filled, programmed to 0 once complete */
+} sector_header_t;
+
+/* Queued save */
+typedef struct
+{
+  uint8_t slot;
+  char name[PATCH_NAME_LENGTH];
+  uint16_t value[PARAM_COUNT];
+} save_request_t;
+
+/* Linker symbols bounding the two sectors */
+extern const uint32_t __patches_start__[];
+extern const uint32_t __patches_end__[];
+
+/* Imported functions */
+bool flash_program(uint32_t address, const uint32_t *data, size_t words);
+
+/* Latest record of each slot, written by the patch task, read from any task */
+static const patch_t *_Atomic slots[PATCH_SLOTS];
+
+/* Log state, patch task only once started */
+static struct
+{
+  const sector_header_t *active;
+  const sector_header_t *spare;
+  uintptr_t next;        /* Where the next record is written */
+  bool spare_dirty;      /* The spare sector needs erasing before it can be used */
+  uint32_t spare_erases; /* Erase count of the spare sector */
+} store;
+
+static QueueHandle_t save_queue;
+static StaticQueue_t save_queue_state;
+static uint8_t save_queue_storage[SAVE_QUEUE_LENGTH * sizeof(save_request_t)];
+
+#define PATCH_STACK_SIZE (configMINIMAL_STACK_SIZE * 2)
+static StackType_t patch_stack[PATCH_STACK_SIZE];
+static StaticTask_t patch_tcb;
+
+/* Private functions */
+static void patch_task(void *pvParameters);
+static bool mount(void);
+static void scan(const sector_header_t *sector);
+static bool save(const save_request_t *request);
+static bool append(const uint32_t *record, size_t words);
+static bool compact(size_t words);
+static bool erase_spare(void);
+static bool stamp_sector(const sector_header_t *sector, uint32_t erase_count);
+static bool begin_sector(const sector_header_t *sector, uint32_t generation, uint32_t erase_count);
+static bool is_valid(const sector_header_t *sector);
+static bool is_blank(const sector_header_t *sector);
+static uint32_t spare_erases(void);
+static uint32_t crc(const uint32_t *data, size_t words);
+
+static inline uintptr_t sector_size(void)
+{
+  return ((uintptr_t)__patches_end__ - (uintptr_t)__patches_start__) / 2;
+}
+
+static inline const sector_header_t *sector(int index)
+{
+  return (const sector_header_t *)((uintptr_t)__patches_start__ + index * sector_size());
+}
+
+static inline uintptr_t sector_end(const sector_header_t *sector)
+{
+  return (uintptr_t)sector + sector_size();
+}
+
+/**
+ * patch_start
+ * \brief mounts the patch store and starts the task that writes it.
+ * \param priority The FreeRTOS task priority, below the DAE.
+ * \note call before the scheduler starts, a blank or corrupt store is formatted
+ *       and that erases flash, which is only safe while there is no audio.
+ */
+bool patch_start(UBaseType_t priority)
+{
+  if (!mount())
+  {
+    return false;
+  }
+
+  save_queue = xQueueCreateStatic(SAVE_QUEUE_LENGTH, sizeof(save_request_t), save_queue_storage, &save_queue_state);
+  if (save_queue == NULL)
+  {
+    return false;
+  }
+
+  if (xTaskCreateStatic(patch_task, "PATCH", PATCH_STACK_SIZE, NULL, priority, patch_stack, &patch_tcb) == NULL)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * patch_find
+ * \brief the latest saved patch in a slot.
+ * \param slot the slot, a MIDI program number
+ * \return the patch in flash, NULL if the slot is empty
+ */
+const patch_t *patch_find(uint8_t slot)
+{
+  if (slot >= PATCH_SLOTS)
+  {
+    return NULL;
+  }
+
+  return atomic_load_explicit(&slots[slot], memory_order_acquire);
+}
+
+/**
+ * patch_recall
+ * \brief writes a patch to the parameter store, parameters added since the
+ *        patch was saved take their initial value.
+ * \param patch the patch, may be NULL
+ * \param params the parameter store
+ */
+void patch_recall(const patch_t *patch, param_store_t *params)
+{
+  if (patch == NULL)
+  {
+    return;
+  }
+
+  for (int id = 0; id < PARAM_COUNT; id++)
+  {
+    if (id < patch->count)
+    {
+      param_set_unit(params, (param_id_t)id, (float)patch->value[id] * (1.0f / 65535.0f));
+    }
+    else
+    {
+      param_set(params, (param_id_t)id, param_info((param_id_t)id)->initial);
+    }
+  }
+}
+
+/**
+ * patch_save
+ * \brief takes a copy of the parameters and queues it to be saved.
+ * \param slot the slot, a MIDI program number
+ * \param name the patch name, truncated to PATCH_NAME_LENGTH
+ * \param params the parameter store
+ * \return false if the slot is invalid or the queue is full
+ */
+bool patch_save(uint8_t slot, const char *name, const param_store_t *params)
+{
+  if (slot >= PATCH_SLOTS)
+  {
+    return false;
+  }
+
+  save_request_t request = {.slot = slot};
+
+  strncpy(request.name, name, PATCH_NAME_LENGTH);
+
+  for (int id = 0; id < PARAM_COUNT; id++)
+  {
+    float unit = fminf(fmaxf(param_get_unit(params, (param_id_t)id), 0.0f), 1.0f);
+
+    request.value[id] = (uint16_t)lrintf(unit * 65535.0f);
+  }
+
+  return xQueueSend(save_queue, &request, 0) == pdPASS;
+}
+
+/**
+ * patch_task
+ * \brief writes queued saves, and erases the spare sector while the output is silent.
+ * \param pvParameters - unused
+ */
+static void patch_task(void *pvParameters)
+{
+  save_request_t request;
+
+  while (1)
+  {
+    TickType_t timeout = store.spare_dirty ? pdMS_TO_TICKS(SILENCE_POLL_MS) : portMAX_DELAY;
+
+    if (xQueueReceive(save_queue, &request, timeout) == pdPASS)
+    {
+      if (!save(&request))
+      {
+        RTT_LOG("Patch %u not saved\n", request.slot);
+      }
+    }
+    else if (store.spare_dirty && dae_is_silent())
+    {
+      erase_spare();
+    }
+  }
+}
+
+/**
+ * mount
+ * \brief finds the current sector and builds the slot index, formatting a
+ *        blank or unreadable store.
+ * \return false if formatting failed
+ */
+static bool mount(void)
+{
+  const sector_header_t *a = sector(0);
+  const sector_header_t *b = sector(1);
+
+  if (is_valid(a) && (!is_valid(b) || (int32_t)(a->generation - b->generation) > 0))
+  {
+    store.active = a;
+    store.spare = b;
+  }
+  else if (is_valid(b))
+  {
+    store.active = b;
+    store.spare = a;
+  }
+  else
+  {
+    /* Nothing usable, start again in sector 0 with sector 1 spare */
+    store.active = NULL;
+    store.spare = a;
+  }
+
+  store.spare_dirty = !is_blank(store.spare);
+  store.spare_erases = spare_erases();
+
+  if (store.active == NULL)
+  {
+    if (store.spare_dirty && !erase_spare())
+    {
+      return false;
+    }
+
+    if (!begin_sector(store.spare, 1, store.spare_erases) || !flash_program((uint32_t)(uintptr_t)&store.spare->active, &(uint32_t){0}, 1))
+    {
+      return false;
+    }
+
+    store.active = a;
+    store.spare = b;
+    store.spare_dirty = !is_blank(b);
+    store.spare_erases = spare_erases();
+  }
+
+  scan(store.active);
+
+  RTT_LOG("Patch store generation %lu, erases %lu/%lu\n", (unsigned long)store.active->generation,
+          (unsigned long)store.active->erase_count, (unsigned long)store.spare_erases);
+
+  return true;
+}
+
+/**
+ * scan
+ * \brief walks the records in a sector, pointing each slot at its latest valid
+ *        record and finding the end of the log.
+ * \details a torn record is skipped, its CRC does not match. If a record
+ *          header is unreadable the rest of the sector is treated as used,
+ *          the next save compacts.
+ */
+static void scan(const sector_header_t *sector)
+{
+  uintptr_t p = (uintptr_t)(sector + 1);
+  uintptr_t end = sector_end(sector);
+
+  while (p + sizeof(uint32_t) <= end && *(const uint32_t *)p != ERASED)
+  {
+    const patch_t *record = (const patch_t *)p;
+
+    if (record->magic != PATCH_RECORD_MAGIC || record->words < RECORD_WORDS_MIN ||
+        p + record->words * sizeof(uint32_t) > end)
+    {
+      p = end;
+      break;
+    }
+
+    const uint32_t *words = (const uint32_t *)p;
+
+    if (record->slot < PATCH_SLOTS && crc(words, record->words - 1) == words[record->words - 1])
+    {
+      atomic_store_explicit(&slots[record->slot], record, memory_order_release);
+    }
+
+    p += record->words * sizeof(uint32_t);
+  }
+
+  store.next = p;
+}
+
+/**
+ * save
+ * \brief encodes a queued save as a record and appends it.
+ */
+static bool save(const save_request_t *request)
+{
+  static uint32_t record[RECORD_WORDS_MAX];
+  const size_t words = RECORD_WORDS_MAX;
+  patch_t *patch = (patch_t *)record;
+
+  memset(record, 0, sizeof(record));
+
+  patch->magic = PATCH_RECORD_MAGIC;
+  patch->words = words;
+  patch->slot = request->slot;
+  patch->count = PARAM_COUNT;
+  memcpy(patch->name, request->name, PATCH_NAME_LENGTH);
+  memcpy(patch->value, request->value, sizeof(request->value));
+
+  record[words - 1] = crc(record, words - 1);
+
+  return append(record, words);
+}
+
+/**
+ * append
+ * \brief programs a record at the end of the log, compacting first if it does not fit.
+ */
+static bool append(const uint32_t *record, size_t words)
+{
+  if (store.next + words * sizeof(uint32_t) > sector_end(store.active) && !compact(words))
+  {
+    return false;
+  }
+
+  uintptr_t address = store.next;
+
+  /* A failed program leaves a torn record, step over it */
+  store.next += words * sizeof(uint32_t);
+
+  if (!flash_program((uint32_t)address, record, words))
+  {
+    return false;
+  }
+
+  const patch_t *patch = (const patch_t *)address;
+  atomic_store_explicit(&slots[patch->slot], patch, memory_order_release);
+
+  return true;
+}
+
+/**
+ * compact
+ * \brief copies the latest record of each slot to the spare sector and makes it active.
+ * \details the old sector becomes the spare, it is erased later while the output
+ *          is silent. The index keeps pointing at the old copies until the new
+ *          sector is active, they hold the same bytes.
+ * \param words space needed after compaction
+ */
+static bool compact(size_t words)
+{
+  if (store.spare_dirty && !erase_spare())
+  {
+    return false;
+  }
+
+  const sector_header_t *from = store.active;
+  const sector_header_t *to = store.spare;
+
+  /* Anything written from here on must be erased before the sector is reused */
+  store.spare_dirty = true;
+
+  if (!begin_sector(to, from->generation + 1, store.spare_erases))
+  {
+    return false;
+  }
+
+  uintptr_t p = (uintptr_t)(to + 1);
+
+  for (int slot = 0; slot < PATCH_SLOTS; slot++)
+  {
+    const patch_t *patch = atomic_load_explicit(&slots[slot], memory_order_relaxed);
+
+    if (patch == NULL)
+    {
+      continue;
+    }
+
+    if (!flash_program((uint32_t)p, (const uint32_t *)patch, patch->words))
+    {
+      return false;
+    }
+
+    p += patch->words * sizeof(uint32_t);
+  }
+
+  RTT_ASSERT(p + words * sizeof(uint32_t) <= sector_end(to));
+
+  if (!flash_program((uint32_t)(uintptr_t)&to->active, &(uint32_t){0}, 1))
+  {
+    return false;
+  }
+
+  store.active = to;
+  store.spare = from;
+  store.spare_erases = from->erase_count;
+  scan(to);
+
+  return true;
+}
+
+/**
+ * erase_spare
+ * \brief erases the spare sector once the output is silent, with MIDI input stopped.
+ * \return false if the erase failed, or the output did not go silent within
+ *         DAE_HOLD_TIMEOUT_MS and nothing was erased
+ */
+static bool erase_spare(void)
+{
+  if (!dae_flash_erase((uint32_t)(uintptr_t)store.spare))
+  {
+    return false;
+  }
+
+  /* The erase wiped the count with the header, put it straight back */
+  store.spare_erases++;
+  store.spare_dirty = !stamp_sector(store.spare, store.spare_erases);
+
+  return !store.spare_dirty;
+}
+
+/**
+ * stamp_sector
+ * \brief writes the erase count and magic of a freshly erased sector, the
+ *        generation stays erased until begin_sector().
+ * \details the magic goes last, a stamp cut short never has a torn count behind
+ *          a good magic.
+ */
+static bool stamp_sector(const sector_header_t *sector, uint32_t erase_count)
+{
+  return flash_program((uint32_t)(uintptr_t)&sector->erase_count, &erase_count, 1) &&
+         flash_program((uint32_t)(uintptr_t)&sector->magic, &(uint32_t){PATCH_SECTOR_MAGIC}, 1);
+}
+
+/**
+ * begin_sector
+ * \brief writes the generation of a blank sector, and its stamp if the erase
+ *        left none, leaving it inactive.
+ */
+static bool begin_sector(const sector_header_t *sector, uint32_t generation, uint32_t erase_count)
+{
+  if (sector->magic != PATCH_SECTOR_MAGIC && !stamp_sector(sector, erase_count))
+  {
+    return false;
+  }
+
+  return flash_program((uint32_t)(uintptr_t)&sector->generation, &generation, 1);
+}
+
+/**
+ * is_valid
+ * \brief true if a sector holds a complete log.
+ */
+static bool is_valid(const sector_header_t *sector)
+{
+  return sector->magic == PATCH_SECTOR_MAGIC && sector->active == 0;
+}
+
+/**
+ * is_blank
+ * \brief true if a sector is erased but for its stamp, an interrupted erase or
+ *        copy leaves words that are not.
+ */
+static bool is_blank(const sector_header_t *sector)
+{
+  const uint32_t *p = (const uint32_t *)&sector->generation;
+  const uint32_t *end = (const uint32_t *)sector_end(sector);
+
+  /* A count without the magic is a stamp cut short */
+  if (sector->magic != PATCH_SECTOR_MAGIC && (sector->magic != ERASED || sector->erase_count != ERASED))
+  {
+    return false;
+  }
+
+  for (; p < end; p++)
+  {
+    if (p != &sector->erase_count && *p != ERASED)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * spare_erases
+ * \brief the erase count of the spare sector from its header or stamp, one
+ *        without the magic lost it to a power cut straight after the erase and
+ *        the active count stands in.
+ */
+static uint32_t spare_erases(void)
+{
+  if (store.spare->magic == PATCH_SECTOR_MAGIC)
+  {
+    return store.spare->erase_count;
+  }
+
+  return store.active != NULL ? store.active->erase_count : 0;
+}
+
+/**
+ * crc
+ * \brief CRC-32/MPEG-2 of a block of words, the same as the CRC unit computes.
+ * \details done in software, the CRC unit belongs to the bank transfer task.
+ */
+static uint32_t crc(const uint32_t *data, size_t words)
+{
+  uint32_t crc = 0xFFFFFFFFU;
+
+  for (size_t i = 0; i < words; i++)
+  {
+    crc ^= data[i];
+
+    for (int bit = 0; bit < 32; bit++)
+    {
+      crc = (crc & 0x80000000U) ? (crc << 1) ^ 0x04C11DB7U : crc << 1;
+    }
+  }
+
+  return crc;
+}
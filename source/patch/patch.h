@@ -0,0 +1,75 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef PATCH_H
+#define PATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "param.h"
+
+/*
+  Patch store, a log of patches in two flash sectors (PATCHES in the linker
+  script).
+
+  Saving a patch appends a record to the active sector, nothing is ever
+  overwritten in place, so every location in the sector is written once
+  per erase. When the active sector is full the latest record of each slot
+  is copied to the spare sector, which then becomes active with a higher
+  generation number. The two sectors swap roles at each compaction and wear
+  evenly, each records its own erase count.
+
+  Power loss at any point leaves the last complete save readable: records
+  carry a CRC and are skipped if torn, a sector only counts once its active
+  mark is programmed after the copy, and of two active sectors the higher
+  generation wins.
+
+  Records are read in place from memory-mapped flash. An index in RAM holds
+  the latest record of each slot, recall is a lookup and one parameter write
+  per value, cheap enough to run in the DAE task on a program change.
+
+  Saves are queued to a low priority task. Erasing a sector stalls every
+  flash fetch for a second or more, the DAE and the MIDI interrupts
+  included, so the spare sector is erased in the background only while the
+  DAE output is silent, through dae_flash_erase(). A save that needs a
+  compaction before that has happened waits for silence, up to
+  DAE_HOLD_TIMEOUT_MS, and fails if there is none. The store is left as
+  it was and the save can be made again.
+*/
+
+/* Slots, one per MIDI program number */
+#define PATCH_SLOTS (128)
+
+/* Name characters, not terminated when all are used */
+#define PATCH_NAME_LENGTH (12)
+
+/* A stored patch, read in place from flash */
+typedef struct
+{
+  uint16_t magic;
+  uint16_t words;               /* Record size in words, CRC included */
+  uint8_t slot;
+  uint8_t count;                /* Values stored */
+  uint16_t reserved;
+  char name[PATCH_NAME_LENGTH];
+  uint16_t value[];             /* 0-65535 control position, indexed by param_id_t */
+
+  /* Followed by the CRC-32 of the record, in the last word */
+} patch_t;
+
+/* API */
+bool patch_start(UBaseType_t priority);
+const patch_t *patch_find(uint8_t slot);
+void patch_recall(const patch_t *patch, param_store_t *params);
+bool patch_save(uint8_t slot, const char *name, const param_store_t *params);
+
+#endif /* PATCH_H */
@@ -0,0 +1,270 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "arp.h"
+#include "trace.h"
+
+/* Private functions */
+static uint8_t next_note(arp_t *arp, uint8_t *velocity);
+static void remove_note(uint8_t *notes, uint8_t count, uint8_t note);
+static void add_event(midi_event_t *event, uint32_t time, uint8_t status, uint8_t note, uint8_t velocity);
+
+/**
+ * arp_init
+ * \brief initialises the arpeggiator, up over one octave, sixteenths, half gate.
+ * \param arp the arpeggiator
+ */
+void arp_init(arp_t *arp)
+{
+  RTT_ASSERT(arp != NULL);
+
+  memset(arp, 0, sizeof(arp_t));
+  arp->random = 0x2545F491;
+  arp->note = ARP_NOTE_NONE;
+
+  arp_set(arp, ARP_UP, 1, 6, 0.5f, 0.0f);
+}
+
+/**
+ * arp_set
+ * \brief sets the pattern, a new rate restarts the steps on the grid.
+ * \param arp the arpeggiator
+ * \param mode the note order
+ * \param octaves the octave range, 1-4
+ * \param rate clock ticks per step, 6 for sixteenths
+ * \param gate note length as a fraction of a step
+ * \param swing delay of every second step as a fraction of a step, 0-0.5
+ */
+void arp_set(arp_t *arp, arp_mode_t mode, uint8_t octaves, uint8_t rate, float gate, float swing)
+{
+  arp->mode = mode < ARP_MODES ? mode : ARP_UP;
+  arp->octaves = octaves < 1 ? 1 : (octaves > ARP_MAX_OCTAVES ? ARP_MAX_OCTAVES : octaves);
+  arp->gate = gate;
+
+  if (rate != arp->steps.rate)
+  {
+    tempo_steps_init(&arp->steps, rate, swing);
+  }
+  else
+  {
+    arp->steps.swing = swing;
+  }
+}
+
+/**
+ * arp_note_on
+ * \brief adds a held key, the first key restarts the pattern.
+ * \param arp the arpeggiator
+ * \param channel the key's MIDI channel, the notes play on the latest
+ * \param note the note number
+ * \param velocity the velocity, 0 is a note off
+ */
+void arp_note_on(arp_t *arp, uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  if (velocity == 0)
+  {
+    arp_note_off(arp, note);
+    return;
+  }
+
+  arp->channel = channel;
+
+  if (arp->velocity[note] != 0)
+  {
+    arp->velocity[note] = velocity;
+    return;
+  }
+
+  if (arp->count == ARP_MAX_NOTES)
+  {
+    return;
+  }
+
+  if (arp->count == 0)
+  {
+    arp->position = 0;
+  }
+
+  arp->velocity[note] = velocity;
+  arp->order[arp->count] = note;
+
+  /* Insert into the sorted keys */
+  uint8_t i = arp->count;
+  while (i > 0 && arp->sorted[i - 1] > note)
+  {
+    arp->sorted[i] = arp->sorted[i - 1];
+    i--;
+  }
+  arp->sorted[i] = note;
+
+  arp->count++;
+}
+
+/**
+ * arp_note_off
+ * \brief removes a held key, a note it is sounding plays to the end of its gate.
+ * \param arp the arpeggiator
+ * \param note the note number
+ */
+void arp_note_off(arp_t *arp, uint8_t note)
+{
+  if (arp->velocity[note] == 0)
+  {
+    return;
+  }
+
+  arp->velocity[note] = 0;
+  remove_note(arp->order, arp->count, note);
+  remove_note(arp->sorted, arp->count, note);
+  arp->count--;
+}
+
+/**
+ * arp_clear
+ * \brief releases every held key.
+ * \param arp the arpeggiator
+ */
+void arp_clear(arp_t *arp)
+{
+  arp->count = 0;
+  memset(arp->velocity, 0, sizeof(arp->velocity));
+}
+
+/**
+ * arp_process
+ * \brief generates the note events of one block.
+ * \details called every block even with no keys held, so the last note off
+ *          is sent. The cost is the number of steps in the block.
+ * \param arp the arpeggiator
+ * \param grid the block position, from tempo_block()
+ * \param events receives the events in time order, timestamped with their sample time
+ * \param max the space in events, at least ARP_STEP_EVENTS
+ * \return the number of events
+ */
+size_t arp_process(arp_t *arp, const tempo_grid_t *grid, midi_event_t *events, size_t max)
+{
+  size_t count = 0;
+  uint32_t step;
+  size_t offset;
+
+  while (count + ARP_STEP_EVENTS <= max && tempo_next_step(&arp->steps, grid, &step, &offset))
+  {
+    uint32_t time = grid->time + (uint32_t)offset;
+
+    /* The last note ends at its gate, or at this step if the gate is longer */
+    if (arp->note != ARP_NOTE_NONE)
+    {
+      uint32_t off = (int32_t)(arp->note_off - time) < 0 ? arp->note_off : time;
+      add_event(&events[count++], off, MIDI_NOTE_OFF | arp->note_channel, arp->note, 0);
+      arp->note = ARP_NOTE_NONE;
+    }
+
+    if (arp->count == 0)
+    {
+      continue;
+    }
+
+    uint8_t velocity;
+    uint8_t note = next_note(arp, &velocity);
+    float length = arp->gate * tempo_step_samples(&arp->steps, grid);
+
+    add_event(&events[count++], time, MIDI_NOTE_ON | arp->channel, note, velocity);
+    arp->note = note;
+    arp->note_channel = arp->channel;
+    arp->note_off = time + (length >= 1.0f ? (uint32_t)length : 1);
+  }
+
+  if (arp->note != ARP_NOTE_NONE && count < max && tempo_due(grid, arp->note_off, &offset))
+  {
+    add_event(&events[count++], grid->time + (uint32_t)offset, MIDI_NOTE_OFF | arp->note_channel, arp->note, 0);
+    arp->note = ARP_NOTE_NONE;
+  }
+
+  return count;
+}
+
+/**
+ * next_note
+ * \brief the note of the next step in the pattern.
+ * \param arp the arpeggiator, with at least one key held
+ * \param velocity receives the velocity of the key
+ * \return the note number
+ */
+static uint8_t next_note(arp_t *arp, uint8_t *velocity)
+{
+  uint32_t length = (uint32_t)arp->count * arp->octaves;
+  uint32_t index = arp->position % length;
+
+  switch (arp->mode)
+  {
+  case ARP_DOWN:
+    index = length - 1 - index;
+    break;
+
+  case ARP_RANDOM:
+    arp->random ^= arp->random << 13;
+    arp->random ^= arp->random >> 17;
+    arp->random ^= arp->random << 5;
+    index = arp->random % length;
+    break;
+
+  default:
+    break;
+  }
+
+  arp->position++;
+
+  uint8_t key = (arp->mode == ARP_ORDER) ? arp->order[index % arp->count] : arp->sorted[index % arp->count];
+  uint32_t note = key + 12 * (index / arp->count);
+
+  /* Octaves above the top of the MIDI range fold back */
+  while (note > 127)
+  {
+    note -= 12;
+  }
+
+  *velocity = arp->velocity[key];
+
+  return (uint8_t)note;
+}
+
+/**
+ * remove_note
+ * \brief removes a note from a list of keys, closing the gap.
+ * \param notes the keys
+ * \param count the number of keys
+ * \param note the note to remove
+ */
+static void remove_note(uint8_t *notes, uint8_t count, uint8_t note)
+{
+  uint8_t i = 0;
+
+  while (i < count && notes[i] != note)
+  {
+    i++;
+  }
+
+  if (i < count)
+  {
+    memmove(&notes[i], &notes[i + 1], count - i - 1);
+  }
+}
+
+/**
+ * add_event
+ * \brief fills in a note event.
+ */
+static void add_event(midi_event_t *event, uint32_t time, uint8_t status, uint8_t note, uint8_t velocity)
+{
+  event->timestamp = time;
+  event->status = status;
+  event->data[0] = note;
+  event->data[1] = velocity;
+}
@@ -0,0 +1,83 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef ARP_H
+#define ARP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "midi.h"
+#include "tempo.h"
+
+/*
+  Arpeggiator.
+
+  Held keys are played one at a time on the steps of the tempo grid,
+  stepping through the pattern in the selected mode and repeating it over
+  the octave range. The arpeggiator produces note events timestamped with
+  the sample time of their step, so they play at the right sample in the
+  block whatever the block size and however the DAE task was scheduled.
+
+  The pattern restarts when the first key goes down and plays only while a
+  key is held, the last note ends at its gate.
+*/
+
+/* Keys held at once */
+#define ARP_MAX_NOTES (16)
+
+/* Octaves the pattern repeats over */
+#define ARP_MAX_OCTAVES (4)
+
+/* Events arp_process() can produce for one step, the note off of the last step and the note on */
+#define ARP_STEP_EVENTS (2)
+
+/* Note order */
+typedef enum
+{
+  ARP_UP,
+  ARP_DOWN,
+  ARP_RANDOM,
+  ARP_ORDER, /* The order the keys were pressed */
+  ARP_MODES,
+} arp_mode_t;
+
+/* Arpeggiator state */
+typedef struct
+{
+  arp_mode_t mode;
+  uint8_t octaves;
+  float gate;                     /* Note length, fraction of a step */
+  tempo_steps_t steps;
+
+  uint8_t count;                  /* Keys held */
+  uint8_t order[ARP_MAX_NOTES];   /* Held keys in the order pressed */
+  uint8_t sorted[ARP_MAX_NOTES];  /* Held keys lowest first */
+  uint8_t velocity[128];          /* Velocity of each held key */
+  uint8_t channel;                /* Channel of the latest key */
+
+  uint32_t position;              /* Steps played since the first key */
+  uint32_t random;                /* xorshift state */
+
+  uint8_t note;                   /* Note sounding, ARP_NOTE_NONE if none */
+  uint8_t note_channel;
+  uint32_t note_off;              /* Sample time its note off is due */
+} arp_t;
+
+#define ARP_NOTE_NONE (0xFF)
+
+/* API */
+void arp_init(arp_t *arp);
+void arp_set(arp_t *arp, arp_mode_t mode, uint8_t octaves, uint8_t rate, float gate, float swing);
+void arp_note_on(arp_t *arp, uint8_t channel, uint8_t note, uint8_t velocity);
+void arp_note_off(arp_t *arp, uint8_t note);
+void arp_clear(arp_t *arp);
+size_t arp_process(arp_t *arp, const tempo_grid_t *grid, midi_event_t *events, size_t max);
+
+#endif /* ARP_H */
@@ -0,0 +1,272 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+
+/* Generated by tools/gen_body_ir.py, do not edit. */
+
+#include "synth.h"
+
+const float synth_body_ir[SYNTH_BODY_IR_LENGTH] =
+{
+  4.273282868e-03f, 2.635294268e-02f, 7.453638265e-02f, 1.313959309e-01f,
+  1.662334448e-01f, 1.635112719e-01f, 1.291213563e-01f, 7.928823953e-02f,
+  2.976302789e-02f, -9.502173785e-03f, -3.492490318e-02f, -4.744183113e-02f,
+  -5.017722718e-02f, -4.665436234e-02f, -3.981916726e-02f, -3.173124569e-02f,
+  -2.364683330e-02f, -1.625044014e-02f, -9.882967842e-03f, -4.701619894e-03f,
+  -7.654820400e-04f, 1.931731144e-03f, 3.454935057e-03f, 3.926434116e-03f,
+  3.519347659e-03f, 2.443093907e-03f, 9.233109622e-04f, -8.195420454e-04f,
+  -2.588953389e-03f, -4.225903439e-03f, -5.616166565e-03f, -6.691648263e-03f,
+  -7.426866106e-03f, -7.832057996e-03f, -7.944428501e-03f, -7.818854454e-03f,
+  -7.519077134e-03f, -7.110089548e-03f, -6.652131198e-03f, -6.196452444e-03f,
+  -5.782814450e-03f, -5.438548433e-03f, -5.178905385e-03f, -5.008378767e-03f,
+  -4.922670935e-03f, -4.910991956e-03f, -4.958419283e-03f, -5.048100692e-03f,
+  -5.163143689e-03f, -5.288095697e-03f, -5.409975588e-03f, -5.518864633e-03f,
+  -5.608101536e-03f, -5.674150954e-03f, -5.716228260e-03f, -5.735766497e-03f,
+  -5.735806491e-03f, -5.720380095e-03f, -5.693941855e-03f, -5.660888079e-03f,
+  -5.625186141e-03f, -5.590122230e-03f, -5.558163671e-03f, -5.530922746e-03f,
+  -5.509202990e-03f, -5.493105895e-03f, -5.482175499e-03f, -5.475559986e-03f,
+  -5.472172474e-03f, -5.470837159e-03f, -5.470411275e-03f, -5.469877512e-03f,
+  -5.468405316e-03f, -5.465382500e-03f, -5.460420934e-03f, -5.453341451e-03f,
+  -5.444143860e-03f, -5.432967909e-03f, -5.420050606e-03f, -5.405684391e-03f,
+  -5.390179638e-03f, -5.373833795e-03f, -5.356908421e-03f, -5.339614368e-03f,
+  -5.322104646e-03f, -5.304473895e-03f, -5.286763074e-03f, -5.268967815e-03f,
+  -5.251048914e-03f, -5.232943572e-03f, -5.214576249e-03f, -5.195868265e-03f,
+  -5.176745583e-03f, -5.157144499e-03f, -5.137015191e-03f, -5.116323299e-03f,
+  -5.095049812e-03f, -5.073189658e-03f, -5.050749390e-03f, -5.027744377e-03f,
+  -5.004195847e-03f, -4.980128077e-03f, -4.955565936e-03f, -4.930532925e-03f,
+  -4.905049772e-03f, -4.879133583e-03f, -4.852797504e-03f, -4.826050809e-03f,
+  -4.798899314e-03f, -4.771346008e-03f, -4.743391804e-03f, -4.715036311e-03f,
+  -4.686278555e-03f, -4.657117609e-03f, -4.627553080e-03f, -4.597585449e-03f,
+  -4.567216277e-03f, -4.536448266e-03f, -4.505285220e-03f, -4.473731926e-03f,
+  -4.441793975e-03f, -4.409477564e-03f, -4.376789291e-03f, -4.343735966e-03f,
+  -4.310324450e-03f, -4.276561531e-03f, -4.242453838e-03f, -4.208007791e-03f,
+  -4.173229589e-03f, -4.138125220e-03f, -4.102700494e-03f, -4.066961091e-03f,
+  -4.030912608e-03f, -3.994560612e-03f, -3.957910690e-03f, -3.920968480e-03f,
+  -3.883739708e-03f, -3.846230202e-03f, -3.808445902e-03f, -3.770392863e-03f,
+  -3.732077246e-03f, -3.693505305e-03f, -3.654683380e-03f, -3.615617872e-03f,
+  -3.576315234e-03f, -3.536781956e-03f, -3.497024551e-03f, -3.457049547e-03f,
+  -3.416863482e-03f, -3.376472896e-03f, -3.335884334e-03f, -3.295104342e-03f,
+  -3.254139470e-03f, -3.212996273e-03f, -3.171681314e-03f, -3.130201165e-03f,
+  -3.088562409e-03f, -3.046771642e-03f, -3.004835472e-03f, -2.962760518e-03f,
+  -2.920553413e-03f, -2.878220797e-03f, -2.835769317e-03f, -2.793205630e-03f,
+  -2.750536390e-03f, -2.707768256e-03f, -2.664907883e-03f, -2.621961923e-03f,
+  -2.578937021e-03f, -2.535839814e-03f, -2.492676931e-03f, -2.449454986e-03f,
+  -2.406180584e-03f, -2.362860314e-03f, -2.319500750e-03f, -2.276108451e-03f,
+  -2.232689956e-03f, -2.189251788e-03f, -2.145800451e-03f, -2.102342425e-03f,
+  -2.058884170e-03f, -2.015432125e-03f, -1.971992701e-03f, -1.928572285e-03f,
+  -1.885177237e-03f, -1.841813889e-03f, -1.798488544e-03f, -1.755207472e-03f,
+  -1.711976914e-03f, -1.668803075e-03f, -1.625692128e-03f, -1.582650210e-03f,
+  -1.539683419e-03f, -1.496797818e-03f, -1.453999429e-03f, -1.411294237e-03f,
+  -1.368688181e-03f, -1.326187164e-03f, -1.283797040e-03f, -1.241523624e-03f,
+  -1.199372683e-03f, -1.157349938e-03f, -1.115461065e-03f, -1.073711691e-03f,
+  -1.032107393e-03f, -9.906536999e-04f, -9.493560896e-04f, -9.082199884e-04f,
+  -8.672507700e-04f, -8.264537550e-04f, -7.858342101e-04f, -7.453973470e-04f,
+  -7.051483217e-04f, -6.650922338e-04f, -6.252341259e-04f, -5.855789823e-04f,
+  -5.461317290e-04f, -5.068972325e-04f, -4.678802991e-04f, -4.290856747e-04f,
+  -3.905180437e-04f, -3.521820283e-04f, -3.140821886e-04f, -2.762230209e-04f,
+  -2.386089582e-04f, -2.012443689e-04f, -1.641335565e-04f, -1.272807592e-04f,
+  -9.069014928e-05f, -5.436583241e-05f, -1.831184752e-05f, 1.746783387e-05f,
+  5.296930805e-05f, 8.818873950e-05f, 1.231223614e-04f, 1.577664758e-04f,
+  1.921174544e-04f, 2.261717383e-04f, 2.599258390e-04f, 2.933763382e-04f,
+  3.265198885e-04f, 3.593532131e-04f, 3.918731068e-04f, 4.240764359e-04f,
+  4.559601383e-04f, 4.875212239e-04f, 5.187567747e-04f, 5.496639451e-04f,
+  5.802399620e-04f, 6.104821251e-04f, 6.403878066e-04f, 6.699544518e-04f,
+  6.991795790e-04f, 7.280607795e-04f, 7.565957179e-04f, 7.847821321e-04f,
+  8.126178329e-04f, 8.401007046e-04f, 8.672287050e-04f, 8.939998649e-04f,
+  9.204122883e-04f, 9.464641526e-04f, 9.721537084e-04f, 9.974792792e-04f,
+  1.022439262e-03f, 1.047032125e-03f, 1.071256412e-03f, 1.095110737e-03f,
+  1.118593788e-03f, 1.141704325e-03f, 1.164441180e-03f, 1.186803256e-03f,
+  1.208789530e-03f, 1.230399049e-03f, 1.251630931e-03f, 1.272484367e-03f,
+  1.292958618e-03f, 1.313053015e-03f, 1.332766959e-03f, 1.352099922e-03f,
+  1.371051446e-03f, 1.389621142e-03f, 1.407808690e-03f, 1.425613838e-03f,
+  1.443036403e-03f, 1.460076270e-03f, 1.476733393e-03f, 1.493007791e-03f,
+  1.508899551e-03f, 1.524408826e-03f, 1.539535835e-03f, 1.554280864e-03f,
+  1.568644262e-03f, 1.582626444e-03f, 1.596227888e-03f, 1.609449138e-03f,
+  1.622290799e-03f, 1.634753540e-03f, 1.646838091e-03f, 1.658545245e-03f,
+  1.669875856e-03f, 1.680830838e-03f, 1.691411166e-03f, 1.701617874e-03f,
+  1.711452055e-03f, 1.720914861e-03f, 1.730007501e-03f, 1.738731241e-03f,
+  1.747087406e-03f, 1.755077375e-03f, 1.762702583e-03f, 1.769964519e-03f,
+  1.776864729e-03f, 1.783404809e-03f, 1.789586410e-03f, 1.795411235e-03f,
+  1.800881040e-03f, 1.805997630e-03f, 1.810762860e-03f, 1.815178638e-03f,
+  1.819246917e-03f, 1.822969701e-03f, 1.826349041e-03f, 1.829387035e-03f,
+  1.832085826e-03f, 1.834447605e-03f, 1.836474606e-03f, 1.838169107e-03f,
+  1.839533432e-03f, 1.840569944e-03f, 1.841281051e-03f, 1.841669201e-03f,
+  1.841736882e-03f, 1.841486624e-03f, 1.840920994e-03f, 1.840042597e-03f,
+  1.838854079e-03f, 1.837358118e-03f, 1.835557433e-03f, 1.833454774e-03f,
+  1.831052928e-03f, 1.828354717e-03f, 1.825362993e-03f, 1.822080642e-03f,
+  1.818510583e-03f, 1.814655763e-03f, 1.810519161e-03f, 1.806103785e-03f,
+  1.801412672e-03f, 1.796448885e-03f, 1.791215515e-03f, 1.785715681e-03f,
+  1.779952524e-03f, 1.773929214e-03f, 1.767648941e-03f, 1.761114921e-03f,
+  1.754330391e-03f, 1.747298610e-03f, 1.740022858e-03f, 1.732506435e-03f,
+  1.724752661e-03f, 1.716764874e-03f, 1.708546430e-03f, 1.700100703e-03f,
+  1.691431082e-03f, 1.682540972e-03f, 1.673433794e-03f, 1.664112982e-03f,
+  1.654581984e-03f, 1.644844260e-03f, 1.634903282e-03f, 1.624762534e-03f,
+  1.614425510e-03f, 1.603895713e-03f, 1.593176656e-03f, 1.582271860e-03f,
+  1.571184853e-03f, 1.559919170e-03f, 1.548478352e-03f, 1.536865947e-03f,
+  1.525085505e-03f, 1.513140582e-03f, 1.501034735e-03f, 1.488771527e-03f,
+  1.476354520e-03f, 1.463787279e-03f, 1.451073367e-03f, 1.438216350e-03f,
+  1.425219791e-03f, 1.412087252e-03f, 1.398822294e-03f, 1.385428473e-03f,
+  1.371909342e-03f, 1.358268452e-03f, 1.344509347e-03f, 1.330635566e-03f,
+  1.316650643e-03f, 1.302558103e-03f, 1.288361467e-03f, 1.274064245e-03f,
+  1.259669941e-03f, 1.245182047e-03f, 1.230604048e-03f, 1.215939417e-03f,
+  1.201191617e-03f, 1.186364099e-03f, 1.171460302e-03f, 1.156483653e-03f,
+  1.141437565e-03f, 1.126325437e-03f, 1.111150654e-03f, 1.095916587e-03f,
+  1.080626591e-03f, 1.065284006e-03f, 1.049892153e-03f, 1.034454338e-03f,
+  1.018973850e-03f, 1.003453960e-03f, 9.878979184e-04f, 9.723089593e-04f,
+  9.566902961e-04f, 9.410451225e-04f, 9.253766121e-04f, 9.096879175e-04f,
+  8.939821701e-04f, 8.782624798e-04f, 8.625319342e-04f, 8.467935984e-04f,
+  8.310505145e-04f, 8.153057015e-04f, 7.995621543e-04f, 7.838228437e-04f,
+  7.680907160e-04f, 7.523686927e-04f, 7.366596697e-04f, 7.209665174e-04f,
+  7.052920801e-04f, 6.896391757e-04f, 6.740105955e-04f, 6.584091034e-04f,
+  6.428374363e-04f, 6.272983031e-04f, 6.117943847e-04f, 5.963283339e-04f,
+  5.809027746e-04f, 5.655203018e-04f, 5.501834815e-04f, 5.348948499e-04f,
+  5.196569138e-04f, 5.044721498e-04f, 4.893430043e-04f, 4.742718931e-04f,
+  4.592612015e-04f, 4.443132835e-04f, 4.294304623e-04f, 4.146150295e-04f,
+  3.998692452e-04f, 3.851953375e-04f, 3.705955029e-04f, 3.560719053e-04f,
+  3.416266767e-04f, 3.272619163e-04f, 3.129796907e-04f, 2.987820339e-04f,
+  2.846709467e-04f, 2.706483970e-04f, 2.567163193e-04f, 2.428766149e-04f,
+  2.291311517e-04f, 2.154817640e-04f, 2.019302524e-04f, 1.884783838e-04f,
+  1.751278913e-04f, 1.618804742e-04f, 1.487377976e-04f, 1.357014927e-04f,
+  1.227731568e-04f, 1.099543527e-04f, 9.724660928e-05f, 8.465142125e-05f,
+  7.217024897e-05f, 5.980451859e-05f, 4.755562203e-05f, 3.542491691e-05f,
+  2.341372660e-05f, 1.152334024e-05f, -2.449873009e-07f, -1.189003536e-05f,
+  -2.341061747e-05f, -3.480558131e-05f, -4.607380868e-05f, -5.721421544e-05f,
+  -6.822575148e-05f, -7.910740062e-05f, -8.985818059e-05f, -1.004771429e-04f,
+  -1.109633729e-04f, -1.213159893e-04f, -1.315341448e-04f, -1.416170253e-04f,
+  -1.515638500e-04f, -1.613738715e-04f, -1.710463755e-04f, -1.805806807e-04f,
+  -1.899761386e-04f, -1.992321337e-04f, -2.083480830e-04f, -2.173234358e-04f,
+  -2.261576739e-04f, -2.348503114e-04f, -2.434008942e-04f, -2.518090003e-04f,
+  -2.600742390e-04f, -2.681962516e-04f, -2.761747103e-04f, -2.840093188e-04f,
+  -2.916998116e-04f, -2.992459539e-04f, -3.066475418e-04f, -3.139044013e-04f,
+  -3.210163890e-04f, -3.279833913e-04f, -3.348053242e-04f, -3.414821335e-04f,
+  -3.480137941e-04f, -3.544003100e-04f, -3.606417142e-04f, -3.667380681e-04f,
+  -3.726894615e-04f, -3.784960124e-04f, -3.841578668e-04f, -3.896751980e-04f,
+  -3.950482069e-04f, -4.002771215e-04f, -4.053621966e-04f, -4.103037137e-04f,
+  -4.151019804e-04f, -4.197573304e-04f, -4.242701235e-04f, -4.286407445e-04f,
+  -4.328696039e-04f, -4.369571367e-04f, -4.409038028e-04f, -4.447100864e-04f,
+  -4.483764959e-04f, -4.519035632e-04f, -4.552918439e-04f, -4.585419166e-04f,
+  -4.616543831e-04f, -4.646298674e-04f, -4.674690160e-04f, -4.701724973e-04f,
+  -4.727410012e-04f, -4.751752393e-04f, -4.774759440e-04f, -4.796438683e-04f,
+  -4.816797858e-04f, -4.835844902e-04f, -4.853587947e-04f, -4.870035322e-04f,
+  -4.885195547e-04f, -4.899077327e-04f, -4.911689555e-04f, -4.923041304e-04f,
+  -4.933141825e-04f, -4.942000545e-04f, -4.949627060e-04f, -4.956031137e-04f,
+  -4.961222705e-04f, -4.965211858e-04f, -4.968008845e-04f, -4.969624073e-04f,
+  -4.970068097e-04f, -4.969351623e-04f, -4.967485502e-04f, -4.964480724e-04f,
+  -4.960348420e-04f, -4.955099854e-04f, -4.948746421e-04f, -4.941299647e-04f,
+  -4.932771181e-04f, -4.923172791e-04f, -4.912516368e-04f, -4.900813913e-04f,
+  -4.888077542e-04f, -4.874319477e-04f, -4.859552045e-04f, -4.843787674e-04f,
+  -4.827038891e-04f, -4.809318317e-04f, -4.790638665e-04f, -4.771012735e-04f,
+  -4.750453413e-04f, -4.728973666e-04f, -4.706586539e-04f, -4.683305151e-04f,
+  -4.659142694e-04f, -4.634112429e-04f, -4.608227681e-04f, -4.581501837e-04f,
+  -4.553948343e-04f, -4.525580701e-04f, -4.496412464e-04f, -4.466457235e-04f,
+  -4.435728664e-04f, -4.404240443e-04f, -4.372006303e-04f, -4.339040012e-04f,
+  -4.305355374e-04f, -4.270966219e-04f, -4.235886409e-04f, -4.200129826e-04f,
+  -4.163710378e-04f, -4.126641988e-04f, -4.088938595e-04f, -4.050614151e-04f,
+  -4.011682618e-04f, -3.972157963e-04f, -3.932054159e-04f, -3.891385177e-04f,
+  -3.850164988e-04f, -3.808407558e-04f, -3.766126845e-04f, -3.723336795e-04f,
+  -3.680051343e-04f, -3.636284408e-04f, -3.592049889e-04f, -3.547361664e-04f,
+  -3.502233587e-04f, -3.456679487e-04f, -3.410713162e-04f, -3.364348377e-04f,
+  -3.317598867e-04f, -3.270478325e-04f, -3.223000408e-04f, -3.175178730e-04f,
+  -3.127026862e-04f, -3.078558325e-04f, -3.029786594e-04f, -2.980725092e-04f,
+  -2.931387188e-04f, -2.881786194e-04f, -2.831935364e-04f, -2.781847893e-04f,
+  -2.731536912e-04f, -2.681015485e-04f, -2.630296614e-04f, -2.579393226e-04f,
+  -2.528318180e-04f, -2.477084262e-04f, -2.425704181e-04f, -2.374190569e-04f,
+  -2.322555979e-04f, -2.270812882e-04f, -2.218973666e-04f, -2.167050636e-04f,
+  -2.115056007e-04f, -2.063001907e-04f, -2.010900373e-04f, -1.958763350e-04f,
+  -1.906602689e-04f, -1.854430146e-04f, -1.802257380e-04f, -1.750095949e-04f,
+  -1.697957312e-04f, -1.645852828e-04f, -1.593793749e-04f, -1.541791224e-04f,
+  -1.489856297e-04f, -1.437999901e-04f, -1.386232862e-04f, -1.334565895e-04f,
+  -1.283009603e-04f, -1.231574477e-04f, -1.180270893e-04f, -1.129109110e-04f,
+  -1.078099273e-04f, -1.027251407e-04f, -9.765754191e-05f, -9.260810964e-05f,
+  -8.757781045e-05f, -8.256759871e-05f, -7.757841648e-05f, -7.261119344e-05f,
+  -6.766684675e-05f, -6.274628102e-05f, -5.785038816e-05f, -5.298004738e-05f,
+  -4.813612502e-05f, -4.331947456e-05f, -3.853093650e-05f, -3.377133829e-05f,
+  -2.904149428e-05f, -2.434220567e-05f, -1.967426042e-05f, -1.503843323e-05f,
+  -1.043548544e-05f, -5.866165028e-06f, -1.331206547e-06f, 3.168668927e-06f,
+  7.632753828e-06f, 1.206035413e-05f, 1.645078941e-05f, 2.080339282e-05f,
+  2.511751118e-05f, 2.939250496e-05f, 3.362774831e-05f, 3.782262912e-05f,
+  4.197654895e-05f, 4.608892311e-05f, 5.015918068e-05f, 5.418676445e-05f,
+  5.817113098e-05f, 6.211175058e-05f, 6.600810733e-05f, 6.985969903e-05f,
+  7.366603724e-05f, 7.742664724e-05f, 8.114106804e-05f, 8.480885234e-05f,
+  8.842956654e-05f, 9.200279069e-05f, 9.552811847e-05f, 9.900515721e-05f,
+  1.024335278e-04f, 1.058128646e-04f, 1.091428158e-04f, 1.124230426e-04f,
+  1.156532200e-04f, 1.188330363e-04f, 1.219621932e-04f, 1.250404056e-04f,
+  1.280674017e-04f, 1.310429231e-04f, 1.339667243e-04f, 1.368385730e-04f,
+  1.396582501e-04f, 1.424255492e-04f, 1.451402770e-04f, 1.478022531e-04f,
+  1.504113099e-04f, 1.529672922e-04f, 1.554700580e-04f, 1.579194775e-04f,
+  1.603154334e-04f, 1.626578211e-04f, 1.649465481e-04f, 1.671815343e-04f,
+  1.693627117e-04f, 1.714900245e-04f, 1.735634288e-04f, 1.755828928e-04f,
+  1.775483965e-04f, 1.794599314e-04f, 1.813175010e-04f, 1.831211202e-04f,
+  1.848708153e-04f, 1.865666242e-04f, 1.882085957e-04f, 1.897967902e-04f,
+  1.913312787e-04f, 1.928121437e-04f, 1.942394780e-04f, 1.956133854e-04f,
+  1.969339805e-04f, 1.982013882e-04f, 1.994157439e-04f, 2.005771932e-04f,
+  2.016858921e-04f, 2.027420064e-04f, 2.037457122e-04f, 2.046971951e-04f,
+  2.055966506e-04f, 2.064442839e-04f, 2.072403095e-04f, 2.079849513e-04f,
+  2.086784425e-04f, 2.093210255e-04f, 2.099129514e-04f, 2.104544805e-04f,
+  2.109458817e-04f, 2.113874324e-04f, 2.117794187e-04f, 2.121221350e-04f,
+  2.124158838e-04f, 2.126609758e-04f, 2.128577298e-04f, 2.130064722e-04f,
+  2.131075373e-04f, 2.131612668e-04f, 2.131680100e-04f, 2.131281235e-04f,
+  2.130419710e-04f, 2.129099232e-04f, 2.127323579e-04f, 2.125096594e-04f,
+  2.122422190e-04f, 2.119304341e-04f, 2.115747089e-04f, 2.111754534e-04f,
+  2.107330840e-04f, 2.102480230e-04f, 2.097206983e-04f, 2.091515439e-04f,
+  2.085409990e-04f, 2.078895083e-04f, 2.071975219e-04f, 2.064654949e-04f,
+  2.056938874e-04f, 2.048831646e-04f, 2.040337960e-04f, 2.031462561e-04f,
+  2.022210237e-04f, 2.012585819e-04f, 2.002594179e-04f, 1.992240232e-04f,
+  1.981528929e-04f, 1.970465261e-04f, 1.959054256e-04f, 1.947300974e-04f,
+  1.935210512e-04f, 1.922787996e-04f, 1.910038587e-04f, 1.896967473e-04f,
+  1.883579870e-04f, 1.869881023e-04f, 1.855876202e-04f, 1.841570701e-04f,
+  1.826969838e-04f, 1.812078950e-04f, 1.796903399e-04f, 1.781448563e-04f,
+  1.765719838e-04f, 1.749722638e-04f, 1.733462392e-04f, 1.716944543e-04f,
+  1.700174547e-04f, 1.683157870e-04f, 1.665899991e-04f, 1.648406395e-04f,
+  1.630682579e-04f, 1.612734043e-04f, 1.594566294e-04f, 1.576184843e-04f,
+  1.557595204e-04f, 1.538802893e-04f, 1.519813427e-04f, 1.500632322e-04f,
+  1.481265092e-04f, 1.461717249e-04f, 1.441994300e-04f, 1.422101749e-04f,
+  1.402045092e-04f, 1.381829818e-04f, 1.361461408e-04f, 1.340945333e-04f,
+  1.320287055e-04f, 1.299492021e-04f, 1.278565669e-04f, 1.257513421e-04f,
+  1.236340685e-04f, 1.215052854e-04f, 1.193655302e-04f, 1.172153388e-04f,
+  1.150552448e-04f, 1.128857804e-04f, 1.107074752e-04f, 1.085208570e-04f,
+  1.063264511e-04f, 1.041247804e-04f, 1.019163657e-04f, 9.970172488e-05f,
+  9.748137339e-05f, 9.525582391e-05f, 9.302558631e-05f, 9.079116759e-05f,
+  8.855307175e-05f, 8.631179976e-05f, 8.406784943e-05f, 8.182171536e-05f,
+  7.957388885e-05f, 7.732485782e-05f, 7.507510673e-05f, 7.282511653e-05f,
+  7.057536456e-05f, 6.832632448e-05f, 6.607846620e-05f, 6.383225582e-05f,
+  6.158815557e-05f, 5.934662370e-05f, 5.710811447e-05f, 5.487307803e-05f,
+  5.264196041e-05f, 5.041520342e-05f, 4.819324461e-05f, 4.597651720e-05f,
+  4.375885935e-05f, 4.153543676e-05f, 3.930866292e-05f, 3.708093838e-05f,
+  3.485464748e-05f, 3.263215515e-05f, 3.041580375e-05f, 2.820790995e-05f,
+  2.601076173e-05f, 2.382661535e-05f, 2.165769244e-05f, 1.950617720e-05f,
+  1.737421356e-05f, 1.526390254e-05f, 1.317729963e-05f, 1.111641223e-05f,
+  9.083197240e-06f, 7.079558706e-06f, 5.107345555e-06f, 3.168349443e-06f,
+  1.264302689e-06f, -6.031236873e-07f, -2.432321816e-06f, -4.221748738e-06f,
+  -5.969928044e-06f, -7.675451416e-06f, -9.336980053e-06f, -1.095324599e-05f,
+  -1.252305329e-05f, -1.404527915e-05f, -1.551887486e-05f, -1.694286670e-05f,
+  -1.831635663e-05f, -1.963852295e-05f, -2.090862084e-05f, -2.212598272e-05f,
+  -2.329001854e-05f, -2.440021597e-05f, -2.545614045e-05f, -2.645743510e-05f,
+  -2.740382060e-05f, -2.829509487e-05f, -2.913113270e-05f, -2.991188524e-05f,
+  -3.063737938e-05f, -3.130771706e-05f, -3.192307444e-05f, -3.248370098e-05f,
+  -3.298991844e-05f, -3.344211972e-05f, -3.384076770e-05f, -3.418639392e-05f,
+  -3.447959716e-05f, -3.472104200e-05f, -3.491145723e-05f, -3.505163423e-05f,
+  -3.514242521e-05f, -3.518474144e-05f, -3.517955136e-05f, -3.512787866e-05f,
+  -3.503080026e-05f, -3.488944426e-05f, -3.470498779e-05f, -3.447865486e-05f,
+  -3.421171409e-05f, -3.390547649e-05f, -3.356129309e-05f, -3.318055260e-05f,
+  -3.276467900e-05f, -3.231512912e-05f, -3.183339020e-05f, -3.132097737e-05f,
+  -3.077943117e-05f, -3.021031503e-05f, -2.961521273e-05f, -2.899572587e-05f,
+  -2.835347131e-05f, -2.769007863e-05f, -2.700718756e-05f, -2.630644550e-05f,
+  -2.558950491e-05f, -2.485802085e-05f, -2.411364847e-05f, -2.335804050e-05f,
+  -2.259284485e-05f, -2.181970212e-05f, -2.104024326e-05f, -2.025608716e-05f,
+  -1.946883836e-05f, -1.868008475e-05f, -1.789139533e-05f, -1.710431803e-05f,
+  -1.632037755e-05f, -1.554107326e-05f, -1.476787720e-05f, -1.400223206e-05f,
+  -1.324554932e-05f, -1.249920730e-05f, -1.176454946e-05f, -1.104288264e-05f,
+  -1.033547540e-05f, -9.643556442e-06f, -8.968313103e-06f, -8.310889916e-06f,
+  -7.672387247e-06f, -7.053860018e-06f, -6.456316498e-06f, -5.880717180e-06f,
+  -5.327973740e-06f, -4.798948074e-06f, -4.294451420e-06f, -3.815243562e-06f,
+  -3.362032124e-06f, -2.935471935e-06f, -2.536164494e-06f, -2.164657510e-06f,
+  -1.821444530e-06f, -1.506964650e-06f, -1.221602316e-06f, -9.656871982e-07f,
+  -7.394941618e-07f, -5.432433113e-07f, -3.771001214e-07f, -2.411756488e-07f,
+  -1.355268238e-07f, -6.015682258e-08f, -1.501551656e-08f, -0.000000000e+00f,
+};
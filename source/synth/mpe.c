@@ -0,0 +1,213 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include "mpe.h"
+
+/* Private functions */
+static void map_zones(mpe_t *mpe, mpe_zone_t configured);
+static void set_bend_range(mpe_t *mpe, uint8_t channel, float range);
+
+/**
+ * mpe_init
+ * \brief initialises with no zones, all channels behave as ordinary MIDI channels.
+ * \param mpe the MPE state
+ */
+void mpe_init(mpe_t *mpe)
+{
+  mpe->members[MPE_ZONE_NONE] = 0;
+  mpe->members[MPE_ZONE_LOWER] = 0;
+  mpe->members[MPE_ZONE_UPPER] = 0;
+
+  for (uint8_t channel = 0; channel < MPE_CHANNELS; channel++)
+  {
+    mpe->zone[channel] = MPE_ZONE_NONE;
+    mpe->bend_range[channel] = MPE_MASTER_BEND_RANGE;
+    mpe_reset_channel(mpe, channel);
+  }
+}
+
+/**
+ * mpe_configure
+ * \brief sets up a zone, as the MPE Configuration Message does.
+ * \param mpe the MPE state
+ * \param zone MPE_ZONE_LOWER or MPE_ZONE_UPPER
+ * \param members the number of member channels, 0 disables the zone
+ * \note if the zones would overlap the other zone is shrunk, bend ranges in the
+ *       zone return to their defaults.
+ */
+void mpe_configure(mpe_t *mpe, mpe_zone_t zone, uint8_t members)
+{
+  if (zone == MPE_ZONE_NONE)
+  {
+    return;
+  }
+
+  mpe_zone_t other = zone == MPE_ZONE_LOWER ? MPE_ZONE_UPPER : MPE_ZONE_LOWER;
+
+  members = members > 15 ? 15 : members;
+  mpe->members[zone] = members;
+
+  /* Both masters and all the members must fit in 16 channels */
+  if (members > 0 && mpe->members[other] > 0)
+  {
+    mpe->members[other] = members >= 14 ? 0 : (mpe->members[other] > 14 - members ? 14 - members : mpe->members[other]);
+  }
+
+  map_zones(mpe, zone);
+}
+
+/**
+ * mpe_reset_channel
+ * \brief returns the channel expression to rest (no bend or pressure, centre timbre).
+ * \param mpe the MPE state
+ * \param channel the channel
+ */
+void mpe_reset_channel(mpe_t *mpe, uint8_t channel)
+{
+  mpe->bend[channel] = 0.0f;
+  mpe->pressure[channel] = 0.0f;
+  mpe->timbre[channel] = 0.5f;
+}
+
+/**
+ * mpe_set_bend
+ * \brief records a pitch bend message.
+ * \param mpe the MPE state
+ * \param channel the channel
+ * \param value the full 14 bit bend value, 8192 is centre
+ * \return the channel bend in semitones
+ */
+float mpe_set_bend(mpe_t *mpe, uint8_t channel, uint16_t value)
+{
+  float bend = (float)((int32_t)value - 8192) * (1.0f / 8192.0f) * mpe->bend_range[channel];
+
+  mpe->bend[channel] = bend;
+
+  return bend;
+}
+
+/**
+ * mpe_note_bend
+ * \brief the total bend for notes on a channel, member bend plus the zone master bend.
+ * \param mpe the MPE state
+ * \param channel the channel
+ * \return the bend in semitones
+ */
+float mpe_note_bend(const mpe_t *mpe, uint8_t channel)
+{
+  mpe_zone_t zone = mpe->zone[channel];
+
+  if (zone == MPE_ZONE_NONE || channel == mpe_master(zone))
+  {
+    return mpe->bend[channel];
+  }
+
+  return mpe->bend[channel] + mpe->bend[mpe_master(zone)];
+}
+
+/**
+ * mpe_rpn
+ * \brief handles the registered parameters MPE uses.
+ * \param mpe the MPE state
+ * \param channel the channel
+ * \param rpn the registered parameter number
+ * \param value the 14 bit data entry value
+ * \return true if the zone layout or bend ranges changed, voices should re-read their bend
+ */
+bool mpe_rpn(mpe_t *mpe, uint8_t channel, uint16_t rpn, uint16_t value)
+{
+  uint8_t msb = (uint8_t)(value >> 7);
+  uint8_t lsb = (uint8_t)(value & 0x7F);
+
+  switch (rpn)
+  {
+  case MPE_RPN_MCM:
+    /* Only meaningful on the master channel of a zone */
+    if (channel == mpe_master(MPE_ZONE_LOWER))
+    {
+      mpe_configure(mpe, MPE_ZONE_LOWER, msb);
+      return true;
+    }
+
+    if (channel == mpe_master(MPE_ZONE_UPPER))
+    {
+      mpe_configure(mpe, MPE_ZONE_UPPER, msb);
+      return true;
+    }
+
+    return false;
+
+  case MPE_RPN_BEND_RANGE:
+    /* Semitones and cents */
+    set_bend_range(mpe, channel, (float)msb + (float)lsb * 0.01f);
+    return true;
+
+  default:
+    return false;
+  }
+}
+
+/**
+ * map_zones
+ * \brief rebuilds the channel to zone map.
+ * \param mpe the MPE state
+ * \param configured the zone being configured, its channels and any that changed
+ *        zone are reset to the default bend range and rest expression
+ */
+static void map_zones(mpe_t *mpe, mpe_zone_t configured)
+{
+  uint8_t lower = mpe->members[MPE_ZONE_LOWER];
+  uint8_t upper = mpe->members[MPE_ZONE_UPPER];
+
+  for (uint8_t channel = 0; channel < MPE_CHANNELS; channel++)
+  {
+    mpe_zone_t zone = MPE_ZONE_NONE;
+
+    if (lower > 0 && channel <= lower)
+    {
+      zone = MPE_ZONE_LOWER;
+    }
+    else if (upper > 0 && channel >= 15 - upper)
+    {
+      zone = MPE_ZONE_UPPER;
+    }
+
+    if (zone == configured || zone != mpe->zone[channel])
+    {
+      mpe->zone[channel] = zone;
+      mpe->bend_range[channel] = (zone == MPE_ZONE_NONE || channel == mpe_master(zone)) ? MPE_MASTER_BEND_RANGE : MPE_MEMBER_BEND_RANGE;
+      mpe_reset_channel(mpe, channel);
+    }
+  }
+}
+
+/**
+ * set_bend_range
+ * \brief sets the bend range, on a member channel it applies to every member of the zone.
+ * \param mpe the MPE state
+ * \param channel the channel that received the RPN
+ * \param range the range in semitones
+ */
+static void set_bend_range(mpe_t *mpe, uint8_t channel, float range)
+{
+  mpe_zone_t zone = mpe->zone[channel];
+
+  if (zone == MPE_ZONE_NONE || channel == mpe_master(zone))
+  {
+    mpe->bend_range[channel] = range;
+    return;
+  }
+
+  for (uint8_t member = 0; member < MPE_CHANNELS; member++)
+  {
+    if (mpe->zone[member] == zone && member != mpe_master(zone))
+    {
+      mpe->bend_range[member] = range;
+    }
+  }
+}
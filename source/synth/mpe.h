@@ -0,0 +1,97 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef MPE_H
+#define MPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+  MIDI Polyphonic Expression (MPE) zones and channel expression state.
+
+  A zone is a master channel plus a run of member channels, the lower zone
+  has its master on channel 1 with members counting up from channel 2, the
+  upper zone has its master on channel 16 with members counting down. A
+  controller gives each sounding note its own member channel so pitch bend,
+  channel pressure and CC74 (timbre) on that channel belong to that note.
+  Pitch bend on the master channel applies to the whole zone and is added
+  to the member bend.
+
+  Zones are set with mpe_configure() or by the MPE Configuration Message
+  (RPN 6 on a master channel, passed in decoded by mpe_rpn()). Channels
+  outside a zone behave as ordinary MIDI channels, their bend and pressure
+  apply to all their notes.
+
+  Channels are numbered 0-15 here as in the MIDI status byte.
+*/
+
+#define MPE_CHANNELS (16)
+
+/* Default pitch bend ranges in semitones, from the MPE specification */
+#define MPE_MEMBER_BEND_RANGE (48.0f)
+#define MPE_MASTER_BEND_RANGE (2.0f)
+
+/* Registered parameter numbers handled */
+#define MPE_RPN_BEND_RANGE (0x0000)
+#define MPE_RPN_MCM (0x0006)
+
+/* Zones */
+typedef enum
+{
+  MPE_ZONE_NONE,
+  MPE_ZONE_LOWER,
+  MPE_ZONE_UPPER,
+} mpe_zone_t;
+
+/* MPE state */
+typedef struct
+{
+  uint8_t members[3];              /* Member channel count per zone, indexed by mpe_zone_t */
+  mpe_zone_t zone[MPE_CHANNELS];   /* Zone each channel belongs to */
+
+  /* Per channel expression, new notes start from these values */
+  float bend_range[MPE_CHANNELS];  /* Semitones for full scale bend */
+  float bend[MPE_CHANNELS];        /* Channel bend in semitones */
+  float pressure[MPE_CHANNELS];    /* Channel pressure 0-1 */
+  float timbre[MPE_CHANNELS];      /* CC74 0-1 */
+} mpe_t;
+
+/* API */
+void mpe_init(mpe_t *mpe);
+void mpe_configure(mpe_t *mpe, mpe_zone_t zone, uint8_t members);
+void mpe_reset_channel(mpe_t *mpe, uint8_t channel);
+
+float mpe_set_bend(mpe_t *mpe, uint8_t channel, uint16_t value);
+float mpe_note_bend(const mpe_t *mpe, uint8_t channel);
+bool mpe_rpn(mpe_t *mpe, uint8_t channel, uint16_t rpn, uint16_t value);
+
+/**
+ * mpe_master
+ * \brief the master channel of a zone.
+ * \param zone MPE_ZONE_LOWER or MPE_ZONE_UPPER
+ */
+static inline uint8_t mpe_master(mpe_zone_t zone)
+{
+  return zone == MPE_ZONE_UPPER ? 15 : 0;
+}
+
+/**
+ * mpe_is_master
+ * \brief true if the channel is the master channel of an active zone.
+ * \param mpe the MPE state
+ * \param channel the channel
+ */
+static inline bool mpe_is_master(const mpe_t *mpe, uint8_t channel)
+{
+  mpe_zone_t zone = mpe->zone[channel];
+
+  return zone != MPE_ZONE_NONE && channel == mpe_master(zone);
+}
+
+#endif /* MPE_H */
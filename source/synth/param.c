@@ -0,0 +1,199 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <assert.h>
+#include <math.h>
+
+#include "param.h"
+#include "trace.h"
+
+static_assert(PARAM_COUNT <= 32, "one dirty bit per parameter");
+
+/* Parameter descriptors, indexed by param_id_t */
+static const param_info_t info[PARAM_COUNT] = {
+    [PARAM_VOLUME] = {0.0f, 1.0f, 0.8f, PARAM_LINEAR},
+    [PARAM_CUTOFF] = {0.0f, 1.0f, 1.0f, PARAM_LINEAR},
+    [PARAM_ATTACK] = {0.001f, 10.0f, 0.005f, PARAM_EXPONENTIAL},
+    [PARAM_DECAY] = {0.001f, 10.0f, 0.3f, PARAM_EXPONENTIAL},
+    [PARAM_SUSTAIN] = {0.0f, 1.0f, 0.7f, PARAM_LINEAR},
+    [PARAM_RELEASE] = {0.001f, 10.0f, 0.4f, PARAM_EXPONENTIAL},
+    [PARAM_TEMPO] = {20.0f, 300.0f, 120.0f, PARAM_EXPONENTIAL},
+    [PARAM_ARP_MODE] = {0.0f, 3.0f, 0.0f, PARAM_LINEAR},   /* arp_mode_t, rounded */
+    [PARAM_ARP_OCTAVES] = {1.0f, 4.0f, 1.0f, PARAM_LINEAR},
+    [PARAM_ARP_RATE] = {1.0f, 24.0f, 6.0f, PARAM_LINEAR},  /* Clock ticks per step, rounded */
+    [PARAM_ARP_GATE] = {0.05f, 1.0f, 0.5f, PARAM_LINEAR},  /* Fraction of a step */
+    [PARAM_ARP_SWING] = {0.0f, 0.5f, 0.0f, PARAM_LINEAR},  /* Delay of odd steps, fraction of a step */
+    [PARAM_REVERB_SEND] = {0.0f, 1.0f, 0.3f, PARAM_LINEAR},
+    [PARAM_DELAY_SEND] = {0.0f, 1.0f, 0.0f, PARAM_LINEAR},
+    [PARAM_BODY] = {0.0f, 1.0f, 0.0f, PARAM_LINEAR},       /* Fraction of the part through the cabinet IR */
+};
+
+/* Controller assignments, 14 bit pairs are listed by their MSB */
+typedef struct
+{
+  midi_control_type_t type;
+  uint16_t number;
+  param_id_t id;
+} param_map_t;
+
+static const param_map_t map[] = {
+    {MIDI_CONTROL_CC, 7, PARAM_VOLUME},   /* Channel volume, 14 bit with CC 39 */
+    {MIDI_CONTROL_CC, 16, PARAM_CUTOFF},  /* General purpose 1, 14 bit with CC 48 */
+    {MIDI_CONTROL_CC, 73, PARAM_ATTACK},  /* Sound controller 4 */
+    {MIDI_CONTROL_CC, 75, PARAM_DECAY},   /* Sound controller 6 */
+    {MIDI_CONTROL_CC, 79, PARAM_SUSTAIN}, /* Sound controller 10 */
+    {MIDI_CONTROL_CC, 72, PARAM_RELEASE}, /* Sound controller 3 */
+    {MIDI_CONTROL_CC, 102, PARAM_TEMPO},  /* Undefined 102-107 */
+    {MIDI_CONTROL_CC, 103, PARAM_ARP_MODE},
+    {MIDI_CONTROL_CC, 104, PARAM_ARP_OCTAVES},
+    {MIDI_CONTROL_CC, 105, PARAM_ARP_RATE},
+    {MIDI_CONTROL_CC, 106, PARAM_ARP_GATE},
+    {MIDI_CONTROL_CC, 107, PARAM_ARP_SWING},
+    {MIDI_CONTROL_CC, 91, PARAM_REVERB_SEND}, /* Effects 1 depth, reverb send in GM */
+    {MIDI_CONTROL_CC, 94, PARAM_DELAY_SEND},  /* Effects 4 depth, delay send in GS */
+    {MIDI_CONTROL_CC, 92, PARAM_BODY},        /* Effects 2 depth */
+};
+
+/**
+ * param_init
+ * \brief sets every parameter to its initial value and marks them all dirty.
+ * \param store the parameter store
+ */
+void param_init(param_store_t *store)
+{
+  for (int id = 0; id < PARAM_COUNT; id++)
+  {
+    atomic_init(&store->value[id], info[id].initial);
+  }
+
+  atomic_init(&store->dirty, (uint32_t)((1ULL << PARAM_COUNT) - 1));
+}
+
+/**
+ * param_set
+ * \brief sets a parameter, safe from any task.
+ * \param store the parameter store
+ * \param id the parameter
+ * \param value the value in engineering units, clamped to the parameter range
+ */
+void param_set(param_store_t *store, param_id_t id, float value)
+{
+  RTT_ASSERT(id < PARAM_COUNT);
+
+  value = fminf(fmaxf(value, info[id].min), info[id].max);
+
+  atomic_store_explicit(&store->value[id], value, memory_order_relaxed);
+  atomic_fetch_or_explicit(&store->dirty, param_mask(id), memory_order_release);
+}
+
+/**
+ * param_set_unit
+ * \brief sets a parameter from a 0-1 control position, following the parameter curve.
+ * \param store the parameter store
+ * \param id the parameter
+ * \param unit the control position 0-1
+ */
+void param_set_unit(param_store_t *store, param_id_t id, float unit)
+{
+  RTT_ASSERT(id < PARAM_COUNT);
+
+  const param_info_t *p = &info[id];
+  float value;
+
+  if (p->curve == PARAM_EXPONENTIAL)
+  {
+    value = p->min * powf(p->max / p->min, unit);
+  }
+  else
+  {
+    value = p->min + (p->max - p->min) * unit;
+  }
+
+  param_set(store, id, value);
+}
+
+/**
+ * param_get
+ * \brief reads a parameter.
+ * \param store the parameter store
+ * \param id the parameter
+ * \return the value in engineering units
+ */
+float param_get(const param_store_t *store, param_id_t id)
+{
+  RTT_ASSERT(id < PARAM_COUNT);
+
+  return atomic_load_explicit(&store->value[id], memory_order_relaxed);
+}
+
+/**
+ * param_get_unit
+ * \brief reads a parameter as a 0-1 control position, the inverse of param_set_unit().
+ * \param store the parameter store
+ * \param id the parameter
+ * \return the control position 0-1
+ */
+float param_get_unit(const param_store_t *store, param_id_t id)
+{
+  const param_info_t *p = param_info(id);
+  float value = param_get(store, id);
+
+  if (p->curve == PARAM_EXPONENTIAL)
+  {
+    return logf(value / p->min) / logf(p->max / p->min);
+  }
+
+  return (value - p->min) / (p->max - p->min);
+}
+
+/**
+ * param_take_dirty
+ * \brief collects and clears the parameters changed since the last call.
+ * \param store the parameter store
+ * \return a mask of param_mask() bits, read the values with param_get()
+ */
+uint32_t param_take_dirty(param_store_t *store)
+{
+  return atomic_exchange_explicit(&store->dirty, 0, memory_order_acquire);
+}
+
+/**
+ * param_info
+ * \brief the descriptor of a parameter.
+ * \param id the parameter
+ */
+const param_info_t *param_info(param_id_t id)
+{
+  RTT_ASSERT(id < PARAM_COUNT);
+
+  return &info[id];
+}
+
+/**
+ * param_from_control
+ * \brief finds the parameter a MIDI control is assigned to.
+ * \param control the decoded control
+ * \return the parameter, PARAM_NONE if the control is not assigned
+ */
+param_id_t param_from_control(const midi_control_t *control)
+{
+  if (control->type == MIDI_CONTROL_NRPN)
+  {
+    return control->number < PARAM_COUNT ? (param_id_t)control->number : PARAM_NONE;
+  }
+
+  for (size_t i = 0; i < sizeof(map) / sizeof(map[0]); i++)
+  {
+    if (map[i].type == control->type && map[i].number == control->number)
+    {
+      return map[i].id;
+    }
+  }
+
+  return PARAM_NONE;
+}
@@ -0,0 +1,101 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef PARAM_H
+#define PARAM_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cc.h"
+
+/*
+  Engine parameter store.
+
+  Parameters are identified by param_id_t and held in engineering units
+  (seconds, 0-1 levels, 0-1 cutoff), each with a descriptor giving its
+  range and curve. Any task can write a parameter, the store is lock-free:
+  the value is an atomic float and a dirty bit is set with an atomic OR.
+
+  The engine collects the dirty bits once per block with param_take_dirty()
+  and applies only what changed, so a burst of edits to one parameter (for
+  example an editor sending bulk NRPN) costs one update per block however
+  many messages arrived.
+
+  param_from_control() maps decoded MIDI controls to parameters through a
+  fixed table, NRPN n on any channel addresses parameter n directly.
+*/
+
+/* Parameter IDs, at most 32 (one dirty bit each). Stored patches are indexed by ID, add new parameters at the end */
+typedef enum
+{
+  PARAM_VOLUME,
+  PARAM_CUTOFF,
+  PARAM_ATTACK,
+  PARAM_DECAY,
+  PARAM_SUSTAIN,
+  PARAM_RELEASE,
+  PARAM_TEMPO,
+  PARAM_ARP_MODE,
+  PARAM_ARP_OCTAVES,
+  PARAM_ARP_RATE,
+  PARAM_ARP_GATE,
+  PARAM_ARP_SWING,
+  PARAM_REVERB_SEND,
+  PARAM_DELAY_SEND,
+  PARAM_BODY,
+  PARAM_COUNT,
+  PARAM_NONE = PARAM_COUNT,
+} param_id_t;
+
+/* Mapping from 0-1 to the parameter range */
+typedef enum
+{
+  PARAM_LINEAR,
+  PARAM_EXPONENTIAL, /* Equal ratios per step, for times and frequencies */
+} param_curve_t;
+
+/* Parameter descriptor */
+typedef struct
+{
+  float min;
+  float max;
+  float initial;
+  param_curve_t curve;
+} param_info_t;
+
+/* Parameter store */
+typedef struct
+{
+  _Atomic float value[PARAM_COUNT];
+  atomic_uint_least32_t dirty;
+} param_store_t;
+
+/* API */
+void param_init(param_store_t *store);
+void param_set(param_store_t *store, param_id_t id, float value);
+void param_set_unit(param_store_t *store, param_id_t id, float unit);
+float param_get(const param_store_t *store, param_id_t id);
+float param_get_unit(const param_store_t *store, param_id_t id);
+uint32_t param_take_dirty(param_store_t *store);
+
+const param_info_t *param_info(param_id_t id);
+param_id_t param_from_control(const midi_control_t *control);
+
+/**
+ * param_mask
+ * \brief the dirty bit of a parameter.
+ * \param id the parameter
+ */
+static inline uint32_t param_mask(param_id_t id)
+{
+  return 1UL << id;
+}
+
+#endif /* PARAM_H */
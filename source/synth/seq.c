@@ -0,0 +1,152 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <assert.h>
+#include <string.h>
+
+#include "seq.h"
+#include "trace.h"
+
+static_assert(sizeof(seq_pattern_t) == 4 + 2 * SEQ_MAX_STEPS, "pattern is packed");
+
+/* Private functions */
+static void add_event(midi_event_t *event, uint32_t time, uint8_t status, uint8_t note, uint8_t velocity);
+
+/**
+ * seq_init
+ * \brief initialises the sequencer with an empty 16 step pattern of sixteenths.
+ * \param seq the sequencer
+ */
+void seq_init(seq_t *seq)
+{
+  RTT_ASSERT(seq != NULL);
+
+  memset(seq, 0, sizeof(seq_t));
+  seq->note = SEQ_NOTE_NONE;
+
+  seq_pattern_t pattern = {.length = 16, .rate = 6, .gate = 50, .swing = 0};
+  seq_set_pattern(seq, &pattern);
+}
+
+/**
+ * seq_set_pattern
+ * \brief replaces the pattern, it carries on from the current song position.
+ * \param seq the sequencer
+ * \param pattern the pattern
+ */
+void seq_set_pattern(seq_t *seq, const seq_pattern_t *pattern)
+{
+  RTT_ASSERT(pattern->length >= 1 && pattern->length <= SEQ_MAX_STEPS);
+  RTT_ASSERT(pattern->rate > 0);
+
+  seq->pattern = *pattern;
+  seq->record = 0;
+  tempo_steps_init(&seq->steps, pattern->rate, (float)pattern->swing * 0.01f);
+}
+
+/**
+ * seq_record
+ * \brief writes a note into the next step, wrapping at the pattern length.
+ * \param seq the sequencer
+ * \param channel the channel the pattern plays on
+ * \param note the note number
+ * \param velocity the velocity, 0 records a rest
+ */
+void seq_record(seq_t *seq, uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  seq->channel = channel;
+  seq->pattern.step[seq->record] = SEQ_STEP(note, velocity, false);
+  seq->record = (uint8_t)((seq->record + 1) % seq->pattern.length);
+}
+
+/**
+ * seq_process
+ * \brief generates the note events of one block.
+ * \details called every block, stopped or not, so the last note off is
+ *          sent. The cost is the number of steps in the block.
+ * \param seq the sequencer
+ * \param grid the block position, from tempo_block()
+ * \param events receives the events in time order, timestamped with their sample time
+ * \param max the space in events, at least SEQ_STEP_EVENTS
+ * \return the number of events
+ */
+size_t seq_process(seq_t *seq, const tempo_grid_t *grid, midi_event_t *events, size_t max)
+{
+  size_t count = 0;
+  uint32_t number;
+  size_t offset;
+
+  if (!grid->running)
+  {
+    /* Stopped, end the note now and start again on the grid when the transport runs */
+    if (seq->note != SEQ_NOTE_NONE && max > 0)
+    {
+      add_event(&events[count++], grid->time, MIDI_NOTE_OFF | seq->channel, seq->note, 0);
+      seq->note = SEQ_NOTE_NONE;
+    }
+
+    seq->steps.synced = false;
+    return count;
+  }
+
+  while (count + SEQ_STEP_EVENTS <= max && tempo_next_step(&seq->steps, grid, &number, &offset))
+  {
+    uint32_t time = grid->time + (uint32_t)offset;
+    seq_step_t step = seq->pattern.step[number % seq->pattern.length];
+    uint8_t velocity = SEQ_STEP_VELOCITY(step);
+    uint8_t note = SEQ_STEP_NOTE(step);
+
+    if (seq->note != SEQ_NOTE_NONE)
+    {
+      /* A tie into the same note carries on sounding */
+      if (seq->tied && velocity != 0 && note == seq->note)
+      {
+        seq->tied = SEQ_STEP_TIE(step);
+        seq->note_off = time + (uint32_t)((float)seq->pattern.gate * 0.01f * tempo_step_samples(&seq->steps, grid));
+        continue;
+      }
+
+      uint32_t off = (!seq->tied && (int32_t)(seq->note_off - time) < 0) ? seq->note_off : time;
+      add_event(&events[count++], off, MIDI_NOTE_OFF | seq->channel, seq->note, 0);
+      seq->note = SEQ_NOTE_NONE;
+    }
+
+    if (velocity == 0)
+    {
+      continue;
+    }
+
+    float length = (float)seq->pattern.gate * 0.01f * tempo_step_samples(&seq->steps, grid);
+
+    add_event(&events[count++], time, MIDI_NOTE_ON | seq->channel, note, velocity);
+    seq->note = note;
+    seq->tied = SEQ_STEP_TIE(step);
+    seq->note_off = time + (length >= 1.0f ? (uint32_t)length : 1);
+  }
+
+  /* A tied note is ended by the next step */
+  if (seq->note != SEQ_NOTE_NONE && !seq->tied && count < max && tempo_due(grid, seq->note_off, &offset))
+  {
+    add_event(&events[count++], grid->time + (uint32_t)offset, MIDI_NOTE_OFF | seq->channel, seq->note, 0);
+    seq->note = SEQ_NOTE_NONE;
+  }
+
+  return count;
+}
+
+/**
+ * add_event
+ * \brief fills in a note event.
+ */
+static void add_event(midi_event_t *event, uint32_t time, uint8_t status, uint8_t note, uint8_t velocity)
+{
+  event->timestamp = time;
+  event->status = status;
+  event->data[0] = note;
+  event->data[1] = velocity;
+}
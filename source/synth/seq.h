@@ -0,0 +1,80 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef SEQ_H
+#define SEQ_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "midi.h"
+#include "tempo.h"
+
+/*
+  Step sequencer, a pattern of up to 32 steps played on the tempo grid
+  while the transport runs.
+
+  Steps are numbered from the start of the song, step n of the song plays
+  step n modulo the length of the pattern, so the pattern stays in time
+  with the bar after a Continue or Song Position. Like the arpeggiator the
+  note events carry the sample time of their step.
+
+  A step is packed into 16 bits, a 32 step pattern with its settings is 68
+  bytes.
+
+  While the transport is stopped notes played in are recorded into the
+  pattern a step at a time.
+*/
+
+/* Steps in a pattern */
+#define SEQ_MAX_STEPS (32)
+
+/* Events seq_process() can produce for one step, the note off of the last step and the note on */
+#define SEQ_STEP_EVENTS (2)
+
+/* A step: note in bits 0-6, velocity in bits 7-13 (0 is a rest), tie to the next step in bit 14 */
+typedef uint16_t seq_step_t;
+
+#define SEQ_STEP(note, velocity, tie) ((seq_step_t)(((note) & 0x7F) | (((velocity) & 0x7F) << 7) | ((tie) ? 0x4000 : 0)))
+#define SEQ_STEP_NOTE(step) ((uint8_t)((step) & 0x7F))
+#define SEQ_STEP_VELOCITY(step) ((uint8_t)(((step) >> 7) & 0x7F))
+#define SEQ_STEP_TIE(step) (((step) & 0x4000) != 0)
+
+/* A pattern */
+typedef struct
+{
+  uint8_t length;               /* Steps, 1-32 */
+  uint8_t rate;                 /* Clock ticks per step, 6 for sixteenths */
+  uint8_t gate;                 /* Note length, percent of a step */
+  uint8_t swing;                /* Delay of every second step, percent of a step 0-50 */
+  seq_step_t step[SEQ_MAX_STEPS];
+} seq_pattern_t;
+
+/* Sequencer state */
+typedef struct
+{
+  seq_pattern_t pattern;
+  tempo_steps_t steps;
+  uint8_t channel;              /* Channel the notes play on */
+  uint8_t record;               /* Next step recorded into */
+
+  uint8_t note;                 /* Note sounding, SEQ_NOTE_NONE if none */
+  bool tied;                    /* Held into the next step */
+  uint32_t note_off;            /* Sample time its note off is due */
+} seq_t;
+
+#define SEQ_NOTE_NONE (0xFF)
+
+/* API */
+void seq_init(seq_t *seq);
+void seq_set_pattern(seq_t *seq, const seq_pattern_t *pattern);
+void seq_record(seq_t *seq, uint8_t channel, uint8_t note, uint8_t velocity);
+size_t seq_process(seq_t *seq, const tempo_grid_t *grid, midi_event_t *events, size_t max);
+
+#endif /* SEQ_H */
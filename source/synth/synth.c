@@ -0,0 +1,1031 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <assert.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "arena.h"
+#include "arp.h"
+#include "bank.h"
+#include "cc.h"
+#include "conv.h"
+#include "dae.h"
+#include "delay.h"
+#include "patch.h"
+#include "reverb.h"
+#include "sections.h"
+#include "seq.h"
+#include "synth.h"
+#include "tempo.h"
+#include "trace.h"
+
+/*
+  Synth engine, the audio generator plugged into the DAE.
+
+  It implements the DAE callbacks: MIDI events from dae_midi_event() are
+  routed through the MPE zone state to the voice pool, dae_process_block()
+  renders the pool. Everything here runs in the DAE task. MPE zones are
+  enabled by the controller with the MPE Configuration Message.
+
+  The engine is multi-timbral, each MIDI channel is a part with its own
+  patch and parameter store, an MPE zone is one part on its master channel.
+  The parts share one voice pool, its polyphony set by SYNTH_CYCLE_BUDGET.
+  Each block is rendered a part at a time into a part buffer, which is
+  mixed into the output and, through the part's send levels, into the
+  reverb and delay buses. The effects run once on their buses and are
+  added to the output, however many parts feed them.
+
+  The body stage is a cabinet or instrument body IR, run by the partitioned
+  convolver on a bus of its own. A part's body level is the fraction of it
+  that goes through the IR rather than straight to the output, so at 1 the
+  part is heard only through the cabinet. The IR is stored in flash and
+  truncated to SYNTH_BODY_CYCLES when the engine is prepared.
+
+  Audio input from the DAE is mixed in the same way as a part, dry into
+  the output and on the first part's sends into the effects, so the unit
+  doubles as an effects processor. Silent input costs only its check.
+
+  While nothing sounds, no voice or effect tail, no input and no arpeggiator
+  or sequencer note to come, a block is only that check. Parameter edits
+  wait for the next MIDI event or sounding block and the tempo grid is not
+  advanced, the note generators resync to it.
+
+  Controllers are decoded to 14 bit and those assigned to a parameter are
+  written to the channel's parameter store, the changes are applied
+  together at the start of the next block. SysEx is passed to the patch
+  bank transfer.
+
+  A program change is handed to the SYNTH task, which recalls the stored
+  patch into the part's parameter store and works out its voice settings
+  while the DAE carries on with the old patch. The first block after they
+  are ready crossfades the part from the old settings to the new, the DAE
+  never does the preparation itself.
+
+  The arpeggiator and step sequencer run on the tempo grid, following the
+  MIDI clock when one is locked. Their notes are timestamped with the
+  sample time of their step and the block is rendered in segments split at
+  those times, so they are sample accurate rather than quantised to the
+  block or the FreeRTOS tick. With the arpeggiator on, keys go to it rather
+  than the voices. With the sequencer on and the transport stopped, keys
+  are recorded into the pattern a step at a time. MIDI Start, Stop and
+  Continue run the transport, or CC_TRANSPORT when there is no MIDI clock.
+  The tempo and arpeggiator parameters are taken from the first part.
+*/
+
+/*
+  Cycles per block the engine may use. A patch change renders the changing
+  part twice for a block and the DAE, the MIDI interrupt and the other tasks
+  need their share, so it is well under half the block.
+*/
+#ifndef SYNTH_CYCLE_BUDGET
+#define SYNTH_CYCLE_BUDGET(sample_rate) (DAE_BLOCK_CYCLES(sample_rate) * 2 / 5)
+#endif
+
+/* Delay time in MIDI clock ticks, an eighth note */
+#define SYNTH_DELAY_TICKS (12)
+#define SYNTH_DELAY_FEEDBACK (0.35f)
+
+/* Reverb room size and damping */
+#define SYNTH_REVERB_SIZE (0.5f)
+#define SYNTH_REVERB_DAMPING (0.5f)
+
+/* Cycles per block of the body stage, the IR is truncated to fit */
+#ifndef SYNTH_BODY_CYCLES
+#define SYNTH_BODY_CYCLES (CONV_FIXED_CYCLES + CONV_MAX_PARTITIONS * CONV_PARTITION_CYCLES)
+#endif
+
+/* Controllers */
+#define CC_TIMBRE (74)
+#define CC_ARP (80)
+#define CC_SEQ (81)
+#define CC_TRANSPORT (82)
+#define CC_ALL_SOUND_OFF (120)
+#define CC_RESET_ALL (121)
+#define CC_ALL_NOTES_OFF (123)
+
+/* Engine state */
+static midi_cc_t cc;
+static mpe_t mpe;
+static param_store_t params[VOICE_PARTS];
+static float engine_rate;
+
+/* Part mixing */
+static float send_level[VOICE_PARTS][2]; /* Reverb and delay send of each part */
+static float body_level[VOICE_PARTS];    /* Fraction of each part through the body IR */
+static float part_buffer[DAE_AUDIO_BLOCK_SIZE];
+static float fade_buffer[DAE_AUDIO_BLOCK_SIZE];
+static float reverb_bus[DAE_AUDIO_BLOCK_SIZE];
+static float delay_bus[DAE_AUDIO_BLOCK_SIZE];
+static float body_bus[DAE_AUDIO_BLOCK_SIZE];
+
+/* Shared effects, large so they are allocated from the DAE arena */
+static reverb_t *reverb;
+static delay_t *delay;
+static conv_t *body;
+
+static_assert(sizeof(reverb_t) + sizeof(delay_t) + sizeof(conv_t) + 3 * ARENA_ALIGN <= DAE_ARENA_SIZE,
+              "the effects do not fit in DAE_ARENA_SIZE");
+
+/* Tempo synced note generators */
+static tempo_t tempo;
+static arp_t arp;
+static seq_t seq;
+static bool arp_enabled;
+static bool seq_enabled;
+static bool transport;
+
+/* True while blocks are skipped with nothing sounding, see is_silent() */
+static bool sleeping;
+
+/* Generated events per block, steps that do not fit move to the next block */
+#define GENERATED_EVENTS (8)
+
+/*
+  Two voice pools, voices points at the live one. A patch change copies the
+  live pool into the other, applies the prepared settings to the part in
+  the copy and crossfades the part from one to the other over a block.
+*/
+static voices_t pools[2];
+static voices_t *voices = &pools[0];
+
+/* Patch change preparation, see prepare_task() */
+typedef enum
+{
+  PREPARE_IDLE,
+  PREPARE_BUSY,  /* The prepare task is writing the parameters and settings */
+  PREPARE_READY, /* Settings ready, swapped in at the start of the next block */
+} prepare_state_t;
+
+static struct
+{
+  uint8_t part;
+  voice_settings_t settings;
+  float value[PARAM_COUNT]; /* The parameter values the settings were prepared from */
+} prepared;
+
+static atomic_int prepare_state;
+static TaskHandle_t prepare_task_handle;
+
+/* Notification bit the DAE sets once it has swapped in a prepared patch, the low bits are parts */
+#define PREPARE_SWAPPED (1UL << 31)
+static_assert(VOICE_PARTS < 31, "a notification bit per part and PREPARE_SWAPPED");
+
+#define SYNTH_STACK_SIZE (configMINIMAL_STACK_SIZE * 2)
+static StackType_t prepare_stack[SYNTH_STACK_SIZE];
+static StaticTask_t prepare_tcb;
+
+/* Latest program change of each part, the task notification bits say which are new */
+static uint8_t program[VOICE_PARTS];
+
+/* Private functions */
+static void prepare_task(void *pvParameters);
+static voices_t *switch_patch(void);
+static void crossfade(float *restrict in, const float *restrict out, size_t from, size_t to, size_t n);
+static bool render(voices_t *outgoing, float *out, size_t from, size_t to, size_t n);
+static void mix(uint8_t part, float *restrict out, size_t from, size_t to);
+static bool mix_input(const float *in_left, const float *in_right, float *restrict out, size_t block_size);
+static size_t generate(const tempo_grid_t *grid, midi_event_t *events);
+static void key_on(uint8_t channel, uint8_t note, uint8_t velocity);
+static void key_off(uint8_t channel, uint8_t note);
+static void note_on(uint8_t channel, uint8_t note, uint8_t velocity);
+static void control_change(uint8_t channel, uint8_t controller, uint8_t value);
+static uint8_t part_of(uint8_t channel);
+static void apply_expression(void);
+static void apply_params(uint8_t part, uint32_t dirty);
+static void apply_arp(void);
+static void set_transport(bool running);
+static void apply_edits(int state);
+static bool is_silent(const float *in_left, const float *in_right, size_t block_size);
+
+/**
+ * synth_start
+ * \brief starts the task that prepares patch changes.
+ * \param priority The FreeRTOS task priority, below the DAE.
+ */
+bool synth_start(UBaseType_t priority)
+{
+  prepare_task_handle = xTaskCreateStatic(prepare_task, "SYNTH", SYNTH_STACK_SIZE, NULL, priority, prepare_stack, &prepare_tcb);
+  if (prepare_task_handle == NULL)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * synth_params
+ * \brief the parameter store of a part, any task may write to it.
+ * \param part the part, 0-15
+ * \return the parameter store
+ */
+param_store_t *synth_params(uint8_t part)
+{
+  RTT_ASSERT(part < VOICE_PARTS);
+
+  return &params[part];
+}
+
+/**
+ * dae_prepare_for_play
+ * \brief initialises the engine for the DAE sample rate.
+ * \return false if the effects do not fit in the DAE arena or the block is too
+ *         long for the body stage
+ */
+bool dae_prepare_for_play(float sample_rate, size_t block_size)
+{
+  engine_rate = sample_rate;
+  atomic_store(&prepare_state, PREPARE_IDLE);
+  voices = &pools[0];
+
+  midi_cc_init(&cc);
+  mpe_init(&mpe);
+  voice_init(voices, sample_rate);
+  voice_set_limit(voices, voice_max_for_budget(SYNTH_CYCLE_BUDGET(sample_rate) - REVERB_CYCLES - DELAY_CYCLES - SYNTH_BODY_CYCLES));
+  reverb = dae_alloc(sizeof(reverb_t));
+  delay = dae_alloc(sizeof(delay_t));
+  body = dae_alloc(sizeof(conv_t));
+  if (reverb == NULL || delay == NULL || body == NULL || !conv_init(body, block_size))
+  {
+    return false;
+  }
+
+  reverb_init(reverb, SYNTH_REVERB_SIZE, SYNTH_REVERB_DAMPING);
+  delay_init(delay, 0.25f * sample_rate, SYNTH_DELAY_FEEDBACK);
+  conv_load(body, synth_body_ir, SYNTH_BODY_IR_LENGTH, SYNTH_BODY_CYCLES);
+  tempo_init(&tempo, sample_rate);
+  arp_init(&arp);
+  seq_init(&seq);
+  arp_enabled = false;
+  seq_enabled = false;
+  transport = false;
+
+  for (uint8_t part = 0; part < VOICE_PARTS; part++)
+  {
+    param_init(&params[part]);
+    apply_params(part, param_take_dirty(&params[part]));
+  }
+
+  return true;
+}
+
+/**
+ * dae_midi_event
+ * \brief routes a MIDI message to the voices.
+ */
+void dae_midi_event(const midi_event_t *event)
+{
+  uint8_t channel = midi_channel(event);
+
+  /* Edits made while asleep are in place before the event acts on them */
+  if (sleeping)
+  {
+    sleeping = false;
+    apply_edits(atomic_load_explicit(&prepare_state, memory_order_acquire));
+  }
+
+  switch (midi_type(event))
+  {
+  case MIDI_NOTE_ON:
+    key_on(channel, event->data[0], event->data[1]);
+    break;
+
+  case MIDI_NOTE_OFF:
+    key_off(channel, event->data[0]);
+    break;
+
+  case MIDI_POLY_PRESSURE:
+    voice_set_note_pressure(voices, channel, event->data[0], (float)event->data[1] * (1.0f / 127.0f));
+    break;
+
+  case MIDI_CHANNEL_PRESSURE:
+    mpe.pressure[channel] = (float)event->data[0] * (1.0f / 127.0f);
+    voice_set_pressure(voices, channel, mpe.pressure[channel]);
+    break;
+
+  case MIDI_PITCH_BEND:
+    mpe_set_bend(&mpe, channel, (uint16_t)(event->data[0] | (event->data[1] << 7)));
+
+    /* Master channel bend moves the whole zone */
+    if (mpe_is_master(&mpe, channel))
+    {
+      apply_expression();
+    }
+    else
+    {
+      voice_set_bend(voices, channel, mpe_note_bend(&mpe, channel));
+    }
+    break;
+
+  case MIDI_CONTROL_CHANGE:
+    control_change(channel, event->data[0], event->data[1]);
+    break;
+
+  case MIDI_PROGRAM_CHANGE:
+  {
+    /* The latest program of a part wins if changes arrive faster than they are prepared */
+    uint8_t part = part_of(channel);
+
+    program[part] = event->data[0];
+    xTaskNotify(prepare_task_handle, 1UL << part, eSetBits);
+    break;
+  }
+
+  case MIDI_START:
+    tempo_start(&tempo);
+    break;
+
+  case MIDI_CONTINUE:
+    tempo_set_running(&tempo, true);
+    break;
+
+  case MIDI_STOP:
+    tempo_set_running(&tempo, false);
+    break;
+
+  case MIDI_SYSEX:
+  case MIDI_SYSEX_END:
+    bank_sysex(event);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * dae_process_block
+ * \brief renders the parts, the input and effects, mono to both channels.
+ */
+bool dae_process_block(const float *in_left, const float *in_right, float *left, float *right, size_t block_size)
+{
+  voices_t *outgoing = NULL;
+  int state = atomic_load_explicit(&prepare_state, memory_order_acquire);
+
+  /* Nothing sounding and no note due, the edits, tempo and note generators wait for the next block that has one */
+  if (state == PREPARE_IDLE && is_silent(in_left, in_right, block_size))
+  {
+    sleeping = true;
+    return false;
+  }
+  sleeping = false;
+
+  if (state == PREPARE_READY)
+  {
+    outgoing = switch_patch();
+  }
+
+  apply_edits(state);
+
+  /* Place the block on the tempo grid and generate its notes */
+  midi_clock_state_t clock;
+  tempo_grid_t grid;
+  midi_event_t events[2 * GENERATED_EVENTS];
+
+  dae_clock_read(&clock);
+  tempo_block(&tempo, &clock, dae_block_time(), block_size, &grid);
+  transport = grid.running;
+
+  size_t count = generate(&grid, events);
+
+  memset(left, 0, block_size * sizeof(float));
+  memset(reverb_bus, 0, block_size * sizeof(float));
+  memset(delay_bus, 0, block_size * sizeof(float));
+  memset(body_bus, 0, block_size * sizeof(float));
+
+  /* Render up to each note, then play it */
+  bool active = false;
+  size_t from = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    size_t to = (size_t)(events[i].timestamp - grid.time);
+
+    active |= render(outgoing, left, from, to, block_size);
+    from = to;
+
+    if (midi_type(&events[i]) == MIDI_NOTE_ON)
+    {
+      note_on(midi_channel(&events[i]), events[i].data[0], events[i].data[1]);
+      active = true;
+    }
+    else
+    {
+      voice_note_off(voices, midi_channel(&events[i]), events[i].data[0]);
+    }
+  }
+
+  active |= render(outgoing, left, from, block_size, block_size);
+  active |= mix_input(in_left, in_right, left, block_size);
+
+  /* The effects run once on their buses, they skip the work once their tails have died away */
+  conv_process(body, body_bus, body_bus);
+  for (size_t i = 0; i < block_size; i++)
+  {
+    left[i] += body_bus[i];
+  }
+
+  delay_set_time(delay, (float)SYNTH_DELAY_TICKS * grid.samples_per_tick);
+  reverb_process(reverb, reverb_bus, left, block_size);
+  delay_process(delay, delay_bus, left, block_size);
+
+  if (!active && reverb_is_idle(reverb) && delay_is_idle(delay) && conv_is_idle(body))
+  {
+    return false;
+  }
+
+  memcpy(right, left, block_size * sizeof(float));
+
+  return true;
+}
+
+/**
+ * prepare_task
+ * \brief prepares patch changes away from the DAE.
+ * \details the DAE sets a part's bit in the task notification when it has a
+ *          new program. The patch is written to the part's parameter store
+ *          and the voice settings worked out from it, however long that
+ *          takes the DAE carries on with the old patch and swaps at the
+ *          first block after. Parts changed together are prepared in turn,
+ *          each waiting for the DAE's PREPARE_SWAPPED notification that the
+ *          one before is in.
+ * \param pvParameters - unused
+ */
+static void prepare_task(void *pvParameters)
+{
+  uint32_t parts = 0;
+  uint32_t events;
+
+  while (1)
+  {
+    if (parts == 0)
+    {
+      xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+      parts |= events & ~PREPARE_SWAPPED;
+    }
+
+    for (uint8_t part = 0; part < VOICE_PARTS; part++)
+    {
+      if ((parts & (1UL << part)) == 0)
+      {
+        continue;
+      }
+      parts &= ~(1UL << part);
+
+      const patch_t *patch = patch_find(program[part]);
+      if (patch == NULL)
+      {
+        continue;
+      }
+
+      /* The previous change has not been swapped in yet, it will be within a block. Changes that arrive meanwhile are kept */
+      while (atomic_load_explicit(&prepare_state, memory_order_acquire) == PREPARE_READY)
+      {
+        xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+        parts |= events & ~PREPARE_SWAPPED;
+      }
+
+      prepared.part = part;
+      atomic_store_explicit(&prepare_state, PREPARE_BUSY, memory_order_release);
+
+      patch_recall(patch, &params[part]);
+
+      for (int id = 0; id < PARAM_COUNT; id++)
+      {
+        prepared.value[id] = param_get(&params[part], (param_id_t)id);
+      }
+
+      voice_prepare(&prepared.settings, engine_rate, prepared.value[PARAM_VOLUME], prepared.value[PARAM_CUTOFF],
+                    prepared.value[PARAM_ATTACK], prepared.value[PARAM_DECAY],
+                    prepared.value[PARAM_SUSTAIN], prepared.value[PARAM_RELEASE]);
+
+      atomic_store_explicit(&prepare_state, PREPARE_READY, memory_order_release);
+    }
+  }
+}
+
+/**
+ * apply_edits
+ * \brief applies the parameter changes of every part since they were last applied,
+ *        however many edits there were.
+ * \param state the prepare state, a part being rewritten for a new patch is left until it is ready
+ */
+static void apply_edits(int state)
+{
+  for (uint8_t part = 0; part < VOICE_PARTS; part++)
+  {
+    if (state == PREPARE_BUSY && part == prepared.part)
+    {
+      continue;
+    }
+
+    uint32_t dirty = param_take_dirty(&params[part]);
+    if (dirty)
+    {
+      apply_params(part, dirty);
+    }
+  }
+}
+
+/**
+ * is_silent
+ * \brief true if a block would be silent and leave nothing behind, no voice or
+ *        effect tail sounding, no input and no generated note due.
+ * \details the tempo free runs or follows the clock, skipped blocks only move
+ *          the grid, which the note generators resync to when they wake.
+ */
+static bool is_silent(const float *in_left, const float *in_right, size_t block_size)
+{
+  midi_clock_state_t clock;
+
+  if (voice_active_parts(voices) != 0 || arp.count != 0 || arp.note != ARP_NOTE_NONE || seq.note != SEQ_NOTE_NONE)
+  {
+    return false;
+  }
+
+  dae_clock_read(&clock);
+  if (seq_enabled && (tempo.running || clock.running))
+  {
+    return false;
+  }
+
+  return reverb_is_idle(reverb) && delay_is_idle(delay) && conv_is_idle(body) &&
+         silence_detect(in_left, block_size) && silence_detect(in_right, block_size);
+}
+
+/**
+ * switch_patch
+ * \brief makes a copy of the live voices running the prepared patch the live voices.
+ * \details parameters edited since they were prepared are applied on top,
+ *          those unchanged are already in the prepared settings and skipped.
+ * \return the outgoing voices, the part's are faded out over this block
+ */
+static voices_t *switch_patch(void)
+{
+  voices_t *outgoing = voices;
+  uint8_t part = prepared.part;
+
+  voices = (outgoing == &pools[0]) ? &pools[1] : &pools[0];
+  *voices = *outgoing;
+  voice_apply(voices, part, &prepared.settings);
+
+  uint32_t dirty = param_take_dirty(&params[part]);
+
+  for (int id = 0; id < PARAM_COUNT; id++)
+  {
+    if (param_get(&params[part], (param_id_t)id) == prepared.value[id])
+    {
+      dirty &= ~param_mask((param_id_t)id);
+    }
+  }
+
+  /* Settings outside the voices (sends, tempo) are not prepared, apply them as edits */
+  dirty |= ~(param_mask(PARAM_VOLUME) | param_mask(PARAM_CUTOFF) | param_mask(PARAM_ATTACK) | param_mask(PARAM_DECAY) |
+             param_mask(PARAM_SUSTAIN) | param_mask(PARAM_RELEASE)) & (uint32_t)((1ULL << PARAM_COUNT) - 1);
+
+  if (dirty)
+  {
+    apply_params(part, dirty);
+  }
+
+  atomic_store_explicit(&prepare_state, PREPARE_IDLE, memory_order_release);
+  xTaskNotify(prepare_task_handle, PREPARE_SWAPPED, eSetBits);
+
+  return outgoing;
+}
+
+/**
+ * crossfade
+ * \brief fades a segment from out to in, linear across the block as both carry the same oscillators.
+ * \param in the incoming signal, replaced by the mix
+ * \param out the outgoing signal
+ * \param from the first sample of the segment
+ * \param to the sample after the segment
+ * \param n the number of samples in the block
+ */
+RAMFUNC static void crossfade(float *restrict in, const float *restrict out, size_t from, size_t to, size_t n)
+{
+  float step = 1.0f / (float)n;
+
+  for (size_t i = from; i < to; i++)
+  {
+    float mix = (float)(i + 1) * step;
+    in[i] = out[i] + (in[i] - out[i]) * mix;
+  }
+}
+
+/**
+ * render
+ * \brief renders a segment of the block a part at a time, mixing each into the buses.
+ * \param outgoing the voices before a patch change, its part is faded out, NULL if none
+ * \param out the output, accumulated into
+ * \param from the first sample of the segment
+ * \param to the sample after the segment
+ * \param n the number of samples in the block
+ * \return true if any voice is sounding
+ */
+static bool render(voices_t *outgoing, float *out, size_t from, size_t to, size_t n)
+{
+  if (to <= from)
+  {
+    return false;
+  }
+
+  uint32_t parts = voice_active_parts(voices);
+  uint32_t fading = 0;
+
+  if (outgoing != NULL)
+  {
+    fading = voice_active_parts(outgoing) & (1UL << prepared.part);
+    parts |= fading;
+  }
+
+  for (uint8_t part = 0; parts >> part; part++)
+  {
+    if ((parts & (1UL << part)) == 0)
+    {
+      continue;
+    }
+
+    memset(&part_buffer[from], 0, (to - from) * sizeof(float));
+    voice_render(voices, part, &part_buffer[from], to - from);
+
+    if (fading & (1UL << part))
+    {
+      /* The rest of the outgoing pool is the same as the live one, only the changing part is rendered twice */
+      memset(&fade_buffer[from], 0, (to - from) * sizeof(float));
+      voice_render(outgoing, part, &fade_buffer[from], to - from);
+      crossfade(part_buffer, fade_buffer, from, to, n);
+    }
+
+    mix(part, out, from, to);
+  }
+
+  return parts != 0;
+}
+
+/**
+ * mix
+ * \brief adds a part to the output and its sends to the effect buses.
+ * \param part the part, rendered into part_buffer
+ * \param out the output, accumulated into
+ * \param from the first sample of the segment
+ * \param to the sample after the segment
+ */
+RAMFUNC static void mix(uint8_t part, float *restrict out, size_t from, size_t to)
+{
+  float reverb_send = send_level[part][0];
+  float delay_send = send_level[part][1];
+  float body_send = body_level[part];
+  float dry = 1.0f - body_send;
+
+  for (size_t i = from; i < to; i++)
+  {
+    float x = part_buffer[i];
+
+    out[i] += x * dry;
+    body_bus[i] += x * body_send;
+    reverb_bus[i] += x * reverb_send;
+    delay_bus[i] += x * delay_send;
+  }
+}
+
+/**
+ * mix_input
+ * \brief adds the audio input, in mono, to the output and on the first part's sends to the effect buses
+ *        and the body stage.
+ * \param in_left the left input
+ * \param in_right the right input
+ * \param out the output, accumulated into
+ * \param block_size the number of samples
+ * \return false if the input is silent and was left out
+ */
+static bool mix_input(const float *in_left, const float *in_right, float *restrict out, size_t block_size)
+{
+  if (silence_detect(in_left, block_size) && silence_detect(in_right, block_size))
+  {
+    return false;
+  }
+
+  float reverb_send = send_level[0][0];
+  float delay_send = send_level[0][1];
+  float body_send = body_level[0];
+  float dry = 1.0f - body_send;
+
+  for (size_t i = 0; i < block_size; i++)
+  {
+    float x = (in_left[i] + in_right[i]) * 0.5f;
+
+    out[i] += x * dry;
+    body_bus[i] += x * body_send;
+    reverb_bus[i] += x * reverb_send;
+    delay_bus[i] += x * delay_send;
+  }
+
+  return true;
+}
+
+/**
+ * generate
+ * \brief collects the arpeggiator and sequencer notes of a block.
+ * \details both run every block, on or off, so their last note off is sent.
+ * \param grid the block position
+ * \param events receives the notes in time order, 2 * GENERATED_EVENTS at most
+ * \return the number of notes
+ */
+static size_t generate(const tempo_grid_t *grid, midi_event_t *events)
+{
+  midi_event_t arp_events[GENERATED_EVENTS];
+  midi_event_t seq_events[GENERATED_EVENTS];
+  size_t arp_count = arp_process(&arp, grid, arp_events, GENERATED_EVENTS);
+  tempo_grid_t seq_grid = *grid;
+
+  seq_grid.running = grid->running && seq_enabled;
+
+  size_t seq_count = seq_process(&seq, &seq_grid, seq_events, GENERATED_EVENTS);
+
+  /* Merge the two, each is already in time order */
+  size_t a = 0;
+  size_t s = 0;
+  size_t count = 0;
+
+  while (a < arp_count || s < seq_count)
+  {
+    if (s == seq_count || (a < arp_count && (int32_t)(arp_events[a].timestamp - seq_events[s].timestamp) <= 0))
+    {
+      events[count++] = arp_events[a++];
+    }
+    else
+    {
+      events[count++] = seq_events[s++];
+    }
+  }
+
+  return count;
+}
+
+/**
+ * key_on
+ * \brief a key played, to the arpeggiator, the sequencer or the voices.
+ * \param channel the MIDI channel
+ * \param note the note number
+ * \param velocity the velocity, 0 is a note off
+ */
+static void key_on(uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  if (arp_enabled)
+  {
+    arp_note_on(&arp, channel, note, velocity);
+    return;
+  }
+
+  if (seq_enabled && !transport && velocity != 0)
+  {
+    seq_record(&seq, channel, note, velocity);
+  }
+
+  note_on(channel, note, velocity);
+}
+
+/**
+ * key_off
+ * \brief a key released.
+ * \param channel the MIDI channel
+ * \param note the note number
+ */
+static void key_off(uint8_t channel, uint8_t note)
+{
+  if (arp_enabled)
+  {
+    arp_note_off(&arp, note);
+    return;
+  }
+
+  voice_note_off(voices, channel, note);
+}
+
+/**
+ * note_on
+ * \brief starts a note, it picks up the channel's current expression.
+ * \param channel the MIDI channel
+ * \param note the note number
+ * \param velocity the velocity, 0 is a note off
+ */
+static void note_on(uint8_t channel, uint8_t note, uint8_t velocity)
+{
+  if (velocity == 0)
+  {
+    voice_note_off(voices, channel, note);
+    return;
+  }
+
+  /* MPE controllers send the member channel expression before the note on */
+  voice_note_on(voices, part_of(channel), channel, note, (float)velocity * (1.0f / 127.0f),
+                mpe_note_bend(&mpe, channel), mpe.pressure[channel], mpe.timbre[channel]);
+}
+
+/**
+ * control_change
+ * \brief handles channel mode messages, MPE controllers and parameter assignments.
+ * \param channel the MIDI channel
+ * \param controller the controller number
+ * \param value the controller value
+ */
+static void control_change(uint8_t channel, uint8_t controller, uint8_t value)
+{
+  switch (controller)
+  {
+  case CC_ALL_SOUND_OFF:
+    voice_all_off(voices, channel, true);
+    return;
+
+  case CC_ALL_NOTES_OFF:
+    voice_all_off(voices, channel, false);
+    return;
+
+  case CC_ARP:
+    if ((value >= 64) != arp_enabled)
+    {
+      /* Keys held across the switch would never be released, release them now */
+      arp_clear(&arp);
+      voice_all_off(voices, channel, false);
+      arp_enabled = value >= 64;
+    }
+    return;
+
+  case CC_SEQ:
+    seq_enabled = value >= 64;
+    return;
+
+  case CC_TRANSPORT:
+    set_transport(value >= 64);
+    return;
+
+  case CC_RESET_ALL:
+    mpe_reset_channel(&mpe, channel);
+    apply_expression();
+    return;
+
+  default:
+    break;
+  }
+
+  midi_control_t control;
+  if (!midi_cc_decode(&cc, channel, controller, value, &control))
+  {
+    return;
+  }
+
+  if (control.type == MIDI_CONTROL_RPN)
+  {
+    if (mpe_rpn(&mpe, channel, control.number, control.value))
+    {
+      apply_expression();
+    }
+    return;
+  }
+
+  if (control.type == MIDI_CONTROL_CC && control.number == CC_TIMBRE)
+  {
+    mpe.timbre[channel] = midi_control_unit(&control);
+    voice_set_timbre(voices, channel, mpe.timbre[channel]);
+    return;
+  }
+
+  param_id_t id = param_from_control(&control);
+  if (id != PARAM_NONE)
+  {
+    param_set_unit(&params[part_of(channel)], id, midi_control_unit(&control));
+  }
+}
+
+/**
+ * part_of
+ * \brief the part a channel plays, the channel itself or the master channel of its MPE zone.
+ * \param channel the MIDI channel
+ */
+static uint8_t part_of(uint8_t channel)
+{
+  mpe_zone_t zone = mpe.zone[channel];
+
+  return zone == MPE_ZONE_NONE ? channel : mpe_master(zone);
+}
+
+/**
+ * apply_expression
+ * \brief re-applies every channel's expression to its voices, after a zone or range change.
+ */
+static void apply_expression(void)
+{
+  for (uint8_t channel = 0; channel < MPE_CHANNELS; channel++)
+  {
+    voice_set_bend(voices, channel, mpe_note_bend(&mpe, channel));
+    voice_set_pressure(voices, channel, mpe.pressure[channel]);
+    voice_set_timbre(voices, channel, mpe.timbre[channel]);
+  }
+}
+
+/**
+ * apply_params
+ * \brief pushes changed parameters into a part.
+ * \param part the part
+ * \param dirty the changed parameters, from param_take_dirty()
+ */
+static void apply_params(uint8_t part, uint32_t dirty)
+{
+  const param_store_t *store = &params[part];
+
+  if (dirty & param_mask(PARAM_VOLUME))
+  {
+    voice_set_volume(voices, part, param_get(store, PARAM_VOLUME));
+  }
+
+  if (dirty & param_mask(PARAM_CUTOFF))
+  {
+    voice_set_brightness(voices, part, param_get(store, PARAM_CUTOFF));
+  }
+
+  if (dirty & (param_mask(PARAM_ATTACK) | param_mask(PARAM_DECAY) | param_mask(PARAM_SUSTAIN) | param_mask(PARAM_RELEASE)))
+  {
+    voice_set_adsr(voices, part, param_get(store, PARAM_ATTACK), param_get(store, PARAM_DECAY),
+                   param_get(store, PARAM_SUSTAIN), param_get(store, PARAM_RELEASE));
+  }
+
+  if (dirty & param_mask(PARAM_REVERB_SEND))
+  {
+    send_level[part][0] = param_get(store, PARAM_REVERB_SEND);
+  }
+
+  if (dirty & param_mask(PARAM_DELAY_SEND))
+  {
+    send_level[part][1] = param_get(store, PARAM_DELAY_SEND);
+  }
+
+  if (dirty & param_mask(PARAM_BODY))
+  {
+    body_level[part] = param_get(store, PARAM_BODY);
+  }
+
+  /* The tempo and arpeggiator are shared, the first part sets them */
+  if (part != 0)
+  {
+    return;
+  }
+
+  if (dirty & param_mask(PARAM_TEMPO))
+  {
+    tempo_set_bpm(&tempo, param_get(store, PARAM_TEMPO));
+  }
+
+  if (dirty & (param_mask(PARAM_ARP_MODE) | param_mask(PARAM_ARP_OCTAVES) | param_mask(PARAM_ARP_RATE) |
+               param_mask(PARAM_ARP_GATE) | param_mask(PARAM_ARP_SWING)))
+  {
+    apply_arp();
+  }
+}
+
+/**
+ * apply_arp
+ * \brief pushes the arpeggiator parameters into the arpeggiator.
+ */
+static void apply_arp(void)
+{
+  const param_store_t *store = &params[0];
+
+  arp_set(&arp, (arp_mode_t)lroundf(param_get(store, PARAM_ARP_MODE)),
+          (uint8_t)lroundf(param_get(store, PARAM_ARP_OCTAVES)),
+          (uint8_t)lroundf(param_get(store, PARAM_ARP_RATE)),
+          param_get(store, PARAM_ARP_GATE), param_get(store, PARAM_ARP_SWING));
+}
+
+/**
+ * set_transport
+ * \brief runs or stops the internal transport, the MIDI clock's transport has priority while it is locked.
+ * \param running true to start from the top, false to stop
+ */
+static void set_transport(bool running)
+{
+  midi_clock_state_t clock;
+
+  dae_clock_read(&clock);
+  if (clock.period > 0.0f)
+  {
+    return;
+  }
+
+  if (running)
+  {
+    tempo_start(&tempo);
+  }
+  else
+  {
+    tempo_set_running(&tempo, false);
+  }
+}
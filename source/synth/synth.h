@@ -0,0 +1,28 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mpe.h"
+#include "param.h"
+#include "voice.h"
+
+/* Cabinet impulse response of the body stage, in flash, generated by tools/gen_body_ir.py */
+#define SYNTH_BODY_IR_LENGTH (1024)
+extern const float synth_body_ir[SYNTH_BODY_IR_LENGTH];
+
+/* API */
+bool synth_start(UBaseType_t priority);
+param_store_t *synth_params(uint8_t part);
+
+#endif /* SYNTH_H */
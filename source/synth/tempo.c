@@ -0,0 +1,184 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+
+#include "tempo.h"
+#include "trace.h"
+
+/* Tempo range for the internal clock */
+#define TEMPO_MIN_BPM (20.0f)
+#define TEMPO_MAX_BPM (300.0f)
+
+/**
+ * tempo_init
+ * \brief starts the grid at tick 0, stopped, at the default tempo.
+ * \param tempo the tempo
+ * \param sample_rate the sample rate
+ */
+void tempo_init(tempo_t *tempo, float sample_rate)
+{
+  RTT_ASSERT(tempo != NULL);
+
+  tempo->sample_rate = sample_rate;
+  tempo->bpm = TEMPO_DEFAULT_BPM;
+  tempo->running = false;
+  tempo->tick = 0;
+  tempo->frac = 0.0f;
+}
+
+/**
+ * tempo_set_bpm
+ * \brief sets the internal tempo, used while no MIDI clock is locked.
+ * \param tempo the tempo
+ * \param bpm beats per minute
+ */
+void tempo_set_bpm(tempo_t *tempo, float bpm)
+{
+  tempo->bpm = fminf(fmaxf(bpm, TEMPO_MIN_BPM), TEMPO_MAX_BPM);
+}
+
+/**
+ * tempo_start
+ * \brief rewinds the internal transport to tick 0 and runs it.
+ * \param tempo the tempo
+ */
+void tempo_start(tempo_t *tempo)
+{
+  tempo->tick = 0;
+  tempo->frac = 0.0f;
+  tempo->running = true;
+}
+
+/**
+ * tempo_set_running
+ * \brief stops the internal transport or continues from where it stopped.
+ * \param tempo the tempo
+ * \param running true to run
+ */
+void tempo_set_running(tempo_t *tempo, bool running)
+{
+  tempo->running = running;
+}
+
+/**
+ * tempo_block
+ * \brief places a block on the grid.
+ * \param tempo the tempo
+ * \param clock the MIDI clock state, from dae_clock_read()
+ * \param time the sample time of the block's first sample, from dae_block_time()
+ * \param length the samples in the block
+ * \param grid receives the block position
+ */
+void tempo_block(tempo_t *tempo, const midi_clock_state_t *clock, uint32_t time, size_t length, tempo_grid_t *grid)
+{
+  uint32_t tick = tempo->tick;
+  float frac = tempo->frac;
+  bool running = tempo->running;
+  float period;
+
+  if (clock->period > 0.0f && clock->running)
+  {
+    /* Extrapolate from the latest tick, the subtraction handles the sample clock wrapping */
+    float ticks = (float)(int32_t)(time - clock->time) / clock->period;
+    float whole = floorf(ticks);
+
+    tick = clock->tick + (uint32_t)(int32_t)whole;
+    frac = ticks - whole;
+    running = true;
+    period = clock->period;
+  }
+  else if (clock->period > 0.0f)
+  {
+    /* Clock locked but stopped, free run at its tempo */
+    period = clock->period;
+  }
+  else
+  {
+    period = tempo->sample_rate * 60.0f / (tempo->bpm * (float)MIDI_CLOCK_PPQN);
+  }
+
+  /* The clock filter moves the grid by a small fraction of a tick, anything more is a jump */
+  float drift = (float)(int32_t)(tick - tempo->tick) + frac - tempo->frac;
+
+  grid->time = time;
+  grid->tick = tick;
+  grid->frac = frac;
+  grid->samples_per_tick = period;
+  grid->length = length;
+  grid->running = running;
+  grid->jumped = fabsf(drift) > 1.0f;
+
+  /* Carry the position to the next block */
+  float end = frac + (float)length / period;
+  float whole = floorf(end);
+
+  tempo->tick = tick + (uint32_t)whole;
+  tempo->frac = end - whole;
+}
+
+/**
+ * tempo_steps_init
+ * \brief sets the step rate and swing, the steps start on the next grid step.
+ * \param steps the steps
+ * \param rate ticks per step, 6 for sixteenths, 3 for thirty-seconds
+ * \param swing delay of every second step as a fraction of a step, 0-0.5
+ */
+void tempo_steps_init(tempo_steps_t *steps, uint8_t rate, float swing)
+{
+  RTT_ASSERT(rate > 0);
+
+  steps->rate = rate;
+  steps->swing = fminf(fmaxf(swing, 0.0f), 0.5f);
+  steps->next = 0;
+  steps->synced = false;
+}
+
+/**
+ * tempo_next_step
+ * \brief the next step that starts in the block, call until it returns false.
+ * \param steps the steps
+ * \param grid the block position
+ * \param step receives the step number, steps count from tick 0 so patterns stay aligned to the bar
+ * \param offset receives the step's sample offset in the block
+ * \return true if a step starts in the block
+ */
+bool tempo_next_step(tempo_steps_t *steps, const tempo_grid_t *grid, uint32_t *step, size_t *offset)
+{
+  uint32_t rate = steps->rate;
+
+  /* Restart on the first step at or after the block start */
+  if (!steps->synced || grid->jumped)
+  {
+    steps->next = grid->tick / rate + ((grid->tick % rate) != 0 || grid->frac > 0.0f);
+    steps->synced = true;
+  }
+
+  uint32_t next = steps->next;
+  float ticks = (float)(int32_t)(next * rate - grid->tick) - grid->frac;
+
+  if (next & 1)
+  {
+    ticks += steps->swing * (float)rate;
+  }
+
+  /* Nearest sample */
+  float samples = ticks * grid->samples_per_tick + 0.5f;
+
+  if (samples >= (float)grid->length)
+  {
+    return false;
+  }
+
+  /* A step the grid has just moved past plays at the start of the block */
+  *offset = samples > 0.0f ? (size_t)samples : 0;
+  *step = next;
+  steps->next = next + 1;
+
+  return true;
+}
@@ -0,0 +1,109 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef TEMPO_H
+#define TEMPO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clock.h"
+
+/*
+  Tick grid for tempo synced event generators (arpeggiator, sequencer).
+
+  Generators place their steps on a grid of MIDI clock ticks, MIDI_CLOCK_PPQN
+  per beat. tempo_block() works out where the block being rendered sits on
+  that grid, the position at its first sample and the samples per tick, so
+  a step lands on its exact sample offset in the block rather than on a
+  FreeRTOS tick or a block boundary.
+
+  While the MIDI clock is locked and running the grid follows it,
+  extrapolated between ticks. Otherwise the grid runs at the MIDI clock
+  tempo if one is locked, or the internal tempo, carrying on from the last
+  position so nothing jumps when the external clock stops.
+
+  Positions are a whole tick count plus a fraction, they stay precise
+  however long the transport runs. Each generator keeps a tempo_steps_t,
+  the number of its next step, so every step fires exactly once even when
+  the clock filter nudges the grid back between blocks.
+*/
+
+/* Default internal tempo */
+#define TEMPO_DEFAULT_BPM (120.0f)
+
+/* Position of one block on the grid */
+typedef struct
+{
+  uint32_t time;            /* Sample time of the first sample */
+  uint32_t tick;            /* Whole ticks at the first sample */
+  float frac;               /* Fraction of a tick at the first sample */
+  float samples_per_tick;
+  size_t length;            /* Samples in the block */
+  bool running;             /* Transport running, sequencers play */
+  bool jumped;              /* Position jumped (start, song position), generators resync */
+} tempo_grid_t;
+
+/* Internal tempo and the grid position carried between blocks */
+typedef struct
+{
+  float sample_rate;
+  float bpm;
+  bool running;             /* Internal transport, set by MIDI start and stop */
+  uint32_t tick;            /* Position at the start of the next block */
+  float frac;
+} tempo_t;
+
+/* Steps of a generator, every rate ticks */
+typedef struct
+{
+  uint8_t rate;             /* Ticks per step, 6 is a sixteenth note */
+  float swing;              /* Delay of every second step, fraction of a step 0-0.5 */
+  uint32_t next;            /* Number of the next step to fire */
+  bool synced;              /* next is valid, cleared to restart on the grid */
+} tempo_steps_t;
+
+/* API */
+void tempo_init(tempo_t *tempo, float sample_rate);
+void tempo_set_bpm(tempo_t *tempo, float bpm);
+void tempo_start(tempo_t *tempo);
+void tempo_set_running(tempo_t *tempo, bool running);
+void tempo_block(tempo_t *tempo, const midi_clock_state_t *clock, uint32_t time, size_t length, tempo_grid_t *grid);
+
+void tempo_steps_init(tempo_steps_t *steps, uint8_t rate, float swing);
+bool tempo_next_step(tempo_steps_t *steps, const tempo_grid_t *grid, uint32_t *step, size_t *offset);
+
+/**
+ * tempo_step_samples
+ * \brief the length of a step in samples.
+ * \param steps the steps
+ * \param grid the block position
+ */
+static inline float tempo_step_samples(const tempo_steps_t *steps, const tempo_grid_t *grid)
+{
+  return (float)steps->rate * grid->samples_per_tick;
+}
+
+/**
+ * tempo_due
+ * \brief true if an event at a sample time falls in or before the block.
+ * \param grid the block position
+ * \param time the event sample time
+ * \param offset receives the offset in the block, 0 if the time has passed
+ */
+static inline bool tempo_due(const tempo_grid_t *grid, uint32_t time, size_t *offset)
+{
+  int32_t delta = (int32_t)(time - grid->time);
+
+  *offset = delta > 0 ? (size_t)delta : 0;
+
+  return delta < (int32_t)grid->length;
+}
+
+#endif /* TEMPO_H */
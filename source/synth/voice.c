@@ -0,0 +1,530 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+
+#include "dae.h"
+#include "sections.h"
+#include "trace.h"
+#include "voice.h"
+
+/* Voice level at full volume, velocity and pressure, leaves headroom for all voices */
+#define VOICE_LEVEL (0.25f)
+
+/* Lowpass cutoff at zero brightness and the range brightness sweeps it over */
+#define VOICE_CUTOFF_MIN (100.0f)
+#define VOICE_CUTOFF_OCTAVES (8.0f)
+
+/* Envelope output for the voice being rendered */
+static float env_buffer[DAE_AUDIO_BLOCK_SIZE];
+
+/* Private functions */
+static int allocate(const voices_t *voices, uint8_t channel, uint8_t note);
+static float target_increment(const voices_t *voices, int v);
+static float target_gain(const voices_t *voices, int v);
+static float target_cutoff(const voices_t *voices, int v);
+
+/**
+ * voice_init
+ * \brief initialises the pool with all voices idle.
+ * \param voices the voice pool
+ * \param sample_rate the sample rate
+ */
+void voice_init(voices_t *voices, float sample_rate)
+{
+  RTT_ASSERT(voices != NULL);
+
+  voices->sample_rate = sample_rate;
+  voices->serial = 0;
+  voices->limit = VOICE_MAX;
+
+  for (int part = 0; part < VOICE_PARTS; part++)
+  {
+    voices->settings[part].volume = 1.0f;
+    voices->settings[part].brightness = 1.0f;
+    env_init(&voices->settings[part].env, sample_rate, ENV_RETRIGGER);
+  }
+
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    voices->part[v] = 0;
+    voices->channel[v] = 0;
+    voices->note[v] = 0;
+    voices->held[v] = false;
+    voices->started[v] = 0;
+    voices->velocity[v] = 0.0f;
+    voices->bend[v] = 0.0f;
+    voices->pressure[v] = 0.0f;
+    voices->timbre[v] = 0.5f;
+    voices->phase[v] = 0.0f;
+    voices->increment[v] = 0.0f;
+    voices->gain[v] = 0.0f;
+    voices->cutoff[v] = 0.0f;
+    voices->lowpass[v] = 0.0f;
+    env_init(&voices->env[v], sample_rate, ENV_RETRIGGER);
+  }
+}
+
+/**
+ * voice_set_limit
+ * \brief sets the number of voices notes are allocated from, voices past it finish their notes.
+ * \param voices the voice pool
+ * \param limit 1 to VOICE_MAX
+ */
+void voice_set_limit(voices_t *voices, uint8_t limit)
+{
+  voices->limit = limit < 1 ? 1 : (limit > VOICE_MAX ? VOICE_MAX : limit);
+}
+
+/**
+ * voice_set_adsr
+ * \brief sets the amplitude envelope of a part's voices.
+ * \param voices the voice pool
+ * \param part the part
+ * \param attack attack time in seconds
+ * \param decay decay time in seconds
+ * \param sustain sustain level 0-1
+ * \param release release time in seconds
+ */
+void voice_set_adsr(voices_t *voices, uint8_t part, float attack, float decay, float sustain, float release)
+{
+  env_t *env = &voices->settings[part].env;
+
+  env_set_adsr(env, attack, decay, sustain, release);
+
+  /* The coefficients are the same for every voice of the part, work them out once */
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->part[v] == part)
+    {
+      env_copy_adsr(&voices->env[v], env);
+    }
+  }
+}
+
+/**
+ * voice_set_volume
+ * \brief sets the level of a part, its voices glide to it over a block.
+ * \param voices the voice pool
+ * \param part the part
+ * \param volume 0-1
+ */
+void voice_set_volume(voices_t *voices, uint8_t part, float volume)
+{
+  voices->settings[part].volume = volume;
+}
+
+/**
+ * voice_set_brightness
+ * \brief sets the lowpass cutoff position that timbre is offset from.
+ * \param voices the voice pool
+ * \param part the part
+ * \param brightness 0-1, 1 is fully open at centre timbre
+ */
+void voice_set_brightness(voices_t *voices, uint8_t part, float brightness)
+{
+  voices->settings[part].brightness = brightness;
+}
+
+/**
+ * voice_prepare
+ * \brief works out the settings for a patch, ready for voice_apply().
+ * \details this is where the maths is, it can run in any task.
+ * \param settings receives the settings
+ * \param sample_rate the sample rate of the pool they will be applied to
+ * \param volume 0-1
+ * \param brightness 0-1
+ * \param attack attack time in seconds
+ * \param decay decay time in seconds
+ * \param sustain sustain level 0-1
+ * \param release release time in seconds
+ */
+void voice_prepare(voice_settings_t *settings, float sample_rate, float volume, float brightness,
+                   float attack, float decay, float sustain, float release)
+{
+  settings->volume = volume;
+  settings->brightness = brightness;
+  env_init(&settings->env, sample_rate, ENV_RETRIGGER);
+  env_set_adsr(&settings->env, attack, decay, sustain, release);
+}
+
+/**
+ * voice_apply
+ * \brief applies prepared settings to a part, its running voices glide to them.
+ * \param voices the voice pool
+ * \param part the part
+ * \param settings the settings from voice_prepare()
+ */
+void voice_apply(voices_t *voices, uint8_t part, const voice_settings_t *settings)
+{
+  voices->settings[part] = *settings;
+
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->part[v] == part)
+    {
+      env_copy_adsr(&voices->env[v], &settings->env);
+    }
+  }
+}
+
+/**
+ * voice_note_on
+ * \brief starts a note, stealing a voice if none is free.
+ * \param voices the voice pool
+ * \param part the part playing the note, its settings apply to the voice
+ * \param channel the MIDI channel, expression on this channel follows the note
+ * \param note the MIDI note number
+ * \param velocity 0-1
+ * \param bend the channel bend at note on, in semitones
+ * \param pressure the channel pressure at note on, 0-1
+ * \param timbre the channel timbre at note on, 0-1
+ * \return the voice index
+ */
+int voice_note_on(voices_t *voices, uint8_t part, uint8_t channel, uint8_t note, float velocity, float bend, float pressure, float timbre)
+{
+  RTT_ASSERT(part < VOICE_PARTS);
+
+  int v = allocate(voices, channel, note);
+  bool was_idle = env_is_idle(&voices->env[v]);
+
+  if (voices->part[v] != part)
+  {
+    voices->part[v] = part;
+    env_copy_adsr(&voices->env[v], &voices->settings[part].env);
+  }
+
+  voices->channel[v] = channel;
+  voices->note[v] = note;
+  voices->held[v] = true;
+  voices->started[v] = ++voices->serial;
+  voices->velocity[v] = velocity;
+  voices->bend[v] = bend;
+  voices->pressure[v] = pressure;
+  voices->timbre[v] = timbre;
+
+  /* A voice starting from silence jumps to its targets, a stolen one glides from where it was */
+  if (was_idle)
+  {
+    voices->phase[v] = 0.0f;
+    voices->lowpass[v] = 0.0f;
+    voices->increment[v] = target_increment(voices, v);
+    voices->gain[v] = target_gain(voices, v);
+    voices->cutoff[v] = target_cutoff(voices, v);
+  }
+
+  env_gate_on(&voices->env[v]);
+
+  return v;
+}
+
+/**
+ * voice_note_off
+ * \brief releases the voice playing a note.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param note the MIDI note number
+ */
+void voice_note_off(voices_t *voices, uint8_t channel, uint8_t note)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->held[v] && voices->channel[v] == channel && voices->note[v] == note)
+    {
+      voices->held[v] = false;
+      env_gate_off(&voices->env[v]);
+    }
+  }
+}
+
+/**
+ * voice_all_off
+ * \brief releases every voice on a channel.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param immediate true to silence at once (All Sound Off), false to release (All Notes Off)
+ */
+void voice_all_off(voices_t *voices, uint8_t channel, bool immediate)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->channel[v] == channel)
+    {
+      voices->held[v] = false;
+
+      if (immediate)
+      {
+        env_reset(&voices->env[v]);
+      }
+      else
+      {
+        env_gate_off(&voices->env[v]);
+      }
+    }
+  }
+}
+
+/**
+ * voice_set_bend
+ * \brief sets the pitch bend of the voices on a channel.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param bend the bend in semitones
+ */
+void voice_set_bend(voices_t *voices, uint8_t channel, float bend)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->channel[v] == channel)
+    {
+      voices->bend[v] = bend;
+    }
+  }
+}
+
+/**
+ * voice_set_pressure
+ * \brief sets the pressure of the voices on a channel.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param pressure 0-1
+ */
+void voice_set_pressure(voices_t *voices, uint8_t channel, float pressure)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->channel[v] == channel)
+    {
+      voices->pressure[v] = pressure;
+    }
+  }
+}
+
+/**
+ * voice_set_note_pressure
+ * \brief sets the pressure of one note (polyphonic aftertouch).
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param note the MIDI note number
+ * \param pressure 0-1
+ */
+void voice_set_note_pressure(voices_t *voices, uint8_t channel, uint8_t note, float pressure)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->channel[v] == channel && voices->note[v] == note)
+    {
+      voices->pressure[v] = pressure;
+    }
+  }
+}
+
+/**
+ * voice_set_timbre
+ * \brief sets the timbre of the voices on a channel.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param timbre 0-1
+ */
+void voice_set_timbre(voices_t *voices, uint8_t channel, float timbre)
+{
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->channel[v] == channel)
+    {
+      voices->timbre[v] = timbre;
+    }
+  }
+}
+
+/**
+ * voice_active_parts
+ * \brief the parts with voices sounding.
+ * \param voices the voice pool
+ * \return a mask with bit n set for part n
+ */
+uint32_t voice_active_parts(const voices_t *voices)
+{
+  uint32_t parts = 0;
+
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (!env_is_idle(&voices->env[v]))
+    {
+      parts |= 1UL << voices->part[v];
+    }
+  }
+
+  return parts;
+}
+
+/**
+ * voice_render
+ * \brief renders the active voices of a part, adding into the output.
+ * \param voices the voice pool
+ * \param part the part
+ * \param out the output buffer, accumulated into
+ * \param n the number of samples, at most DAE_AUDIO_BLOCK_SIZE
+ * \return true if any voice was active
+ */
+RAMFUNC bool voice_render(voices_t *voices, uint8_t part, float *restrict out, size_t n)
+{
+  RTT_ASSERT(n <= DAE_AUDIO_BLOCK_SIZE);
+
+  bool active = false;
+  float scale = 1.0f / (float)n;
+
+  for (int v = 0; v < VOICE_MAX; v++)
+  {
+    if (voices->part[v] != part || env_is_idle(&voices->env[v]))
+    {
+      continue;
+    }
+
+    active = true;
+    env_process(&voices->env[v], env_buffer, n);
+
+    /* Expression is sampled once per block and ramped across it */
+    float increment = voices->increment[v];
+    float gain = voices->gain[v];
+    float cutoff = voices->cutoff[v];
+    float d_increment = (target_increment(voices, v) - increment) * scale;
+    float d_gain = (target_gain(voices, v) - gain) * scale;
+    float d_cutoff = (target_cutoff(voices, v) - cutoff) * scale;
+    float phase = voices->phase[v];
+    float lowpass = voices->lowpass[v];
+
+    for (size_t i = 0; i < n; i++)
+    {
+      increment += d_increment;
+      gain += d_gain;
+      cutoff += d_cutoff;
+
+      /* PolyBLEP sawtooth */
+      float saw = 2.0f * phase - 1.0f;
+      if (phase < increment)
+      {
+        float t = phase / increment;
+        saw -= t + t - t * t - 1.0f;
+      }
+      else if (phase > 1.0f - increment)
+      {
+        float t = (phase - 1.0f) / increment;
+        saw -= t * t + t + t + 1.0f;
+      }
+
+      phase += increment;
+      if (phase >= 1.0f)
+      {
+        phase -= 1.0f;
+      }
+
+      lowpass += cutoff * (saw - lowpass);
+      out[i] += lowpass * gain * env_buffer[i];
+    }
+
+    voices->increment[v] = increment;
+    voices->gain[v] = gain;
+    voices->cutoff[v] = cutoff;
+    voices->phase[v] = phase;
+    voices->lowpass[v] = lowpass;
+  }
+
+  return active;
+}
+
+/**
+ * voice_max_for_budget
+ * \brief the polyphony that fits a cycle budget per block.
+ * \param cycle_budget cycles per block available to the voices
+ * \return the number of voices, 1 to VOICE_MAX
+ */
+uint8_t voice_max_for_budget(uint32_t cycle_budget)
+{
+  uint32_t count = cycle_budget / VOICE_CYCLES;
+
+  return count < 1 ? 1 : (count > VOICE_MAX ? VOICE_MAX : (uint8_t)count);
+}
+
+/**
+ * allocate
+ * \brief picks a voice for a new note.
+ * \param voices the voice pool
+ * \param channel the MIDI channel
+ * \param note the MIDI note number
+ * \return the voice, the same note already sounding on the channel is reused
+ */
+static int allocate(const voices_t *voices, uint8_t channel, uint8_t note)
+{
+  int idle = VOICE_NONE;
+  int released = VOICE_NONE;
+  int oldest = 0;
+
+  for (int v = 0; v < voices->limit; v++)
+  {
+    if (env_is_idle(&voices->env[v]))
+    {
+      idle = idle == VOICE_NONE ? v : idle;
+      continue;
+    }
+
+    if (voices->channel[v] == channel && voices->note[v] == note)
+    {
+      return v;
+    }
+
+    if (!voices->held[v] && (released == VOICE_NONE || voices->started[v] < voices->started[released]))
+    {
+      released = v;
+    }
+
+    if (voices->started[v] < voices->started[oldest])
+    {
+      oldest = v;
+    }
+  }
+
+  if (idle != VOICE_NONE)
+  {
+    return idle;
+  }
+
+  return released != VOICE_NONE ? released : oldest;
+}
+
+/**
+ * target_increment
+ * \brief the phase increment for the voice's note and bend.
+ */
+static float target_increment(const voices_t *voices, int v)
+{
+  float pitch = (float)voices->note[v] + voices->bend[v];
+
+  return 440.0f * exp2f((pitch - 69.0f) * (1.0f / 12.0f)) / voices->sample_rate;
+}
+
+/**
+ * target_gain
+ * \brief the voice level from velocity and pressure.
+ */
+static float target_gain(const voices_t *voices, int v)
+{
+  return VOICE_LEVEL * voices->settings[voices->part[v]].volume * voices->velocity[v] * (0.5f + 0.5f * voices->pressure[v]);
+}
+
+/**
+ * target_cutoff
+ * \brief the lowpass coefficient for the brightness offset by the voice's timbre.
+ */
+static float target_cutoff(const voices_t *voices, int v)
+{
+  float position = fminf(fmaxf(voices->settings[voices->part[v]].brightness + voices->timbre[v] - 0.5f, 0.0f), 1.0f);
+  float frequency = VOICE_CUTOFF_MIN * exp2f(position * VOICE_CUTOFF_OCTAVES);
+
+  return 1.0f - expf(-2.0f * (float)M_PI * frequency / voices->sample_rate);
+}
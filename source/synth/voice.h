@@ -0,0 +1,126 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef VOICE_H
+#define VOICE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "env.h"
+
+/*
+  Polyphonic voice pool.
+
+  Voice state is held as a structure of arrays, one array per field indexed
+  by voice, so the render loop walks contiguous memory and the per-note
+  expression (bend, pressure, timbre) is just another field. MIDI writes the
+  expression targets, the render loop reads them once per block and ramps
+  its own state to them across the block, there is no per-sample lookup or
+  indirection and no zipper noise from stepped controllers.
+
+  Each voice is a PolyBLEP sawtooth through a one-pole lowpass whose cutoff
+  is set by the brightness parameter and offset by timbre, shaped by an ADSR
+  amplitude envelope. Volume, velocity and pressure set the level.
+
+  The pool is shared by up to VOICE_PARTS parts, each playing its own
+  patch. Every voice is tagged with the part that started it and takes its
+  level, brightness and envelope from that part's settings. voice_render()
+  renders one part at a time, so a part's settings and coefficients stay
+  in registers and cache across all of its voices.
+
+  Allocation takes a free voice, then the oldest released voice, then the
+  oldest held voice, from the first limit voices of the pool. The limit is
+  set from the CPU budget with voice_max_for_budget().
+
+  The settings a patch determines (level, brightness and the envelope
+  coefficients) can also be computed ahead into a voice_settings_t with
+  voice_prepare(), outside the audio task, and applied to a part in one go
+  with voice_apply(), which does no maths.
+*/
+
+/* Polyphony, shared by all parts */
+#ifndef VOICE_MAX
+#define VOICE_MAX (16)
+#endif
+
+/* Parts, one per MIDI channel */
+#define VOICE_PARTS (16)
+
+/* Estimated cost of rendering one voice for a 128 sample block on the F411 */
+#ifndef VOICE_CYCLES
+#define VOICE_CYCLES (5500)
+#endif
+
+/* No voice, returned when a note cannot be found */
+#define VOICE_NONE (-1)
+
+/* Patch dependent settings of a part, see voice_prepare() */
+typedef struct
+{
+  float volume;                 /* 0-1 */
+  float brightness;             /* 0-1 lowpass cutoff position */
+  env_t env;                    /* Envelope parameters, its stage and level are unused */
+} voice_settings_t;
+
+/* Voice pool, the per voice fields are indexed by voice */
+typedef struct
+{
+  float sample_rate;
+  uint32_t serial;              /* Note on counter, orders voices by age */
+  uint8_t limit;                /* Voices in use, the rest are left to finish */
+  voice_settings_t settings[VOICE_PARTS];
+
+  /* Allocation */
+  uint8_t part[VOICE_MAX];
+  uint8_t channel[VOICE_MAX];
+  uint8_t note[VOICE_MAX];
+  bool held[VOICE_MAX];         /* Key is down */
+  uint32_t started[VOICE_MAX];  /* serial at note on */
+
+  /* Expression targets, written from MIDI and read once per block */
+  float velocity[VOICE_MAX];    /* 0-1 */
+  float bend[VOICE_MAX];        /* Semitones */
+  float pressure[VOICE_MAX];    /* 0-1 */
+  float timbre[VOICE_MAX];      /* 0-1 */
+
+  /* Render state, ramped to the targets over each block */
+  float phase[VOICE_MAX];
+  float increment[VOICE_MAX];
+  float gain[VOICE_MAX];
+  float cutoff[VOICE_MAX];      /* Lowpass coefficient */
+  float lowpass[VOICE_MAX];     /* Lowpass state */
+  env_t env[VOICE_MAX];
+} voices_t;
+
+/* API */
+void voice_init(voices_t *voices, float sample_rate);
+void voice_set_limit(voices_t *voices, uint8_t limit);
+void voice_set_adsr(voices_t *voices, uint8_t part, float attack, float decay, float sustain, float release);
+void voice_set_volume(voices_t *voices, uint8_t part, float volume);
+void voice_set_brightness(voices_t *voices, uint8_t part, float brightness);
+
+void voice_prepare(voice_settings_t *settings, float sample_rate, float volume, float brightness,
+                   float attack, float decay, float sustain, float release);
+void voice_apply(voices_t *voices, uint8_t part, const voice_settings_t *settings);
+
+int voice_note_on(voices_t *voices, uint8_t part, uint8_t channel, uint8_t note, float velocity, float bend, float pressure, float timbre);
+void voice_note_off(voices_t *voices, uint8_t channel, uint8_t note);
+void voice_all_off(voices_t *voices, uint8_t channel, bool immediate);
+
+void voice_set_bend(voices_t *voices, uint8_t channel, float bend);
+void voice_set_pressure(voices_t *voices, uint8_t channel, float pressure);
+void voice_set_note_pressure(voices_t *voices, uint8_t channel, uint8_t note, float pressure);
+void voice_set_timbre(voices_t *voices, uint8_t channel, float timbre);
+
+uint32_t voice_active_parts(const voices_t *voices);
+bool voice_render(voices_t *voices, uint8_t part, float *restrict out, size_t n);
+uint8_t voice_max_for_budget(uint32_t cycle_budget);
+
+#endif /* VOICE_H */
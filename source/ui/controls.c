@@ -0,0 +1,106 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "controls.h"
+#include "trace.h"
+
+/**
+ * controls_init
+ * \brief initialises the control surface, positions are unknown until the first batch.
+ * \param controls the controls
+ * \param count the number of controls in each scan, up to CONTROLS_MAX
+ */
+void controls_init(controls_t *controls, size_t count)
+{
+  RTT_ASSERT(controls != NULL);
+  RTT_ASSERT(count <= CONTROLS_MAX);
+
+  memset(controls, 0, sizeof(controls_t));
+  controls->count = count;
+}
+
+/**
+ * controls_process
+ * \brief decimates, smooths and applies hysteresis to a batch of scans.
+ * \param controls the controls
+ * \param scans n scans of count readings each, control 0 first
+ * \param n the number of scans in the batch
+ * \return a bit per control whose position changed
+ */
+uint32_t controls_process(controls_t *controls, const uint16_t *scans, size_t n)
+{
+  uint32_t changed = 0;
+
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  float scale = 1.0f / (float)n;
+
+  for (size_t c = 0; c < controls->count; c++)
+  {
+    uint32_t sum = 0;
+    for (size_t s = 0; s < n; s++)
+    {
+      sum += scans[s * controls->count + c];
+    }
+
+    float reading = (float)sum * scale;
+
+    /* The first batch sets the position outright, snapped as below so a pot at an end does not move next batch */
+    float smoothed = reading;
+    float position = reading;
+    if (controls->primed)
+    {
+      smoothed = controls->smoothed[c] + (reading - controls->smoothed[c]) * CONTROLS_SMOOTHING;
+      position = controls->position[c];
+    }
+    controls->smoothed[c] = smoothed;
+
+    /* Near the ends snap to them, otherwise the hysteresis would stop short of full range */
+    if (smoothed < CONTROLS_HYSTERESIS)
+    {
+      position = 0.0f;
+    }
+    else if (smoothed > CONTROLS_FULL_SCALE - CONTROLS_HYSTERESIS)
+    {
+      position = CONTROLS_FULL_SCALE;
+    }
+    else if (smoothed > position + CONTROLS_HYSTERESIS || smoothed < position - CONTROLS_HYSTERESIS)
+    {
+      position = smoothed;
+    }
+
+    if (position != controls->position[c] && controls->primed)
+    {
+      changed |= 1UL << c;
+    }
+    controls->position[c] = position;
+  }
+
+  controls->primed = true;
+
+  return changed;
+}
+
+/**
+ * controls_value
+ * \brief the position of a control.
+ * \param controls the controls
+ * \param index the control
+ * \return the position 0-1
+ */
+float controls_value(const controls_t *controls, size_t index)
+{
+  RTT_ASSERT(index < controls->count);
+
+  return controls->position[index] * (1.0f / CONTROLS_FULL_SCALE);
+}
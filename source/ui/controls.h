@@ -0,0 +1,67 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef CONTROLS_H
+#define CONTROLS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Front panel pots and faders, from raw ADC scans to stable positions.
+
+  The hardware scans every control continuously into a DMA buffer, each
+  scan holding one 12 bit reading per control. controls_process() takes a
+  batch of scans and for each control:
+
+    - decimates, the batch is averaged to one reading
+    - smooths, a one pole lowpass over successive batches
+    - applies hysteresis, the position only moves once the smoothed
+      reading is a few LSBs away from it, so a pot resting between two
+      values does not flicker
+
+  It returns a bit per control that moved, only those need posting to the
+  engine. The first batch sets the positions without reporting them, the
+  pots take over a parameter when they are moved, not at power on.
+
+  There is no hardware access here, recorded ADC traces can be fed to it
+  on the host.
+*/
+
+/* Most controls, one changed bit each */
+#define CONTROLS_MAX (16)
+
+/* ADC full scale */
+#define CONTROLS_FULL_SCALE (4095.0f)
+
+/* Smoothing per batch, 0-1, smaller is smoother and slower */
+#ifndef CONTROLS_SMOOTHING
+#define CONTROLS_SMOOTHING (0.5f)
+#endif
+
+/* Movement in LSBs needed to change the position */
+#ifndef CONTROLS_HYSTERESIS
+#define CONTROLS_HYSTERESIS (6.0f)
+#endif
+
+/* Control surface state */
+typedef struct
+{
+  size_t count;
+  bool primed;                        /* False until the first batch */
+  float smoothed[CONTROLS_MAX];       /* Lowpassed reading */
+  float position[CONTROLS_MAX];       /* Reported reading, moves in hysteresis steps */
+} controls_t;
+
+/* API */
+void controls_init(controls_t *controls, size_t count);
+uint32_t controls_process(controls_t *controls, const uint16_t *scans, size_t n);
+float controls_value(const controls_t *controls, size_t index);
+
+#endif /* CONTROLS_H */
@@ -0,0 +1,255 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "display.h"
+#include "trace.h"
+
+/* Private functions */
+static void write_column(display_t *display, int x, int page, uint8_t mask, uint8_t bits);
+
+/**
+ * display_init
+ * \brief initialises the display blank, every page dirty so the first flush clears the panel.
+ * \param display the display
+ */
+void display_init(display_t *display)
+{
+  RTT_ASSERT(display != NULL);
+
+  memset(display, 0, sizeof(display_t));
+  display->dirty = (uint8_t)((1U << DISPLAY_PAGES) - 1);
+}
+
+/**
+ * display_clear
+ * \brief blanks the display.
+ * \param display the display
+ */
+void display_clear(display_t *display)
+{
+  display_fill(display, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, false);
+}
+
+/**
+ * display_pixel
+ * \brief sets or clears a pixel, off screen pixels are ignored.
+ * \param display the display
+ * \param x the column
+ * \param y the row, 0 at the top
+ * \param on true to light the pixel
+ */
+void display_pixel(display_t *display, int x, int y, bool on)
+{
+  if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y >= DISPLAY_HEIGHT)
+  {
+    return;
+  }
+
+  uint8_t mask = (uint8_t)(1U << (y & 7));
+  write_column(display, x, y >> 3, mask, on ? mask : 0);
+}
+
+/**
+ * display_get
+ * \brief reads a pixel.
+ * \param display the display
+ * \param x the column
+ * \param y the row
+ * \return true if lit, false if unlit or off screen
+ */
+bool display_get(const display_t *display, int x, int y)
+{
+  if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y >= DISPLAY_HEIGHT)
+  {
+    return false;
+  }
+
+  return (display->page[y >> 3][x] >> (y & 7)) & 1;
+}
+
+/**
+ * display_fill
+ * \brief sets or clears a rectangle, clipped to the screen.
+ * \details works a page byte at a time, a full screen costs 1024 byte writes.
+ * \param display the display
+ * \param x the left column
+ * \param y the top row
+ * \param w the width
+ * \param h the height
+ * \param on true to light the pixels
+ */
+void display_fill(display_t *display, int x, int y, int w, int h, bool on)
+{
+  int x0 = x < 0 ? 0 : x;
+  int y0 = y < 0 ? 0 : y;
+  int x1 = x + w > DISPLAY_WIDTH ? DISPLAY_WIDTH : x + w;
+  int y1 = y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y + h;
+
+  if (x0 >= x1 || y0 >= y1)
+  {
+    return;
+  }
+
+  for (int page = y0 >> 3; page <= (y1 - 1) >> 3; page++)
+  {
+    /* Rows of this page inside the rectangle */
+    int top = page * 8 > y0 ? 0 : y0 - page * 8;
+    int bottom = page * 8 + 8 < y1 ? 8 : y1 - page * 8;
+    uint8_t mask = (uint8_t)((0xFFU << top) & (0xFFU >> (8 - bottom)));
+
+    for (int col = x0; col < x1; col++)
+    {
+      write_column(display, col, page, mask, on ? mask : 0);
+    }
+  }
+}
+
+/**
+ * display_frame
+ * \brief draws a one pixel rectangle outline.
+ * \param display the display
+ * \param x the left column
+ * \param y the top row
+ * \param w the width
+ * \param h the height
+ */
+void display_frame(display_t *display, int x, int y, int w, int h)
+{
+  display_fill(display, x, y, w, 1, true);
+  display_fill(display, x, y + h - 1, w, 1, true);
+  display_fill(display, x, y, 1, h, true);
+  display_fill(display, x + w - 1, y, 1, h, true);
+}
+
+/**
+ * display_text
+ * \brief draws a string, characters outside the font are drawn as spaces.
+ * \details the glyph background is cleared so text can be redrawn over itself.
+ *          Text on a row that is a multiple of 8 touches one page per glyph column.
+ * \param display the display
+ * \param font the font
+ * \param x the left column
+ * \param y the top row
+ * \param text the string
+ * \return the column after the last character
+ */
+int display_text(display_t *display, const font_t *font, int x, int y, const char *text)
+{
+  uint8_t rows = (uint8_t)((1U << font->height) - 1);
+
+  for (; *text != '\0'; text++)
+  {
+    unsigned index = (unsigned)(*text - font->first);
+    const uint8_t *glyph = index < font->count ? &font->glyphs[index * font->width] : NULL;
+
+    for (int c = 0; c <= font->width; c++, x++)
+    {
+      if (x < 0 || x >= DISPLAY_WIDTH)
+      {
+        continue;
+      }
+
+      /* The last column is the gap to the next character */
+      uint8_t bits = (glyph != NULL && c < font->width) ? glyph[c] : 0;
+
+      /* A glyph column spans at most two pages */
+      int page = y >> 3;
+      int shift = y & 7;
+
+      if (y >= 0 && page < DISPLAY_PAGES)
+      {
+        write_column(display, x, page, (uint8_t)(rows << shift), (uint8_t)(bits << shift));
+      }
+
+      if (shift != 0 && y + 8 >= 0 && page + 1 < DISPLAY_PAGES)
+      {
+        write_column(display, x, page + 1, (uint8_t)(rows >> (8 - shift)), (uint8_t)(bits >> (8 - shift)));
+      }
+    }
+  }
+
+  return x;
+}
+
+/**
+ * display_take_dirty
+ * \brief the pages that differ from the last call, they must then be flushed.
+ * \param display the display
+ * \return a bit per page
+ */
+uint8_t display_take_dirty(display_t *display)
+{
+  uint8_t dirty = display->dirty;
+
+  for (int page = 0; page < DISPLAY_PAGES; page++)
+  {
+    if ((display->touched | display->dirty) & (1U << page))
+    {
+      if (memcmp(display->page[page], display->flushed[page], DISPLAY_WIDTH) != 0)
+      {
+        memcpy(display->flushed[page], display->page[page], DISPLAY_WIDTH);
+        dirty |= (uint8_t)(1U << page);
+      }
+    }
+  }
+
+  display->touched = 0;
+  display->dirty = 0;
+
+  return dirty;
+}
+
+/**
+ * display_pgm
+ * \brief writes the framebuffer as a binary PGM image, lit pixels white.
+ * \param display the display
+ * \param out receives the image
+ * \param size the space in out, at least DISPLAY_PGM_SIZE
+ * \return the image length, 0 if out is too small
+ */
+size_t display_pgm(const display_t *display, uint8_t *out, size_t size)
+{
+  static const char header[] = "P5\n128 64\n255\n";
+
+  if (size < DISPLAY_PGM_SIZE)
+  {
+    return 0;
+  }
+
+  memcpy(out, header, sizeof(header) - 1);
+  uint8_t *pixel = out + sizeof(header) - 1;
+
+  for (int y = 0; y < DISPLAY_HEIGHT; y++)
+  {
+    for (int x = 0; x < DISPLAY_WIDTH; x++)
+    {
+      *pixel++ = display_get(display, x, y) ? 255 : 0;
+    }
+  }
+
+  return (size_t)(pixel - out);
+}
+
+/**
+ * write_column
+ * \brief updates the masked bits of one page byte, marking the page touched if it changed.
+ */
+static void write_column(display_t *display, int x, int page, uint8_t mask, uint8_t bits)
+{
+  uint8_t *byte = &display->page[page][x];
+  uint8_t value = (uint8_t)((*byte & ~mask) | (bits & mask));
+
+  if (value != *byte)
+  {
+    *byte = value;
+    display->touched |= (uint8_t)(1U << page);
+  }
+}
+
@@ -0,0 +1,66 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "font.h"
+
+/*
+  Framebuffer for a 128x64 monochrome OLED (SSD1306/SH1106 class).
+
+  The framebuffer has the controller's own layout, 8 pages of 128 columns,
+  each byte 8 vertical pixels with the top row in bit 0, so a page is sent
+  to the display as it is.
+
+  Drawing marks the pages it touches, display_take_dirty() then compares
+  each touched page with a copy of what was last flushed and reports only
+  the pages that really differ. The UI can clear and redraw the whole
+  screen and only the pages that look different are flushed. The copy is
+  another 1KB, a hash would be smaller but a collision would leave a page
+  stale on the panel.
+
+  The flush itself is DMA (see bsp/oled.c), the CPU cost of a frame is the
+  drawing: a full redraw of the UI screen is ~30K cycles (0.3ms).
+
+  There is no hardware access here, display_pgm() dumps the framebuffer as
+  an image so rendering can be checked on the host.
+*/
+
+#define DISPLAY_WIDTH (128)
+#define DISPLAY_HEIGHT (64)
+#define DISPLAY_PAGES (DISPLAY_HEIGHT / 8)
+
+/* Size of the display_pgm() image */
+#define DISPLAY_PGM_SIZE (14 + DISPLAY_WIDTH * DISPLAY_HEIGHT)
+
+/* Display instance */
+typedef struct
+{
+  uint8_t page[DISPLAY_PAGES][DISPLAY_WIDTH];
+  uint8_t flushed[DISPLAY_PAGES][DISPLAY_WIDTH]; /* The pages as last flushed */
+  uint8_t touched;                               /* A bit per page written since the last flush */
+  uint8_t dirty;                                 /* A bit per page that must be flushed regardless */
+} display_t;
+
+/* API */
+void display_init(display_t *display);
+void display_clear(display_t *display);
+void display_pixel(display_t *display, int x, int y, bool on);
+bool display_get(const display_t *display, int x, int y);
+void display_fill(display_t *display, int x, int y, int w, int h, bool on);
+void display_frame(display_t *display, int x, int y, int w, int h);
+int display_text(display_t *display, const font_t *font, int x, int y, const char *text);
+uint8_t display_take_dirty(display_t *display);
+size_t display_pgm(const display_t *display, uint8_t *out, size_t size);
+
+#endif /* DISPLAY_H */
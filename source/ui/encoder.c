@@ -0,0 +1,72 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "encoder.h"
+#include "trace.h"
+
+/**
+ * encoder_init
+ * \brief initialises the encoder at rest.
+ * \param encoder the encoder
+ * \param count the current hardware count
+ */
+void encoder_init(encoder_t *encoder, uint16_t count)
+{
+  RTT_ASSERT(encoder != NULL);
+
+  memset(encoder, 0, sizeof(encoder_t));
+  encoder->count = count;
+}
+
+/**
+ * encoder_read
+ * \brief the accelerated steps turned since the last read.
+ * \details reads must come more often than 32K counts, the count wraps at 16 bits.
+ * \param encoder the encoder
+ * \param count the hardware count
+ * \param now the time in ms
+ * \return the steps, positive clockwise
+ */
+int32_t encoder_read(encoder_t *encoder, uint16_t count, uint32_t now)
+{
+  /* The difference as a signed 16 bit value is right across the wrap */
+  int32_t moved = (int16_t)(uint16_t)(count - encoder->count) + encoder->residue;
+  encoder->count = count;
+
+  int32_t detents = moved / ENCODER_COUNTS_PER_DETENT;
+  encoder->residue = moved - detents * ENCODER_COUNTS_PER_DETENT;
+
+  if (detents == 0)
+  {
+    return 0;
+  }
+
+  int8_t direction = detents > 0 ? 1 : -1;
+  uint32_t turned = (uint32_t)(detents * direction);
+  float gain = 1.0f;
+
+  if (direction == encoder->direction)
+  {
+    uint32_t elapsed = now - encoder->detent_time;
+    float speed = (float)turned * 1000.0f / (float)(elapsed > 0 ? elapsed : 1);
+    float ratio = speed / ENCODER_ACCEL_KNEE;
+
+    gain = 1.0f + ratio * ratio;
+    if (gain > ENCODER_ACCEL_MAX)
+    {
+      gain = ENCODER_ACCEL_MAX;
+    }
+  }
+
+  encoder->direction = direction;
+  encoder->detent_time = now;
+
+  return direction * (int32_t)((float)turned * gain + 0.5f);
+}
@@ -0,0 +1,59 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <stdint.h>
+
+/*
+  Rotary encoder, from a hardware quadrature count to accelerated steps.
+
+  The timer counts every edge of both encoder outputs in hardware, a 16
+  bit count that wraps. encoder_read() takes the count and the time, turns
+  the change into detents and keeps any part detent for the next read.
+
+  Turning quickly scales the steps up. The speed is the detents turned
+  over the time since the last detent, slow turns give one step a detent
+  so fine adjustment stays exact, the gain rises with the square of the
+  speed above that up to ENCODER_ACCEL_MAX. Reversing starts again at
+  one step a detent.
+
+  There is no hardware access here, count sequences can be fed to it on
+  the host.
+*/
+
+/* Counts per detent, 4 edges per quadrature cycle */
+#ifndef ENCODER_COUNTS_PER_DETENT
+#define ENCODER_COUNTS_PER_DETENT (4)
+#endif
+
+/* Speed in detents per second at which the gain reaches 2 */
+#ifndef ENCODER_ACCEL_KNEE
+#define ENCODER_ACCEL_KNEE (10.0f)
+#endif
+
+/* Largest steps per detent */
+#ifndef ENCODER_ACCEL_MAX
+#define ENCODER_ACCEL_MAX (10.0f)
+#endif
+
+/* Encoder state */
+typedef struct
+{
+  uint16_t count;                   /* Hardware count at the last read */
+  int32_t residue;                  /* Counts short of a whole detent */
+  uint32_t detent_time;             /* Time of the last detent, ms */
+  int8_t direction;                 /* Of the last detent, 0 before the first */
+} encoder_t;
+
+/* API */
+void encoder_init(encoder_t *encoder, uint16_t count);
+int32_t encoder_read(encoder_t *encoder, uint16_t count, uint32_t now);
+
+#endif /* ENCODER_H */
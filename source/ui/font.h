@@ -0,0 +1,35 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef FONT_H
+#define FONT_H
+
+#include <stdint.h>
+
+/*
+  Bitmap fonts for the display, held in flash.
+
+  Glyphs are stored a column at a time, one byte per column with the top
+  row in bit 0, the same layout as a display page, so a glyph up to 8
+  pixels high is copied a column at a time.
+*/
+
+/* Font descriptor */
+typedef struct
+{
+  uint8_t width;                    /* Glyph columns, the advance is one more */
+  uint8_t height;                   /* Glyph rows, at most 8 */
+  char first;                       /* First character in the table */
+  uint8_t count;                    /* Number of glyphs */
+  const uint8_t *glyphs;            /* width bytes per glyph */
+} font_t;
+
+/* Fonts */
+extern const font_t font_5x7;
+
+#endif /* FONT_H */
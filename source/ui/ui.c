@@ -11,25 +11,324 @@
    this permission notice appear in all copies.
   ------------------------------------------------------------------------------
 */
+#include <assert.h>
+#include <math.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
+#include "controls.h"
+#include "display.h"
+#include "encoder.h"
+#include "font.h"
+#include "synth.h"
 #include "ui.h"
 
+/*
+  The UI task is event driven, it sleeps on its task notification until an
+  interrupt sets one of the event bits below. The button is debounced and
+  the LED patterns are played by the hardware (see bsp/panel.c), so an idle
+  UI never wakes and never preempts anything.
+
+  The pot scan interrupt decimates each batch of 16 scans, every 8ms, in
+  place. It costs a few microseconds and the batch is finished with before
+  the DMA comes round to overwrite it. The positions of pots that moved are
+  copied out and the task woken, a pot at rest wakes nothing. The task
+  posts them to the engine, through the same parameter store as MIDI CCs.
+  The interrupt also wakes the task when the encoder count changes, the
+  task then nudges the parameter on the display up or down.
+
+  The screen is redrawn in full whenever something on it changes, the
+  framebuffer only marks pages whose bytes differ and only those are
+  flushed. Drawing waits while a flush is reading the framebuffer.
+*/
+
+/* Task notification bits, one per event source */
+#define UI_EVENT_BUTTON (1UL << 0)
+#define UI_EVENT_CONTROLS (1UL << 1)
+#define UI_EVENT_DISPLAY (1UL << 2)
+#define UI_EVENT_ENCODER (1UL << 3)
+
+/* The parameter each pot edits, on part 0 */
+static const param_id_t control_param[] = {
+    PARAM_VOLUME, PARAM_CUTOFF, PARAM_ATTACK, PARAM_DECAY,
+    PARAM_SUSTAIN, PARAM_RELEASE, PARAM_REVERB_SEND, PARAM_DELAY_SEND};
+
+static_assert(sizeof(control_param) / sizeof(control_param[0]) == CONTROL_COUNT, "one parameter per pot");
+
+/* Their names on the display */
+static const char *const control_name[] = {
+    "Volume", "Cutoff", "Attack", "Decay",
+    "Sustain", "Release", "Reverb", "Delay"};
+
+/* Encoder steps across a parameter's whole range */
+#define ENCODER_STEPS (200)
+
+/* Pot meters, a bar each across the bottom half of the screen */
+#define METER_TOP (32)
+#define METER_WIDTH (DISPLAY_WIDTH / CONTROL_COUNT)
+
+/*
+  LED patterns, one level per 20ms step. A board without PWM on the LED
+  switches it on at 128 and above, so dimmed levels must stay above that.
+*/
+#define HEARTBEAT_STEPS (50)
+static const uint8_t heartbeat[HEARTBEAT_STEPS] = {255, 255, 255};   /* 60ms flash once a second */
+static const uint8_t held[] = {160};                                    /* Steady, dimmed to ~40% duty */
+
+/* Imported functions */
+void led_pattern(const uint8_t *levels, size_t steps);
+bool oled_flush(const uint8_t *framebuffer, uint8_t dirty);
+uint16_t encoder_count(void);
+
+static TaskHandle_t ui_task_handle;
+
+#define UI_STACK_SIZE (configMINIMAL_STACK_SIZE * 4)
+static StackType_t ui_stack[UI_STACK_SIZE];
+static StaticTask_t ui_tcb;
+static atomic_bool button_pressed;
+
+/* Pots, decimated by the scan interrupt, the positions are copied out for the task */
+static controls_t controls;
+static _Atomic float control_value[CONTROL_COUNT];
+static atomic_uint_least32_t control_changed;
+
+/* Encoder count at the last scan, the interrupt wakes the task when it moves */
+static uint16_t encoder_last;
+
+/* Encoder, it edits the parameter on the display */
+static encoder_t encoder;
+
+/* Screen, last_control is the pot shown by name */
+static display_t display;
+static bool flushing;
+static bool redraw;
+static size_t last_control;
+
+/* Private functions */
+static void update_controls(void);
+static void update_encoder(void);
+static void draw(void);
+static void notify(uint32_t event);
 
 /**
- * ui_tase
+ * ui_task
  * \brief the user interface thread
  * \param params unused.
  * \note this task never returns
  */
 static void ui_task(void *pvParameters)
 {
-  while(1)
+  encoder_init(&encoder, encoder_count());
+  display_init(&display);
+  led_pattern(heartbeat, HEARTBEAT_STEPS);
+  redraw = true;
+
+  while (1)
+  {
+    uint32_t events;
+
+    if (redraw && !flushing)
+    {
+      draw();
+      redraw = false;
+      flushing = oled_flush(&display.page[0][0], display_take_dirty(&display));
+    }
+
+    xTaskNotifyWait(0, UINT32_MAX, &events, portMAX_DELAY);
+
+    if (events & UI_EVENT_DISPLAY)
+    {
+      flushing = false;
+    }
+
+    if (events & UI_EVENT_BUTTON)
+    {
+      if (atomic_load(&button_pressed))
+      {
+        led_pattern(held, sizeof(held));
+      }
+      else
+      {
+        led_pattern(heartbeat, HEARTBEAT_STEPS);
+      }
+    }
+
+    if (events & UI_EVENT_CONTROLS)
+    {
+      update_controls();
+    }
+
+    if (events & UI_EVENT_ENCODER)
+    {
+      update_encoder();
+    }
+  }
+}
+
+/**
+ * update_controls
+ * \brief posts the pots that moved, and redraws their meters.
+ */
+static void update_controls(void)
+{
+  uint32_t changed = atomic_exchange(&control_changed, 0);
+  param_store_t *params = synth_params(0);
+
+  for (size_t c = 0; changed != 0; c++, changed >>= 1)
+  {
+    if (changed & 1)
+    {
+      param_set_unit(params, control_param[c], atomic_load(&control_value[c]));
+      last_control = c;
+    }
+  }
+
+  /* The first batch only sets the meters */
+  redraw = true;
+}
+
+/**
+ * update_encoder
+ * \brief steps the parameter on the display by the encoder movement.
+ */
+static void update_encoder(void)
+{
+  int32_t steps = encoder_read(&encoder, encoder_count(), (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS));
+
+  if (steps == 0)
+  {
+    return;
+  }
+
+  param_store_t *params = synth_params(0);
+  param_id_t id = control_param[last_control];
+  float unit = param_get_unit(params, id) + (float)steps * (1.0f / ENCODER_STEPS);
+
+  param_set_unit(params, id, fminf(fmaxf(unit, 0.0f), 1.0f));
+  redraw = true;
+}
+
+/**
+ * draw
+ * \brief draws the whole screen, the parameter being edited and a meter for each pot.
+ */
+static void draw(void)
+{
+  char value[] = "100%";
+  unsigned percent = (unsigned)(param_get_unit(synth_params(0), control_param[last_control]) * 100.0f + 0.5f);
+
+  /* Right aligned percentage without pulling in printf */
+  for (int i = 2; i >= 0; i--)
   {
-    USR_LED_ON();
-    vTaskDelay(pdMS_TO_TICKS(50));
-    USR_LED_OFF();
-    vTaskDelay(pdMS_TO_TICKS(950));
+    value[i] = (percent != 0 || i == 2) ? (char)('0' + percent % 10) : ' ';
+    percent /= 10;
+  }
+
+  display_clear(&display);
+  display_text(&display, &font_5x7, 0, 0, "SynthCoreF4");
+  display_fill(&display, 0, 10, DISPLAY_WIDTH, 1, true);
+  display_text(&display, &font_5x7, 0, 16, control_name[last_control]);
+  display_text(&display, &font_5x7, DISPLAY_WIDTH - 4 * 6, 16, value);
+
+  for (size_t c = 0; c < CONTROL_COUNT; c++)
+  {
+    int x = (int)c * METER_WIDTH + 2;
+    int height = (int)(atomic_load(&control_value[c]) * (DISPLAY_HEIGHT - METER_TOP - 2) + 0.5f);
+
+    display_frame(&display, x, METER_TOP, METER_WIDTH - 4, DISPLAY_HEIGHT - METER_TOP);
+    display_fill(&display, x + 1, DISPLAY_HEIGHT - 1 - height, METER_WIDTH - 6, height, true);
+  }
+}
+
+/**
+ * ui_button_changed
+ * \brief called by the panel interrupt when the debounced button changes.
+ * \param pressed true if the button is now down
+ * \note this is an interrupt handler so needs to specific handling for RTOS interrupts.
+ */
+void ui_button_changed(bool pressed)
+{
+  atomic_store(&button_pressed, pressed);
+  notify(UI_EVENT_BUTTON);
+}
+
+/**
+ * ui_controls_ready
+ * \brief called by the pot scan interrupt when a batch of scans is complete,
+ *        decimates it and wakes the task only if a pot or the encoder moved.
+ * \param scans the batch, CONTROL_COUNT readings per scan, overwritten by the DMA
+ *        once the next batch completes
+ * \param n the number of scans
+ * \note this is an interrupt handler so needs to specific handling for RTOS interrupts.
+ */
+void ui_controls_ready(const uint16_t *scans, size_t n)
+{
+  uint32_t events = 0;
+
+  /* Nothing to tell until the task exists */
+  if (ui_task_handle == NULL)
+  {
+    return;
+  }
+
+  bool priming = !controls.primed;
+  uint32_t changed = controls_process(&controls, scans, n);
+
+  if (changed != 0 || priming)
+  {
+    for (size_t c = 0; c < CONTROL_COUNT; c++)
+    {
+      atomic_store(&control_value[c], controls_value(&controls, c));
+    }
+    atomic_fetch_or(&control_changed, changed);
+    events |= UI_EVENT_CONTROLS;
+  }
+
+  uint16_t count = encoder_count();
+  if (count != encoder_last)
+  {
+    encoder_last = count;
+    events |= UI_EVENT_ENCODER;
+  }
+
+  if (events != 0)
+  {
+    notify(events);
+  }
+}
+
+/**
+ * ui_display_flushed
+ * \brief called by the display interrupt when a flush completes, the framebuffer is free.
+ * \note this is an interrupt handler so needs to specific handling for RTOS interrupts.
+ */
+void ui_display_flushed(void)
+{
+  notify(UI_EVENT_DISPLAY);
+}
+
+/**
+ * notify
+ * \brief sets event bits for the UI task from an interrupt.
+ * \param event the event bits
+ */
+static void notify(uint32_t event)
+{
+  BaseType_t higher_task_woken = pdFALSE;
+
+  /* Events can arrive before the task exists */
+  if (ui_task_handle == NULL)
+  {
+    return;
+  }
+
+  xTaskNotifyFromISR(ui_task_handle, event, eSetBits, &higher_task_woken);
+
+  if (higher_task_woken)
+  {
+    portYIELD_FROM_ISR(higher_task_woken);
   }
 }
 
@@ -41,11 +340,15 @@ static void ui_task(void *pvParameters)
  */
 bool ui_start(UBaseType_t priority)
 {
-  if (xTaskCreate(ui_task, "UI", configMINIMAL_STACK_SIZE * 4, NULL, priority, NULL) != pdPASS)
+  /* Owned by the scan interrupt from the moment the task exists */
+  controls_init(&controls, CONTROL_COUNT);
+  encoder_last = encoder_count();
+
+  ui_task_handle = xTaskCreateStatic(ui_task, "UI", UI_STACK_SIZE, NULL, priority, ui_stack, &ui_tcb);
+  if (ui_task_handle == NULL)
   {
     return false;
   }
 
   return true;
 }
-
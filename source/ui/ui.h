@@ -15,12 +15,18 @@
 #define __UI_H__
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "FreeRTOS.h"
 #include "task.h"
 #include "board.h"
 
+/* API */
 bool ui_start(UBaseType_t priority);
+void ui_button_changed(bool pressed);
+void ui_controls_ready(const uint16_t *scans, size_t n);
+void ui_display_flushed(void);
 
 
 
@@ -0,0 +1,46 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  Host stand-in for the kernel headers, the types and constants only. A test
+  that links a module calling the kernel defines the functions it uses.
+*/
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t StackType_t;
+
+typedef struct
+{
+  void *unused;
+} StaticTask_t;
+
+typedef struct
+{
+  void *unused;
+} StaticQueue_t;
+
+#define pdFALSE (0)
+#define pdTRUE (1)
+#define pdFAIL (0)
+#define pdPASS (1)
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define configMINIMAL_STACK_SIZE (128)
+#define configCPU_CLOCK_HZ (100000000UL)
+
+#endif /* INC_FREERTOS_H */
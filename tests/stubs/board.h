@@ -0,0 +1,87 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef __BOARD_H__
+#define __BOARD_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "stm32f411xe.h"
+
+/*
+  Host stand-in for the board header, the codec control bus and the LL
+  GPIO, clock and NVIC calls the drivers under test make. The functions
+  are defined by the tests that use them, the I2C peripheral is in
+  stm32f4xx_ll_i2c.h.
+*/
+
+#define FREQ (100000000)
+
+typedef enum
+{
+  SUCCESS = 0,
+  ERROR = !SUCCESS
+} ErrorStatus;
+
+typedef int IRQn_Type;
+
+/* GPIO */
+typedef struct
+{
+  uint32_t MODER;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  uint32_t Pin;
+  uint32_t Mode;
+  uint32_t Speed;
+  uint32_t OutputType;
+  uint32_t Pull;
+  uint32_t Alternate;
+} LL_GPIO_InitTypeDef;
+
+#define LL_GPIO_MODE_OUTPUT (1U)
+#define LL_GPIO_MODE_ALTERNATE (2U)
+#define LL_GPIO_SPEED_FREQ_LOW (0U)
+#define LL_GPIO_SPEED_FREQ_HIGH (2U)
+#define LL_GPIO_OUTPUT_PUSHPULL (0U)
+#define LL_GPIO_OUTPUT_OPENDRAIN (1U)
+#define LL_GPIO_PULL_NO (0U)
+#define LL_GPIO_PULL_UP (1U)
+#define LL_GPIO_AF_4 (4U)
+
+ErrorStatus LL_GPIO_Init(GPIO_TypeDef *port, LL_GPIO_InitTypeDef *init);
+void LL_GPIO_SetOutputPin(GPIO_TypeDef *port, uint32_t pins);
+void LL_APB1_GRP1_EnableClock(uint32_t peripherals);
+
+/* Interrupts, the tests run the handlers themselves */
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {}
+static inline void NVIC_EnableIRQ(IRQn_Type irq) {}
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) {}
+static inline void __disable_irq(void) {}
+
+/* Codec control, the tests' simulated bus */
+extern GPIO_TypeDef gpio_stub;
+
+#define I2C_BUS (&i2c_stub)
+#define I2C_CLOCK (1U << 21)
+#define I2C_SCL_AF (LL_GPIO_AF_4)
+#define I2C_SCL_PIN (1U << 6)
+#define I2C_SCL_PORT (&gpio_stub)
+#define I2C_SDA_AF (LL_GPIO_AF_4)
+#define I2C_SDA_PIN (1U << 9)
+#define I2C_SDA_PORT (&gpio_stub)
+#define I2C_EV_IRQN (31)
+#define I2C_EV_IRQ_HANDLER i2c_event_irq
+#define I2C_ER_IRQN (32)
+#define I2C_ER_IRQ_HANDLER i2c_error_irq
+
+#endif /* __BOARD_H__ */
@@ -0,0 +1,28 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef STM32F411XE_H
+#define STM32F411XE_H
+
+#include <stdint.h>
+
+/* Host stand-in for the device header and the CMSIS intrinsics the modules under test use */
+
+/**
+ * __SSAT
+ * \brief signed saturation to a bit width, as the Cortex-M4 SSAT instruction.
+ */
+static inline int32_t __SSAT(int32_t value, uint32_t bits)
+{
+  const int32_t max = (int32_t)((1u << (bits - 1)) - 1);
+  const int32_t min = -max - 1;
+
+  return value > max ? max : (value < min ? min : value);
+}
+
+#endif /* STM32F411XE_H */
@@ -0,0 +1,63 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef STM32F4XX_LL_I2C_H
+#define STM32F4XX_LL_I2C_H
+
+#include <stdint.h>
+
+#include "board.h"
+
+/* Host stand-in for the LL I2C driver, the test that uses it defines the functions as a simulated peripheral */
+
+typedef struct
+{
+  volatile uint32_t CR1;
+} I2C_TypeDef;
+
+#define I2C_CR1_START (1U << 8)
+#define I2C_CR1_STOP (1U << 9)
+
+typedef struct
+{
+  uint32_t PeripheralMode;
+  uint32_t ClockSpeed;
+  uint32_t DutyCycle;
+  uint32_t OwnAddress1;
+  uint32_t TypeAcknowledge;
+  uint32_t OwnAddrSize;
+} LL_I2C_InitTypeDef;
+
+#define LL_I2C_MODE_I2C (0U)
+#define LL_I2C_DUTYCYCLE_16_9 (1U << 14)
+#define LL_I2C_ACK (1U << 10)
+#define LL_I2C_OWNADDRESS1_7BIT (0U)
+
+extern I2C_TypeDef i2c_stub;
+
+ErrorStatus LL_I2C_Init(I2C_TypeDef *i2c, LL_I2C_InitTypeDef *init);
+void LL_I2C_Enable(I2C_TypeDef *i2c);
+void LL_I2C_EnableReset(I2C_TypeDef *i2c);
+void LL_I2C_DisableReset(I2C_TypeDef *i2c);
+void LL_I2C_EnableIT_EVT(I2C_TypeDef *i2c);
+void LL_I2C_DisableIT_EVT(I2C_TypeDef *i2c);
+void LL_I2C_EnableIT_ERR(I2C_TypeDef *i2c);
+void LL_I2C_GenerateStartCondition(I2C_TypeDef *i2c);
+void LL_I2C_GenerateStopCondition(I2C_TypeDef *i2c);
+void LL_I2C_TransmitData8(I2C_TypeDef *i2c, uint8_t data);
+uint32_t LL_I2C_IsActiveFlag_SB(I2C_TypeDef *i2c);
+uint32_t LL_I2C_IsActiveFlag_ADDR(I2C_TypeDef *i2c);
+uint32_t LL_I2C_IsActiveFlag_BTF(I2C_TypeDef *i2c);
+uint32_t LL_I2C_IsActiveFlag_AF(I2C_TypeDef *i2c);
+void LL_I2C_ClearFlag_ADDR(I2C_TypeDef *i2c);
+void LL_I2C_ClearFlag_AF(I2C_TypeDef *i2c);
+void LL_I2C_ClearFlag_BERR(I2C_TypeDef *i2c);
+void LL_I2C_ClearFlag_ARLO(I2C_TypeDef *i2c);
+void LL_I2C_ClearFlag_OVR(I2C_TypeDef *i2c);
+
+#endif /* STM32F4XX_LL_I2C_H */
@@ -0,0 +1,59 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*
+  Minimal host test support. A failed CHECK prints where and carries on so
+  one run reports every failure, TEST_RESULT() is the exit status for ctest.
+*/
+
+static int test_failures;
+
+#define CHECK(expr)                                                        \
+  do                                                                       \
+  {                                                                        \
+    if (!(expr))                                                           \
+    {                                                                      \
+      printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #expr);      \
+      test_failures++;                                                     \
+    }                                                                      \
+  } while (0)
+
+#define TEST_RESULT() (test_failures == 0 ? 0 : (printf("%d failures\n", test_failures), 1))
+
+/**
+ * test_seconds
+ * \brief a monotonic time for the host benchmarks.
+ * \return seconds
+ */
+static inline double test_seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * test_random
+ * \brief a repeatable pseudo random number, the tests must not depend on the host's rand().
+ * \param state the generator state
+ * \return -1 to 1
+ */
+static inline float test_random(uint32_t *state)
+{
+  *state = *state * 1664525u + 1013904223u;
+  return (float)(int32_t)*state / 2147483648.0f;
+}
+
+#endif /* TEST_H */
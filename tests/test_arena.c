@@ -0,0 +1,103 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdalign.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "test.h"
+
+/*
+  The bump allocator behind dae_alloc(). Every allocation is ARENA_ALIGN
+  aligned whatever the sizes before it, a request that does not fit returns
+  NULL and leaves the arena usable, and the peak remembers the most ever in
+  use.
+*/
+
+#define SIZE (256)
+
+static alignas(ARENA_ALIGN) uint8_t memory[SIZE];
+static arena_t arena;
+
+static void test_alignment(void)
+{
+  static const size_t sizes[] = {1, 3, 8, 13, 2, 24, 7};
+  bool aligned = true, inside = true;
+  uint8_t *last = NULL;
+
+  arena_init(&arena, memory, sizeof(memory));
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    uint8_t *p = arena_alloc(&arena, sizes[i]);
+
+    aligned = aligned && p != NULL && ((uintptr_t)p & (ARENA_ALIGN - 1)) == 0;
+    inside = inside && p >= memory && p + sizes[i] <= memory + SIZE;
+
+    /* No overlap with the previous allocation */
+    CHECK(last == NULL || p >= last + sizes[i - 1]);
+    last = p;
+  }
+
+  CHECK(aligned && inside);
+
+  /* Sizes are rounded up to the alignment, 1+3+8+13+2+24+7 bytes take 8+8+8+16+8+24+8 */
+  CHECK(arena.used == 80);
+}
+
+static void test_full(void)
+{
+  arena_init(&arena, memory, sizeof(memory));
+
+  /* Exactly full, then nothing more, not even a byte */
+  CHECK(arena_alloc(&arena, SIZE - 8) != NULL);
+  CHECK(arena_alloc(&arena, 8) != NULL);
+  CHECK(arena_alloc(&arena, 1) == NULL);
+
+  /* Too large from empty, and a size that wraps when rounded */
+  arena_init(&arena, memory, sizeof(memory));
+  CHECK(arena_alloc(&arena, SIZE + 1) == NULL);
+  CHECK(arena_alloc(&arena, SIZE_MAX - 2) == NULL);
+
+  /* A failed request takes nothing, what is left can still be had */
+  CHECK(arena_alloc(&arena, SIZE / 2) != NULL);
+  CHECK(arena_alloc(&arena, SIZE) == NULL);
+  CHECK(arena_alloc(&arena, SIZE / 2) != NULL);
+  CHECK(arena.used == SIZE);
+}
+
+static void test_peak(void)
+{
+  arena_init(&arena, memory, sizeof(memory));
+  CHECK(arena_peak(&arena) == 0);
+
+  arena_alloc(&arena, 100);
+  arena_alloc(&arena, 50);
+  CHECK(arena_peak(&arena) == 160);
+
+  /* More raises it, a failed request does not */
+  arena_alloc(&arena, 16);
+  CHECK(arena_peak(&arena) == 176);
+  CHECK(arena_alloc(&arena, 100) == NULL);
+  CHECK(arena_peak(&arena) == 176);
+  CHECK(arena_alloc(&arena, SIZE - 176) != NULL);
+  CHECK(arena_peak(&arena) == SIZE);
+
+  /* A new arena starts again */
+  arena_init(&arena, memory, sizeof(memory));
+  CHECK(arena_peak(&arena) == 0);
+}
+
+int main(void)
+{
+  test_alignment();
+  test_full();
+  test_peak();
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,194 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdint.h>
+
+#include "clock.h"
+#include "test.h"
+
+/*
+  The clock follower fed synthetic tick streams, evenly spaced ticks plus
+  random jitter of up to a UART byte time or more, the way they arrive from
+  a DAW over a USB MIDI interface. The filtered period must settle well
+  inside the jitter, follow a tempo change, ride out a wild tick and read
+  as unlocked once the ticks stop.
+*/
+
+#define SAMPLE_RATE (48000.0f)
+
+static midi_clock_t clock_follower;
+static uint32_t seed = 1u;
+
+/**
+ * period_of
+ * \brief samples per tick at a tempo.
+ */
+static double period_of(double bpm)
+{
+  return SAMPLE_RATE * 60.0 / (bpm * MIDI_CLOCK_PPQN);
+}
+
+/**
+ * send
+ * \brief feeds one tick at an exact time plus jitter.
+ */
+static void send(double time, float jitter)
+{
+  midi_event_t event = {.status = MIDI_CLOCK};
+
+  event.timestamp = (uint32_t)lround(time + test_random(&seed) * jitter);
+  midi_clock_event(&clock_follower, &event);
+}
+
+/**
+ * run
+ * \brief sends ticks at a tempo from a start time.
+ * \return the time of the next tick
+ */
+static double run(double time, double bpm, unsigned ticks, float jitter)
+{
+  for (unsigned i = 0; i < ticks; i++)
+  {
+    send(time, jitter);
+    time += period_of(bpm);
+  }
+
+  return time;
+}
+
+static void test_jitter(float jitter)
+{
+  midi_clock_state_t state;
+  double period = period_of(120.0);
+
+  /* Start at a time that wraps the sample clock part way through */
+  midi_clock_init(&clock_follower, SAMPLE_RATE);
+  double time = 4294967296.0 - 50.0 * period;
+
+  /* Locked within a beat, to a few percent */
+  time = run(time, 120.0, MIDI_CLOCK_PPQN, jitter);
+  midi_clock_read(&clock_follower, (uint32_t)(uint64_t)time, &state);
+  CHECK(fabs(state.period - period) < 0.03 * period);
+
+  /* Settled after a few bars to well inside the jitter */
+  time = run(time, 120.0, 16 * MIDI_CLOCK_PPQN, jitter);
+  midi_clock_read(&clock_follower, (uint32_t)(uint64_t)time, &state);
+  double error = fabs(state.period - period);
+  double bpm = midi_clock_bpm(&state, SAMPLE_RATE);
+  CHECK(error < 0.002 * period + 0.01 * jitter);
+  CHECK(fabs(bpm - 120.0) < 0.5);
+
+  /* The latest tick time is closer to the true grid than the raw ticks */
+  double last = time - period;
+  double offset = fabs((double)(int32_t)(state.time - (uint32_t)(uint64_t)last));
+  CHECK(offset <= 0.5 * jitter + 1.0);
+
+  printf("jitter %5.1f  period error %.3f samples  %.2f bpm  tick offset %.1f\n", jitter, error, bpm, offset);
+}
+
+static void test_tempo_change(void)
+{
+  midi_clock_state_t state;
+
+  midi_clock_init(&clock_follower, SAMPLE_RATE);
+  double time = run(1000.0, 100.0, 8 * MIDI_CLOCK_PPQN, 20.0f);
+
+  /* A 10% step is followed within two bars */
+  time = run(time, 110.0, 8 * MIDI_CLOCK_PPQN, 20.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  CHECK(fabs(midi_clock_bpm(&state, SAMPLE_RATE) - 110.0) < 1.0);
+
+  /* A jump to double tempo is re-acquired */
+  time = run(time, 220.0, 2 * MIDI_CLOCK_PPQN, 20.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  CHECK(fabs(midi_clock_bpm(&state, SAMPLE_RATE) - 220.0) < 5.0);
+}
+
+static void test_outlier(void)
+{
+  midi_clock_state_t state;
+  double period = period_of(120.0);
+
+  midi_clock_init(&clock_follower, SAMPLE_RATE);
+  double time = run(1000.0, 120.0, 8 * MIDI_CLOCK_PPQN, 10.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  float before = state.period;
+
+  /* One tick held up by most of a period does not move the tempo */
+  send(time + 0.7 * period, 0.0f);
+  time = run(time + period, 120.0, 1, 10.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  CHECK(fabsf(state.period - before) < 1.0f);
+}
+
+static void test_timeout(void)
+{
+  midi_clock_state_t state;
+  double period = period_of(120.0);
+
+  midi_clock_init(&clock_follower, SAMPLE_RATE);
+  midi_clock_read(&clock_follower, 0, &state);
+  CHECK(state.period == 0.0f);
+
+  double time = run(4294967296.0 - 10.0 * period, 120.0, 4 * MIDI_CLOCK_PPQN, 10.0f);
+  double last = time - period;
+
+  /* Still locked just inside the timeout, with no tick arriving */
+  midi_clock_read(&clock_follower, (uint32_t)(uint64_t)(last + (MIDI_CLOCK_TIMEOUT - 0.5) * period), &state);
+  CHECK(state.period > 0.0f);
+
+  /* Unlocked after it, without another tick to notice */
+  midi_clock_read(&clock_follower, (uint32_t)(uint64_t)(last + (MIDI_CLOCK_TIMEOUT + 0.5) * period), &state);
+  CHECK(state.period == 0.0f);
+  CHECK(midi_clock_bpm(&state, SAMPLE_RATE) == 0.0f);
+
+  /* Ticks starting again, at another tempo, lock again */
+  time = run(last + 100.0 * period, 90.0, 2 * MIDI_CLOCK_PPQN, 10.0f);
+  midi_clock_read(&clock_follower, (uint32_t)(uint64_t)time, &state);
+  CHECK(fabs(midi_clock_bpm(&state, SAMPLE_RATE) - 90.0) < 2.0);
+}
+
+static void test_transport(void)
+{
+  midi_clock_state_t state;
+  midi_event_t start = {.status = MIDI_START};
+  midi_event_t position = {.status = MIDI_SONG_POSITION, .data = {4, 0}};
+  double period = period_of(120.0);
+
+  midi_clock_init(&clock_follower, SAMPLE_RATE);
+  double time = run(1000.0, 120.0, 2 * MIDI_CLOCK_PPQN, 0.0f);
+
+  /* The first tick after Start is tick 0, the phase runs between ticks */
+  midi_clock_event(&clock_follower, &start);
+  time = run(time, 120.0, MIDI_CLOCK_PPQN / 2 + 1, 0.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  CHECK(state.running && state.tick == MIDI_CLOCK_PPQN / 2);
+  float phase = midi_clock_phase(&state, (uint32_t)(time - 0.5 * period), MIDI_CLOCK_PPQN);
+  CHECK(fabsf(phase - (0.5f + 0.5f / MIDI_CLOCK_PPQN)) < 0.01f);
+
+  /* Song position is in sixteenths */
+  midi_clock_event(&clock_follower, &position);
+  run(time, 120.0, 1, 0.0f);
+  midi_clock_read(&clock_follower, (uint32_t)time, &state);
+  CHECK(state.tick == 4 * MIDI_CLOCK_PPQN / 4);
+}
+
+int main(void)
+{
+  test_jitter(0.0f);
+  test_jitter(10.0f);   /* One UART byte at 31250 baud is 15 samples */
+  test_jitter(50.0f);
+  test_jitter(150.0f);
+  test_tempo_change();
+  test_outlier();
+  test_timeout();
+  test_transport();
+
+  return TEST_RESULT();
+}
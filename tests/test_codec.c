@@ -0,0 +1,459 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "codec.h"
+#include "i2c.h"
+#include "stm32f4xx_ll_i2c.h"
+#include "test.h"
+
+/*
+  The I2C engine and a codec driver on a simulated bus. The peripheral
+  below raises the event flags the F4's I2C raises for a master write
+  (SB, ADDR, BTF) and the acknowledge failure of an absent device, the
+  interrupt handlers are run until the bus goes quiet. A START or STOP
+  goes out a few bus steps after it is asked for and, as on the F4, the
+  last BTF stays set until it has. Every write that goes out is logged
+  with how it started, the tests compare the log with the register
+  sequences the codec's datasheet asks for.
+
+  Built once per I2C codec, CODEC_CS43L22 or CODEC_WM8731 chooses the
+  expected sequences.
+*/
+
+#define LOG_SIZE (256)
+
+/* A register write as it went out on the bus */
+typedef struct
+{
+  uint8_t device;
+  uint8_t reg;
+  uint8_t value;
+  bool acked;                       /* The device answered its address */
+  bool repeated;                    /* Started with a repeated start */
+} transfer_t;
+
+/* Simulated peripheral */
+I2C_TypeDef i2c_stub;
+GPIO_TypeDef gpio_stub;
+
+/* Bus steps a START or STOP takes to go out */
+#define CONDITION_STEPS (3)
+
+static enum { IDLE, ADDRESS, REG, VALUE, SENT } phase;
+static bool busy, sb, addr, btf, af, evt;
+static int condition_steps;
+static uint32_t speed;
+static uint8_t absent = 0x50;
+
+static transfer_t wire[LOG_SIZE];
+static size_t logged, stops, misuse, events;
+
+/* Completions, in order */
+static struct
+{
+  int id;
+  bool ok;
+} done_log[LOG_SIZE];
+static size_t dones;
+
+ErrorStatus LL_GPIO_Init(GPIO_TypeDef *port, LL_GPIO_InitTypeDef *init)
+{
+  return SUCCESS;
+}
+
+void LL_GPIO_SetOutputPin(GPIO_TypeDef *port, uint32_t pins) {}
+void LL_APB1_GRP1_EnableClock(uint32_t peripherals) {}
+
+ErrorStatus LL_I2C_Init(I2C_TypeDef *i2c, LL_I2C_InitTypeDef *init)
+{
+  speed = init->ClockSpeed;
+  return SUCCESS;
+}
+
+void LL_I2C_Enable(I2C_TypeDef *i2c) {}
+void LL_I2C_EnableReset(I2C_TypeDef *i2c) {}
+void LL_I2C_DisableReset(I2C_TypeDef *i2c) {}
+void LL_I2C_EnableIT_EVT(I2C_TypeDef *i2c) { evt = true; }
+void LL_I2C_DisableIT_EVT(I2C_TypeDef *i2c) { evt = false; }
+void LL_I2C_EnableIT_ERR(I2C_TypeDef *i2c) {}
+
+void LL_I2C_GenerateStartCondition(I2C_TypeDef *i2c)
+{
+  misuse += (i2c_stub.CR1 & I2C_CR1_START) != 0;
+  i2c_stub.CR1 |= I2C_CR1_START;
+  condition_steps = CONDITION_STEPS;
+}
+
+void LL_I2C_GenerateStopCondition(I2C_TypeDef *i2c)
+{
+  misuse += !busy || (i2c_stub.CR1 & I2C_CR1_STOP) != 0;
+  i2c_stub.CR1 |= I2C_CR1_STOP;
+  condition_steps = CONDITION_STEPS;
+}
+
+/**
+ * bus_step
+ * \brief one step of bus time, a requested STOP and then START go out once their time is up.
+ */
+static void bus_step(void)
+{
+  if (!(i2c_stub.CR1 & (I2C_CR1_START | I2C_CR1_STOP)) || --condition_steps > 0)
+  {
+    return;
+  }
+
+  if (i2c_stub.CR1 & I2C_CR1_STOP)
+  {
+    i2c_stub.CR1 &= ~I2C_CR1_STOP;
+    stops++;
+    busy = false;
+    phase = IDLE;
+    sb = addr = btf = false;
+    condition_steps = CONDITION_STEPS;
+    return;
+  }
+
+  i2c_stub.CR1 &= ~I2C_CR1_START;
+  if (logged == LOG_SIZE)
+  {
+    misuse++;
+    return;
+  }
+
+  wire[logged++] = (transfer_t){.repeated = busy};
+  busy = true;
+  phase = ADDRESS;
+  sb = true;
+  btf = addr = false;
+}
+
+void LL_I2C_TransmitData8(I2C_TypeDef *i2c, uint8_t data)
+{
+  transfer_t *t = &wire[logged - 1];
+
+  switch (phase)
+  {
+  case ADDRESS:
+    misuse += !sb;
+    sb = false;
+    t->device = data;
+    t->acked = data != absent;
+    addr = t->acked;
+    af = !t->acked;
+    phase = t->acked ? REG : IDLE;
+    break;
+  case REG:
+    misuse += addr;
+    t->reg = data;
+    btf = true;
+    phase = VALUE;
+    break;
+  case VALUE:
+    misuse += !btf;
+    t->value = data;
+    btf = true;
+    phase = SENT;
+    break;
+  default:
+    misuse++;
+    break;
+  }
+}
+
+uint32_t LL_I2C_IsActiveFlag_SB(I2C_TypeDef *i2c) { return sb; }
+uint32_t LL_I2C_IsActiveFlag_ADDR(I2C_TypeDef *i2c) { return addr; }
+uint32_t LL_I2C_IsActiveFlag_BTF(I2C_TypeDef *i2c) { return btf; }
+uint32_t LL_I2C_IsActiveFlag_AF(I2C_TypeDef *i2c) { return af; }
+void LL_I2C_ClearFlag_ADDR(I2C_TypeDef *i2c) { addr = false; }
+void LL_I2C_ClearFlag_AF(I2C_TypeDef *i2c) { af = false; }
+void LL_I2C_ClearFlag_BERR(I2C_TypeDef *i2c) {}
+void LL_I2C_ClearFlag_ARLO(I2C_TypeDef *i2c) {}
+void LL_I2C_ClearFlag_OVR(I2C_TypeDef *i2c) {}
+
+/* Imported functions */
+void i2c_event_irq(void);
+void i2c_error_irq(void);
+
+/**
+ * run
+ * \brief services the interrupts a step of bus time at a time until the bus is quiet.
+ */
+static void run(void)
+{
+  for (int guard = 0; guard < 10000 && (af || (evt && (sb || addr || btf)) || (i2c_stub.CR1 & (I2C_CR1_START | I2C_CR1_STOP)));
+       guard++)
+  {
+    if (af)
+    {
+      i2c_error_irq();
+    }
+    else if (evt && (sb || addr || btf))
+    {
+      i2c_event_irq();
+      events++;
+    }
+    bus_step();
+  }
+}
+
+static void reset_log(void)
+{
+  logged = stops = misuse = dones = events = 0;
+}
+
+static void done(void *context, bool ok)
+{
+  done_log[dones].id = (int)(intptr_t)context;
+  done_log[dones].ok = ok;
+  dones++;
+}
+
+/**
+ * sent
+ * \brief true if the log from a position holds exactly a device's register writes.
+ * \param at the first transfer to compare, advanced past them
+ * \param regs register and value pairs
+ * \param n the number of pairs
+ */
+static bool sent(size_t *at, uint8_t device, const uint8_t (*regs)[2], size_t n)
+{
+  bool same = *at + n <= logged;
+
+  for (size_t i = 0; same && i < n; i++)
+  {
+    const transfer_t *t = &wire[*at + i];
+    same = t->device == device && t->acked && t->reg == regs[i][0] && t->value == regs[i][1];
+  }
+  *at += n;
+
+  return same;
+}
+
+static void test_engine(void)
+{
+  static const i2c_reg_t a[] = {{0x10, 0x01}, {0x11, 0x02}};
+  static const i2c_reg_t b[] = {{0x20, 0x03}};
+
+  i2c_init(400000);
+
+  /* Groups in order, joined by repeated starts with one STOP at the end */
+  reset_log();
+  CHECK(i2c_write_regs(0x94, a, 2, done, (void *)1));
+  CHECK(i2c_write_regs(0x34, b, 1, done, (void *)2));
+  CHECK(evt && (i2c_stub.CR1 & I2C_CR1_START) && logged == 0);
+  run();
+
+  size_t at = 0;
+  CHECK(sent(&at, 0x94, (const uint8_t[][2]){{0x10, 0x01}, {0x11, 0x02}}, 2));
+  CHECK(sent(&at, 0x34, (const uint8_t[][2]){{0x20, 0x03}}, 1));
+  CHECK(logged == 3 && !wire[0].repeated && wire[1].repeated && wire[2].repeated);
+  CHECK(stops == 1 && !busy && misuse == 0);
+  CHECK(dones == 2 && done_log[0].id == 1 && done_log[0].ok && done_log[1].id == 2 && done_log[1].ok);
+
+  /* An absent device fails its group, the bus is released and the queue moves on */
+  reset_log();
+  CHECK(i2c_write_regs(0x94, b, 1, done, (void *)1));
+  CHECK(i2c_write_regs(absent, a, 2, done, (void *)2));
+  CHECK(i2c_write_regs(0x94, b, 1, done, (void *)3));
+  run();
+
+  CHECK(logged == 4 && !wire[1].acked && !wire[2].acked && wire[3].acked);
+  CHECK(!wire[2].repeated && !wire[3].repeated);
+  CHECK(stops == 3 && !busy && misuse == 0);
+  CHECK(dones == 3 && done_log[0].ok && done_log[1].id == 2 && !done_log[1].ok && done_log[2].ok);
+
+  /*
+    The value's BTF stays set until the repeated START is on the bus. The
+    engine's wait for the START cannot see the simulated bus move so it
+    times out, and the interrupt then runs with the old BTF still set: it
+    must not complete the write twice or send the next address early.
+  */
+  reset_log();
+  CHECK(i2c_write_regs(0x94, b, 1, done, (void *)1));
+  CHECK(i2c_write_regs(0x94, b, 1, done, (void *)2));
+  CHECK(i2c_write_regs(0x94, b, 1, done, (void *)3));
+  run();
+  CHECK(logged == 3 && wire[1].repeated && wire[2].repeated && stops == 1 && misuse == 0);
+  CHECK(events > 3 * 4);
+  CHECK(dones == 3 && done_log[0].id == 1 && done_log[1].id == 2 && done_log[2].id == 3);
+
+  /* The queue is consistent afterwards */
+  reset_log();
+  CHECK(i2c_write_regs(0x34, a, 2, done, (void *)4));
+  run();
+  at = 0;
+  CHECK(sent(&at, 0x34, (const uint8_t[][2]){{0x10, 0x01}, {0x11, 0x02}}, 2));
+  CHECK(logged == 2 && dones == 1 && done_log[0].id == 4 && misuse == 0 && !evt);
+
+  /* A group is queued whole or not at all */
+  static i2c_reg_t many[I2C_QUEUE_SIZE + 1];
+  for (size_t i = 0; i <= I2C_QUEUE_SIZE; i++)
+  {
+    many[i] = (i2c_reg_t){(uint8_t)i, (uint8_t)~i};
+  }
+
+  reset_log();
+  CHECK(!i2c_write_regs(0x94, many, I2C_QUEUE_SIZE + 1, done, NULL));
+  CHECK(!i2c_write_regs(0x94, many, 0, done, NULL));
+  CHECK(logged == 0);
+  CHECK(i2c_write_regs(0x94, many, I2C_QUEUE_SIZE - 1, done, (void *)1));
+  CHECK(!i2c_write_regs(0x94, many, 2, done, (void *)2));
+  CHECK(i2c_write_regs(0x94, many, 1, done, (void *)3));
+  run();
+  CHECK(logged == I2C_QUEUE_SIZE && stops == 1 && misuse == 0);
+  CHECK(dones == 2 && done_log[0].id == 1 && done_log[1].id == 3);
+}
+
+#if defined(CODEC_CS43L22)
+
+#define DEVICE (0x94)
+
+static void test_codec(void)
+{
+  size_t at;
+
+  /* Configured powered down, then 0dB */
+  reset_log();
+  CHECK(codec_init());
+  run();
+  CHECK(speed == 100000);
+  at = 0;
+  CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x02, 0x01}}, 1));
+  for (size_t i = 1; i < logged; i++)
+  {
+    CHECK(wire[i].device == DEVICE && wire[i].acked && wire[i].reg != 0x02);
+  }
+  at = logged - 2;
+  CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x20, 0x00}, {0x21, 0x00}}, 2));
+
+  /* Slave I2S, any rate from MCLK, words up to 32 bits */
+  codec_format_t format = {.rate = 48000, .bits = 24};
+  reset_log();
+  CHECK(codec_set_format(&format) && format.mclk);
+  run();
+  at = 0;
+  CHECK(logged == 1 && sent(&at, DEVICE, (const uint8_t[][2]){{0x06, 0x04}}, 1));
+
+  reset_log();
+  CHECK(!codec_set_format(&(codec_format_t){.rate = 48000, .bits = 20}));
+  CHECK(!codec_set_format(&(codec_format_t){.rate = 192000, .bits = 16}));
+  CHECK(logged == 0);
+
+  /* Master volume in half dB, both channels */
+  static const struct
+  {
+    uint8_t volume;
+    uint8_t reg;
+  } volumes[] = {{100, 0x00}, {99, 0xFF}, {1, 0x9D}, {0, 0x34}, {150, 0x00}};
+
+  for (size_t i = 0; i < sizeof(volumes) / sizeof(volumes[0]); i++)
+  {
+    reset_log();
+    CHECK(codec_set_volume(volumes[i].volume, done, (void *)7));
+    run();
+    at = 0;
+    CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x20, volumes[i].reg}, {0x21, volumes[i].reg}}, 2));
+    CHECK(dones == 1 && done_log[0].id == 7 && done_log[0].ok);
+  }
+
+  /* Headphone and speaker mutes, power */
+  reset_log();
+  CHECK(codec_set_mute(true, done, NULL) && codec_set_mute(false, done, NULL));
+  CHECK(codec_set_power(true, done, NULL) && codec_set_power(false, done, NULL));
+  run();
+  at = 0;
+  CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x0F, 0xF2}, {0x0F, 0x02}, {0x02, 0x9E}, {0x02, 0x01}}, 4));
+  CHECK(dones == 4 && stops == 1 && misuse == 0);
+}
+
+#elif defined(CODEC_WM8731)
+
+#define DEVICE (0x34)
+
+static void test_codec(void)
+{
+  size_t at;
+
+  /* Reset, outputs off, then the paths and 0dB, registers are 7 bit address and 9 bit data */
+  reset_log();
+  CHECK(codec_init());
+  run();
+  CHECK(speed == 400000);
+  at = 0;
+  CHECK(sent(&at, DEVICE,
+             (const uint8_t[][2]){{0x1E, 0x00}, {0x0C, 0x72}, {0x01, 0x17}, {0x08, 0x12}, {0x0A, 0x00}, {0x05, 0xF9}},
+             6));
+  CHECK(logged == 6 && misuse == 0);
+
+  /* Interface inactive while the format changes, word length and rate from 256fs MCLK */
+  static const struct
+  {
+    uint32_t rate;
+    uint8_t bits;
+    uint8_t interface;
+    uint8_t sampling;
+  } formats[] = {
+      {48000, 24, 0x0A, 0x00},
+      {44100, 32, 0x0E, 0x20},
+      {96000, 16, 0x02, 0x5C},
+      {88200, 24, 0x0A, 0x7C},
+  };
+
+  for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+  {
+    codec_format_t format = {.rate = formats[i].rate, .bits = formats[i].bits};
+    reset_log();
+    CHECK(codec_set_format(&format) && format.mclk);
+    run();
+    at = 0;
+    CHECK(sent(&at, DEVICE,
+               (const uint8_t[][2]){{0x12, 0x00}, {0x0E, formats[i].interface}, {0x10, formats[i].sampling}}, 3));
+  }
+
+  reset_log();
+  CHECK(!codec_set_format(&(codec_format_t){.rate = 32000, .bits = 16}));
+  CHECK(!codec_set_format(&(codec_format_t){.rate = 48000, .bits = 20}));
+  CHECK(logged == 0);
+
+  /* Headphone volume in 1dB steps, both channels with zero cross (bit 7) */
+  static const struct
+  {
+    uint8_t volume;
+    uint8_t reg;
+  } volumes[] = {{100, 0xF9}, {50, 0xE0}, {0, 0xAF}, {150, 0xF9}};
+
+  for (size_t i = 0; i < sizeof(volumes) / sizeof(volumes[0]); i++)
+  {
+    reset_log();
+    CHECK(codec_set_volume(volumes[i].volume, done, (void *)7));
+    run();
+    at = 0;
+    CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x05, volumes[i].reg}}, 1));
+    CHECK(dones == 1 && done_log[0].ok);
+  }
+
+  /* Active with the power up, inactive before the power down */
+  reset_log();
+  CHECK(codec_set_mute(true, done, NULL) && codec_set_power(true, done, NULL) && codec_set_power(false, done, NULL));
+  run();
+  at = 0;
+  CHECK(sent(&at, DEVICE, (const uint8_t[][2]){{0x0A, 0x08}, {0x12, 0x01}, {0x0C, 0x62}, {0x12, 0x00}, {0x0C, 0xFF}}, 5));
+  CHECK(dones == 3 && stops == 1 && misuse == 0);
+}
+
+#endif
+
+int main(void)
+{
+  test_engine();
+  test_codec();
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,260 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "controls.h"
+#include "test.h"
+
+/*
+  The pot pipeline against ADC traces, batches of SCAN_BATCH scans as the
+  panel DMA delivers them. The traces are generated from a model of the
+  F411 ADC on a pot: a few LSBs of noise, the odd spike from the SPI and
+  I2S clocks, and a pot resting between two codes. A pot at rest must
+  never report a move, a sweep must follow to both ends of the range.
+
+  A trace captured on a board (one scan per line, CONTROLS readings
+  separated by commas, e.g. logged over RTT) can be replayed with
+  test_controls <file>, it prints the moves reported per control.
+*/
+
+#define CONTROLS (8)
+#define SCAN_BATCH (16) /* bsp/panel.c, 8ms of scans at 2kHz */
+#define BATCH_MS (8.0f)
+
+#define NOISE_LSB (2.5f)
+#define SPIKE_LSB (40.0f)
+#define SPIKE_ODDS (500)
+
+static controls_t controls;
+static uint16_t scans[SCAN_BATCH * CONTROLS];
+static uint32_t seed = 3u;
+
+/**
+ * adc
+ * \brief one ADC reading of a pot at a position.
+ * \param position 0-1
+ * \return the 12 bit code
+ */
+static uint16_t adc(float position)
+{
+  /* Roughly gaussian noise, the sum of four uniforms */
+  float noise = 0.0f;
+  for (int i = 0; i < 4; i++)
+  {
+    noise += test_random(&seed);
+  }
+  noise *= NOISE_LSB * 0.866f;
+
+  if ((seed >> 8) % SPIKE_ODDS == 0)
+  {
+    noise += (seed & 1) ? SPIKE_LSB : -SPIKE_LSB;
+  }
+
+  float code = roundf(position * CONTROLS_FULL_SCALE + noise);
+
+  return (uint16_t)fminf(fmaxf(code, 0.0f), CONTROLS_FULL_SCALE);
+}
+
+/**
+ * batch
+ * \brief scans every control once per scan, each at its own position, and processes the batch.
+ * \return the changed bits
+ */
+static uint32_t batch(const float *positions)
+{
+  for (size_t s = 0; s < SCAN_BATCH; s++)
+  {
+    for (size_t c = 0; c < CONTROLS; c++)
+    {
+      scans[s * CONTROLS + c] = adc(positions[c]);
+    }
+  }
+
+  return controls_process(&controls, scans, SCAN_BATCH);
+}
+
+static void test_at_rest(void)
+{
+  float positions[CONTROLS];
+
+  /* Each pot between two codes, the worst case for flicker, and one at each end */
+  for (size_t c = 0; c < CONTROLS; c++)
+  {
+    positions[c] = (100.5f + 550.0f * (float)c) / CONTROLS_FULL_SCALE;
+  }
+  positions[0] = 0.0f;
+  positions[CONTROLS - 1] = 1.0f;
+
+  controls_init(&controls, CONTROLS);
+
+  /* The first batch sets the positions without reporting them */
+  CHECK(batch(positions) == 0);
+
+  /* A minute at rest reports nothing */
+  unsigned moves = 0;
+  for (int b = 0; b < (int)(60000.0f / BATCH_MS); b++)
+  {
+    moves += (unsigned)__builtin_popcount(batch(positions));
+  }
+  CHECK(moves == 0);
+
+  for (size_t c = 0; c < CONTROLS; c++)
+  {
+    CHECK(fabsf(controls_value(&controls, c) - positions[c]) < 3.0f / CONTROLS_FULL_SCALE);
+  }
+  CHECK(controls_value(&controls, 0) == 0.0f);
+  CHECK(controls_value(&controls, CONTROLS - 1) == 1.0f);
+
+  printf("at rest  %u moves in a minute\n", moves);
+}
+
+static void test_sweep(void)
+{
+  float positions[CONTROLS] = {0};
+  const int batches = (int)(2000.0f / BATCH_MS);
+
+  controls_init(&controls, CONTROLS);
+  batch(positions);
+
+  /* Two seconds end to end and back, the position follows without stepping backwards */
+  unsigned moves = 0;
+  float last = 0.0f, lag = 0.0f;
+  bool monotonic = true;
+
+  for (int b = 1; b <= batches; b++)
+  {
+    positions[3] = (float)b / (float)batches;
+    uint32_t changed = batch(positions);
+
+    CHECK((changed & ~(1u << 3)) == 0);
+    if (changed)
+    {
+      moves++;
+      monotonic = monotonic && controls_value(&controls, 3) > last;
+      last = controls_value(&controls, 3);
+    }
+    lag = fmaxf(lag, positions[3] - controls_value(&controls, 3));
+  }
+
+  /* Held at the top it reaches full scale */
+  for (int b = 0; b < 10; b++)
+  {
+    batch(positions);
+  }
+  CHECK(monotonic);
+  CHECK(controls_value(&controls, 3) == 1.0f);
+
+  /* Resolution, a move at least every few hysteresis steps, and the lag it costs */
+  CHECK(moves > CONTROLS_FULL_SCALE / (4.0f * CONTROLS_HYSTERESIS));
+  CHECK(lag < 0.03f);
+
+  for (int b = batches - 1; b >= 0; b--)
+  {
+    positions[3] = (float)b / (float)batches;
+    batch(positions);
+  }
+  for (int b = 0; b < 10; b++)
+  {
+    batch(positions);
+  }
+  CHECK(controls_value(&controls, 3) == 0.0f);
+
+  printf("sweep    %u moves  max lag %.1f%%\n", moves, lag * 100.0f);
+}
+
+static void test_step(void)
+{
+  float positions[CONTROLS] = {0};
+
+  controls_init(&controls, CONTROLS);
+  positions[5] = 0.2f;
+  batch(positions);
+
+  /* A fast move settles within a few batches */
+  positions[5] = 0.8f;
+  int settled = 0;
+  for (int b = 1; b <= 50 && settled == 0; b++)
+  {
+    batch(positions);
+    if (fabsf(controls_value(&controls, 5) - 0.8f) < 2.0f * CONTROLS_HYSTERESIS / CONTROLS_FULL_SCALE)
+    {
+      settled = b;
+    }
+  }
+  CHECK(settled > 0 && settled * BATCH_MS <= 80.0f);
+
+  printf("step     settled in %d batches, %.0f ms\n", settled, settled * BATCH_MS);
+}
+
+/**
+ * replay
+ * \brief feeds a recorded trace, prints the moves reported per control.
+ */
+static int replay(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL)
+  {
+    printf("cannot open %s\n", path);
+    return 1;
+  }
+
+  unsigned moves[CONTROLS] = {0};
+  size_t n = 0, batches = 0;
+  char line[256];
+
+  controls_init(&controls, CONTROLS);
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    char *p = line;
+    for (size_t c = 0; c < CONTROLS; c++)
+    {
+      scans[n * CONTROLS + c] = (uint16_t)strtoul(p, &p, 10);
+      p += *p == ',';
+    }
+
+    if (++n == SCAN_BATCH)
+    {
+      uint32_t changed = controls_process(&controls, scans, n);
+      for (size_t c = 0; c < CONTROLS; c++)
+      {
+        moves[c] += (changed >> c) & 1;
+      }
+      n = 0;
+      batches++;
+    }
+  }
+  fclose(file);
+
+  printf("%zu batches, %.1f s\n", batches, batches * BATCH_MS / 1000.0f);
+  for (size_t c = 0; c < CONTROLS; c++)
+  {
+    printf("control %zu  %5u moves  at %.4f\n", c, moves[c], controls_value(&controls, c));
+  }
+
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1)
+  {
+    return replay(argv[1]);
+  }
+
+  test_at_rest();
+  test_sweep();
+  test_step();
+
+  return TEST_RESULT();
+}
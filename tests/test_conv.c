@@ -0,0 +1,176 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "conv.h"
+#include "test.h"
+
+/*
+  The partitioned convolver against direct convolution in double precision,
+  for each block size and an IR that does not fill its last partition. The
+  float FFTs round differently to the direct sum so the match is to a bound
+  on the error relative to the output, not bit exact.
+*/
+
+#define IR_LENGTH (CONV_MAX_BLOCK_SIZE * 5 + 37)
+#define BLOCKS (24)
+#define UNLIMITED (0xFFFFFFFFu)
+
+static conv_t conv;
+static float ir[IR_LENGTH];
+static float input[BLOCKS * CONV_MAX_BLOCK_SIZE];
+static float output[BLOCKS * CONV_MAX_BLOCK_SIZE];
+
+/**
+ * direct
+ * \brief the reference, output sample n of input convolved with the first ir_len IR samples.
+ */
+static double direct(size_t n, size_t ir_len)
+{
+  double y = 0.0;
+
+  for (size_t k = 0; k < ir_len && k <= n; k++)
+  {
+    y += (double)ir[k] * (double)input[n - k];
+  }
+
+  return y;
+}
+
+/**
+ * max_error
+ * \brief the largest difference from direct convolution, relative to the largest output.
+ */
+static double max_error(size_t samples, size_t ir_len)
+{
+  double peak = 0.0, error = 0.0;
+
+  for (size_t n = 0; n < samples; n++)
+  {
+    double y = direct(n, ir_len);
+    peak = fmax(peak, fabs(y));
+    error = fmax(error, fabs(output[n] - y));
+  }
+
+  return error / peak;
+}
+
+static void test_block_size(size_t block)
+{
+  uint32_t seed = 99u + (uint32_t)block;
+
+  CHECK(conv_init(&conv, block));
+
+  /* An IR longer than the partitions allow is truncated to them */
+  size_t used = conv_load(&conv, ir, IR_LENGTH, UNLIMITED);
+  size_t expect = IR_LENGTH < CONV_MAX_PARTITIONS * block ? IR_LENGTH : CONV_MAX_PARTITIONS * block;
+  CHECK(used == expect);
+
+  for (size_t i = 0; i < BLOCKS * block; i++)
+  {
+    input[i] = test_random(&seed);
+  }
+
+  for (size_t b = 0; b < BLOCKS; b++)
+  {
+    conv_process(&conv, &input[b * block], &output[b * block]);
+  }
+
+  double error = max_error(BLOCKS * block, used);
+  CHECK(error < 1e-5);
+  printf("block %3zu  %2zu partitions  max error %.1e\n", block, conv.partitions, error);
+
+  /* In place gives the same result */
+  conv_reset(&conv);
+  memcpy(output, input, BLOCKS * block * sizeof(float));
+  for (size_t b = 0; b < BLOCKS; b++)
+  {
+    conv_process(&conv, &output[b * block], &output[b * block]);
+  }
+  CHECK(max_error(BLOCKS * block, used) < 1e-5);
+}
+
+static void test_budget(void)
+{
+  CHECK(conv_max_partitions(CONV_FIXED_CYCLES) == 0);
+  CHECK(conv_max_partitions(CONV_FIXED_CYCLES + 3 * CONV_PARTITION_CYCLES) == 3);
+  CHECK(conv_max_partitions(UNLIMITED) == CONV_MAX_PARTITIONS);
+  CHECK(conv_cost_cycles(3) == CONV_FIXED_CYCLES + 3 * CONV_PARTITION_CYCLES);
+
+  /* A budget for two partitions keeps the first two blocks of the IR */
+  conv_init(&conv, CONV_MAX_BLOCK_SIZE);
+  CHECK(conv_load(&conv, ir, IR_LENGTH, conv_cost_cycles(2)) == 2 * CONV_MAX_BLOCK_SIZE);
+
+  /* No budget, no IR and the output is silence */
+  CHECK(conv_load(&conv, ir, IR_LENGTH, 0) == 0);
+  float in[CONV_MAX_BLOCK_SIZE], out[CONV_MAX_BLOCK_SIZE];
+  for (size_t i = 0; i < CONV_MAX_BLOCK_SIZE; i++)
+  {
+    in[i] = 1.0f;
+  }
+  conv_process(&conv, in, out);
+  CHECK(out[0] == 0.0f && out[CONV_MAX_BLOCK_SIZE - 1] == 0.0f);
+}
+
+static void test_idle(void)
+{
+  const size_t block = CONV_MAX_BLOCK_SIZE;
+  float in[CONV_MAX_BLOCK_SIZE], out[CONV_MAX_BLOCK_SIZE];
+
+  conv_init(&conv, block);
+  conv_load(&conv, ir, 3 * block, UNLIMITED);
+  CHECK(conv_is_idle(&conv));
+
+  /* An impulse rings for the IR length, then the convolver goes idle */
+  memset(in, 0, sizeof(in));
+  in[0] = 1.0f;
+  conv_process(&conv, in, out);
+  CHECK(!conv_is_idle(&conv));
+  CHECK(fabsf(out[5] - ir[5]) < 1e-6f);
+
+  /* The tail, then idle once the input has been silent for longer than the IR */
+  in[0] = 0.0f;
+  size_t blocks = 0;
+  while (!conv_is_idle(&conv) && blocks < 10)
+  {
+    conv_process(&conv, in, out);
+    blocks++;
+    if (blocks == 2)
+    {
+      CHECK(fabsf(out[5] - ir[2 * block + 5]) < 1e-6f);
+    }
+  }
+  CHECK(blocks == 4);
+  CHECK(conv_is_idle(&conv));
+}
+
+int main(void)
+{
+  uint32_t seed = 7u;
+  for (size_t i = 0; i < IR_LENGTH; i++)
+  {
+    /* A decaying noise burst, like a cabinet or body response */
+    ir[i] = test_random(&seed) * expf(-(float)i / 200.0f);
+  }
+
+  CHECK(!conv_init(&conv, CONV_MAX_BLOCK_SIZE * 2));
+  CHECK(!conv_init(&conv, 48));
+
+  for (size_t block = FFT_MIN_SIZE / 2; block <= CONV_MAX_BLOCK_SIZE; block <<= 1)
+  {
+    test_block_size(block);
+  }
+
+  test_budget();
+  test_idle();
+
+  return TEST_RESULT();
+}
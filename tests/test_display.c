@@ -0,0 +1,212 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <string.h>
+
+#include "display.h"
+#include "test.h"
+
+/*
+  The framebuffer on the host: drawing against the font and the clipping
+  rules, the PGM dump read back pixel for pixel, and the pages reported
+  for a flush. The UI's screen is drawn and dumped to test_display.pgm
+  to be looked at.
+*/
+
+#define IMAGE "test_display.pgm"
+
+static display_t display;
+static uint8_t pgm[DISPLAY_PGM_SIZE];
+
+/**
+ * lit
+ * \brief counts the lit pixels in a rectangle.
+ */
+static int lit(int x, int y, int w, int h)
+{
+  int count = 0;
+
+  for (int row = y; row < y + h; row++)
+  {
+    for (int col = x; col < x + w; col++)
+    {
+      count += display_get(&display, col, row);
+    }
+  }
+
+  return count;
+}
+
+/**
+ * screen
+ * \brief the patch screen as the UI draws it, a title, a parameter and its bar.
+ */
+static void screen(const char *name, int percent)
+{
+  display_clear(&display);
+  display_text(&display, &font_5x7, 0, 0, "PATCH 09");
+  display_text(&display, &font_5x7, 0, 20, name);
+  display_frame(&display, 0, 40, DISPLAY_WIDTH, 10);
+  display_fill(&display, 2, 42, (DISPLAY_WIDTH - 4) * percent / 100, 6, true);
+}
+
+static void test_drawing(void)
+{
+  display_init(&display);
+
+  /* Pixels, and nothing off screen */
+  display_pixel(&display, 0, 0, true);
+  display_pixel(&display, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1, true);
+  display_pixel(&display, -1, 5, true);
+  display_pixel(&display, 5, DISPLAY_HEIGHT, true);
+  CHECK(display_get(&display, 0, 0) && display_get(&display, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1));
+  CHECK(lit(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT) == 2);
+  CHECK(!display_get(&display, -1, 5));
+
+  /* A fill across pages and off the left edge is clipped */
+  display_clear(&display);
+  display_fill(&display, -4, 5, 10, 13, true);
+  CHECK(lit(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT) == 6 * 13);
+  CHECK(lit(0, 5, 6, 13) == 6 * 13);
+
+  display_clear(&display);
+  display_frame(&display, 10, 10, 20, 8);
+  CHECK(lit(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT) == 2 * 20 + 2 * 6);
+
+  /* Text between pages matches the glyph, with a clear gap column */
+  display_clear(&display);
+  int end = display_text(&display, &font_5x7, 3, 13, "A");
+  CHECK(end == 3 + font_5x7.width + 1);
+
+  const uint8_t *glyph = &font_5x7.glyphs[('A' - font_5x7.first) * font_5x7.width];
+  bool same = true;
+  for (int c = 0; c < font_5x7.width; c++)
+  {
+    for (int r = 0; r < font_5x7.height; r++)
+    {
+      same = same && display_get(&display, 3 + c, 13 + r) == (bool)((glyph[c] >> r) & 1);
+    }
+  }
+  CHECK(same);
+  CHECK(lit(3 + font_5x7.width, 13, 1, font_5x7.height) == 0);
+
+  /* Redrawn over itself with a different character, the background is cleared */
+  display_text(&display, &font_5x7, 3, 13, "-");
+  CHECK(lit(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT) == lit(3, 13, font_5x7.width, font_5x7.height));
+}
+
+static void test_pgm(void)
+{
+  display_init(&display);
+  screen("Warm pad", 60);
+
+  CHECK(display_pgm(&display, pgm, DISPLAY_PGM_SIZE - 1) == 0);
+  CHECK(display_pgm(&display, pgm, sizeof(pgm)) == DISPLAY_PGM_SIZE);
+  CHECK(memcmp(pgm, "P5\n128 64\n255\n", 14) == 0);
+
+  /* Read back, row major from the top left */
+  bool same = true;
+  for (int y = 0; y < DISPLAY_HEIGHT; y++)
+  {
+    for (int x = 0; x < DISPLAY_WIDTH; x++)
+    {
+      same = same && pgm[14 + y * DISPLAY_WIDTH + x] == (display_get(&display, x, y) ? 255 : 0);
+    }
+  }
+  CHECK(same);
+
+  /* The bar is 60% full */
+  CHECK(lit(2, 44, DISPLAY_WIDTH - 4, 1) == (DISPLAY_WIDTH - 4) * 60 / 100);
+
+  FILE *file = fopen(IMAGE, "wb");
+  CHECK(file != NULL);
+  if (file != NULL)
+  {
+    CHECK(fwrite(pgm, 1, DISPLAY_PGM_SIZE, file) == DISPLAY_PGM_SIZE);
+    fclose(file);
+  }
+}
+
+/**
+ * fnv
+ * \brief FNV-1a of the first words of a page, a word at a time.
+ */
+static uint32_t fnv(const uint8_t *page, int words)
+{
+  uint32_t hash = 2166136261U;
+
+  for (int i = 0; i < words; i++)
+  {
+    uint32_t word;
+    memcpy(&word, &page[i * 4], sizeof(word));
+    hash = (hash ^ word) * 16777619U;
+  }
+
+  return hash;
+}
+
+static void test_dirty(void)
+{
+  display_init(&display);
+
+  /* Every page on the first flush, the panel is random at power on */
+  CHECK(display_take_dirty(&display) == 0xFF);
+  CHECK(display_take_dirty(&display) == 0);
+
+  screen("Warm pad", 60);
+  /* The title, the name and the bar */
+  CHECK(display_take_dirty(&display) == (1U << 0 | 1U << 2 | 1U << 3 | 1U << 5 | 1U << 6));
+
+  /* The same screen redrawn is not flushed again */
+  screen("Warm pad", 60);
+  CHECK(display_take_dirty(&display) == 0);
+
+  /* Only the pages of the name change */
+  screen("Warm pan", 60);
+  CHECK(display_take_dirty(&display) == (1U << 2 | 1U << 3));
+
+  /* Drawn and undone before the flush */
+  display_pixel(&display, 100, 60, true);
+  display_pixel(&display, 100, 60, false);
+  CHECK(display_take_dirty(&display) == 0);
+
+  /*
+    Two words changed so a hash of the page is unchanged, the second cancels
+    the first in the running hash. It must still be flushed.
+  */
+  uint8_t page[DISPLAY_WIDTH];
+  memcpy(page, display.page[2], sizeof(page));
+
+  uint32_t before = fnv(page, 1), first, second;
+  memcpy(&first, &page[0], 4);
+  memcpy(&second, &page[4], 4);
+  first ^= 0x00240000U;
+  memcpy(&page[0], &first, 4);
+  second ^= before ^ fnv(page, 1);
+  memcpy(&page[4], &second, 4);
+  CHECK(fnv(page, DISPLAY_WIDTH / 4) == fnv(display.page[2], DISPLAY_WIDTH / 4));
+  CHECK(memcmp(page, display.page[2], sizeof(page)) != 0);
+
+  for (int x = 0; x < 8; x++)
+  {
+    for (int y = 16; y < 24; y++)
+    {
+      display_pixel(&display, x, y, (page[x] >> (y - 16)) & 1);
+    }
+  }
+  CHECK(display_take_dirty(&display) == (1U << 2));
+}
+
+int main(void)
+{
+  test_drawing();
+  test_pgm();
+  test_dirty();
+
+  return TEST_RESULT();
+}
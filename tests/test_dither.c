@@ -0,0 +1,180 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdbool.h>
+
+#include "dither.h"
+#include "test.h"
+
+/*
+  The 16 bit output dither. TPDF noise must be triangular over +/-1 LSB and
+  white, and with it the first two moments of the total error must not
+  depend on the signal: mean 0 and variance 1/4 LSB^2 (1/12 from rounding,
+  1/6 from the dither) wherever the signal sits between two codes. Noise
+  shaping must move the error towards Nyquist, and nothing may wrap at
+  full scale.
+*/
+
+#define SAMPLES (1 << 20)
+#define BINS (20)
+#define PERIOD (1 << 16)
+
+static dither_t dither;
+static float sequence[SAMPLES];
+
+static void test_tpdf(void)
+{
+  static unsigned histogram[BINS];
+  double sum = 0.0, squares = 0.0, lag[4] = {0};
+  float history[4] = {0};
+  bool in_range = true;
+
+  dither_init(&dither, 0x5EED1234u);
+
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    float d = dither_tpdf(&dither);
+
+    in_range = in_range && d > -1.0f && d < 1.0f;
+    histogram[(int)((d + 1.0f) * BINS / 2)]++;
+    sum += d;
+    squares += (double)d * d;
+
+    for (int k = 0; k < 4; k++)
+    {
+      lag[k] += (double)d * history[k];
+    }
+    history[3] = history[2];
+    history[2] = history[1];
+    history[1] = history[0];
+    history[0] = d;
+  }
+
+  double mean = sum / SAMPLES;
+  double variance = squares / SAMPLES - mean * mean;
+
+  CHECK(in_range);
+  CHECK(fabs(mean) < 0.002);
+  CHECK(fabs(variance - 1.0 / 6.0) < 0.002);
+
+  /* Triangular, chi-squared of the bins against the area under the triangle, 19 degrees of freedom */
+  double chi2 = 0.0;
+  for (int b = 0; b < BINS; b++)
+  {
+    double lo = -1.0 + 2.0 * b / BINS, hi = lo + 2.0 / BINS;
+    double expected = SAMPLES * (hi - lo) * (1.0 - fabs((lo + hi) / 2.0));
+    chi2 += (histogram[b] - expected) * (histogram[b] - expected) / expected;
+  }
+  CHECK(chi2 < 45.0);
+
+  /* White */
+  for (int k = 0; k < 4; k++)
+  {
+    CHECK(fabs(lag[k] / SAMPLES / variance) < 0.005);
+  }
+
+  /*
+    The low 16 bits of an LCG repeat every 2^16 steps, a value taken from
+    them would repeat half the dither's power every 1.4s at 48kHz.
+  */
+  double repeat = 0.0;
+  dither_init(&dither, 0x5EED1234u);
+  for (int i = 0; i < SAMPLES; i++)
+  {
+    sequence[i] = dither_tpdf(&dither);
+  }
+  for (int i = 0; i < SAMPLES - PERIOD; i++)
+  {
+    repeat += (double)sequence[i] * sequence[i + PERIOD];
+  }
+  repeat /= (SAMPLES - PERIOD) * variance;
+  CHECK(fabs(repeat) < 0.01);
+
+  printf("tpdf     mean %+.5f  variance %.5f (1/6)  triangle chi2 %.1f  lag 2^16 correlation %+.4f\n", mean, variance,
+         chi2, repeat);
+}
+
+static void test_error_moments(void)
+{
+  /* A steady signal between codes, the error is the same wherever it sits */
+  static const float offsets[] = {0.0f, 0.125f, 0.25f, 0.5f, 0.75f};
+
+  for (size_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++)
+  {
+    float x = (1000.0f + offsets[o]) / 32767.0f;
+    double sum = 0.0, squares = 0.0;
+
+    dither_init(&dither, 7u);
+    for (int i = 0; i < SAMPLES / 4; i++)
+    {
+      double error = dither_tpdf_int16(&dither, x) - (double)x * 32767.0;
+      sum += error;
+      squares += error * error;
+    }
+
+    double mean = sum / (SAMPLES / 4);
+    double variance = squares / (SAMPLES / 4) - mean * mean;
+
+    CHECK(fabs(mean) < 0.005);
+    CHECK(fabs(variance - 0.25) < 0.005);
+    printf("offset %.3f LSB  error mean %+.4f  variance %.4f (1/4)\n", (double)offsets[o], mean, variance);
+  }
+}
+
+static void test_shaped(void)
+{
+  double lag1 = 0.0, squares = 0.0, last = 0.0, sum = 0.0;
+  uint32_t seed = 11u;
+
+  dither_init(&dither, 3u);
+
+  for (int i = 0; i < SAMPLES / 4; i++)
+  {
+    float x = 0.3f * sinf((float)i * 0.01f) + 0.001f * test_random(&seed);
+    double error = dither_shaped_int16(&dither, x, 0) - (double)x * 32767.0;
+
+    sum += error;
+    squares += error * error;
+    lag1 += error * last;
+    last = error;
+  }
+
+  /* 1 - z^-1 shaping, adjacent errors strongly anticorrelated */
+  double mean = sum / (SAMPLES / 4);
+  double r1 = lag1 / squares;
+  CHECK(fabs(mean) < 0.01);
+  CHECK(r1 < -0.3);
+
+  printf("shaped   error mean %+.4f  lag 1 correlation %+.3f\n", mean, r1);
+}
+
+static void test_full_scale(void)
+{
+  CHECK(dither_round(40000.0f) == 32767 && dither_round(-40000.0f) == -32768);
+  CHECK(dither_round(0.5f) == 1 && dither_round(-0.5f) == 0 && dither_round(-0.51f) == -1);
+
+  bool clipped = true;
+  dither_init(&dither, 5u);
+  for (int i = 0; i < 10000; i++)
+  {
+    clipped = clipped && dither_tpdf_int16(&dither, 1.0f) >= 32766 && dither_tpdf_int16(&dither, -1.0f) <= -32766;
+    clipped = clipped && dither_shaped_int16(&dither, 1.5f, 0) == 32767 && dither_shaped_int16(&dither, -1.5f, 1) == -32768;
+  }
+  CHECK(clipped);
+}
+
+int main(void)
+{
+  test_tpdf();
+  test_error_moments();
+  test_shaped();
+  test_full_scale();
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,193 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+
+#include "encoder.h"
+#include "test.h"
+
+/*
+  Encoder steps from hardware count sequences as the timer produces them,
+  read every 8ms as the UI does on each scan batch. Covers the 16 bit wrap
+  in both directions, part detents and contact bounce, and the gain at
+  turning speeds from fine adjustment to a fast spin.
+*/
+
+#define READ_MS (8)
+
+static encoder_t encoder;
+
+/**
+ * turn
+ * \brief turns the shaft at a steady speed, reading it as the UI does.
+ * \param count the hardware count, advanced by the turn
+ * \param now the time in ms, advanced by the turn
+ * \param detents the detents to turn, negative anticlockwise
+ * \param per_second the speed
+ * \return the steps read
+ */
+static int32_t turn(uint16_t *count, uint32_t *now, int detents, float per_second)
+{
+  int direction = detents < 0 ? -1 : 1;
+  int total = detents * direction * ENCODER_COUNTS_PER_DETENT;
+  uint16_t start = *count;
+  int32_t steps = 0;
+  float edges = 0.0f;
+
+  while (edges < (float)total)
+  {
+    *now += READ_MS;
+    edges = fminf(edges + per_second * READ_MS / 1000.0f * ENCODER_COUNTS_PER_DETENT, (float)total);
+
+    /* The timer has counted the whole edges passed so far */
+    *count = (uint16_t)(start + direction * (int)edges);
+    steps += encoder_read(&encoder, *count, *now);
+  }
+
+  /* Rest a while so the next turn starts slow */
+  *now += 1000;
+  steps += encoder_read(&encoder, *count, *now);
+
+  return steps;
+}
+
+static void test_slow(void)
+{
+  uint16_t count = 100;
+  uint32_t now = 0;
+
+  /* Fine adjustment, one step a detent, either way */
+  encoder_init(&encoder, count);
+  CHECK(turn(&count, &now, 20, 2.0f) == 20);
+  CHECK(turn(&count, &now, -20, 2.0f) == -20);
+  CHECK(turn(&count, &now, 1, 1.0f) == 1);
+  CHECK(encoder_read(&encoder, count, now + 100) == 0);
+}
+
+static void test_wrap(void)
+{
+  uint32_t now = 0;
+
+  /* Across the top of the 16 bit count and back, a detent at a time */
+  uint16_t count = 65535 - 9;
+  encoder_init(&encoder, count);
+
+  int32_t steps = 0;
+  for (int i = 0; i < 6; i++)
+  {
+    count = (uint16_t)(count + ENCODER_COUNTS_PER_DETENT);
+    now += 500;
+    steps += encoder_read(&encoder, count, now);
+  }
+  CHECK(count < 100 && steps == 6);
+
+  for (int i = 0; i < 6; i++)
+  {
+    count = (uint16_t)(count - ENCODER_COUNTS_PER_DETENT);
+    now += 500;
+    steps += encoder_read(&encoder, count, now);
+  }
+  CHECK(count == 65535 - 9 && steps == 0);
+
+  /* Several detents in one read across the wrap */
+  now += 500;
+  CHECK(encoder_read(&encoder, (uint16_t)(count + 3 * ENCODER_COUNTS_PER_DETENT), now + 300) == 3);
+
+  /* Time wraps too */
+  encoder_init(&encoder, 0);
+  now = 0xFFFFFFFFU - 4;
+  CHECK(encoder_read(&encoder, ENCODER_COUNTS_PER_DETENT, now) == 1);
+  CHECK(encoder_read(&encoder, 2 * ENCODER_COUNTS_PER_DETENT, now + 400) == 1);
+}
+
+static void test_part_detents(void)
+{
+  uint16_t count = 0;
+  uint32_t now = 0;
+  int32_t steps = 0;
+
+  encoder_init(&encoder, count);
+
+  /* An edge at a time, a step on each fourth */
+  for (int i = 1; i <= 4 * ENCODER_COUNTS_PER_DETENT; i++)
+  {
+    count++;
+    now += 100;
+    int32_t step = encoder_read(&encoder, count, now);
+    CHECK(step == (i % ENCODER_COUNTS_PER_DETENT == 0 ? 1 : 0));
+    steps += step;
+  }
+  CHECK(steps == 4);
+
+  /* Contact bounce between detents goes nowhere */
+  for (int i = 0; i < 100; i++)
+  {
+    count = (uint16_t)(count + ((i & 1) ? -1 : 1));
+    now += 1;
+    CHECK(encoder_read(&encoder, count, now) == 0);
+  }
+
+  /* Half a detent forward and back again leaves no residue */
+  count = (uint16_t)(count + 2);
+  CHECK(encoder_read(&encoder, count, now += 100) == 0);
+  count = (uint16_t)(count - 2);
+  CHECK(encoder_read(&encoder, count, now += 100) == 0);
+  count = (uint16_t)(count + ENCODER_COUNTS_PER_DETENT - 1);
+  CHECK(encoder_read(&encoder, count, now += 100) == 0);
+}
+
+static void test_acceleration(void)
+{
+  static const float speeds[] = {2.0f, 5.0f, 10.0f, 15.0f, 20.0f, 40.0f, 100.0f};
+  const int detents = 60;
+  int32_t last = 0;
+
+  printf("detents/s  steps for %d detents\n", detents);
+
+  for (size_t i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+  {
+    uint16_t count = 65000;
+    uint32_t now = 0;
+
+    encoder_init(&encoder, count);
+    int32_t steps = turn(&count, &now, detents, speeds[i]);
+
+    /* Faster turns more, never more than the largest gain, and the same either way */
+    CHECK(steps >= last);
+    CHECK(steps >= detents && steps <= (int32_t)(detents * ENCODER_ACCEL_MAX));
+    CHECK(turn(&count, &now, -detents, speeds[i]) == -steps);
+    last = steps;
+
+    printf("%9.0f  %5d\n", (double)speeds[i], (int)steps);
+  }
+
+  /* A fast spin reaches the cap after its first detent, which has no speed yet */
+  CHECK(last == (int32_t)((detents - 1) * ENCODER_ACCEL_MAX) + 1);
+
+  /* Reversing in the middle of a fast spin starts again at one step */
+  uint16_t count = 0;
+  uint32_t now = 0;
+  encoder_init(&encoder, count);
+  for (int i = 0; i < 10; i++)
+  {
+    count = (uint16_t)(count + 2 * ENCODER_COUNTS_PER_DETENT);
+    encoder_read(&encoder, count, now += READ_MS);
+  }
+  count = (uint16_t)(count - ENCODER_COUNTS_PER_DETENT);
+  CHECK(encoder_read(&encoder, count, now += READ_MS) == -1);
+}
+
+int main(void)
+{
+  test_slow();
+  test_wrap();
+  test_part_detents();
+  test_acceleration();
+
+  return TEST_RESULT();
+}
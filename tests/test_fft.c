@@ -0,0 +1,179 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <math.h>
+#include <stdint.h>
+
+#include "fft.h"
+#include "test.h"
+
+/*
+  Every size against a double precision DFT, the float and Q15 forward
+  transforms and both round trips, then a host timing of each transform.
+  The target cycle counts come from fft_benchmark().
+*/
+
+static float input[FFT_MAX_SIZE];
+static float buf[FFT_MAX_SIZE];
+static int16_t buf_q15[FFT_MAX_SIZE];
+static double ref_re[FFT_MAX_SIZE / 2 + 1];
+static double ref_im[FFT_MAX_SIZE / 2 + 1];
+
+/**
+ * dft
+ * \brief the reference transform, bins 0 to n/2 of a real sequence.
+ */
+static void dft(const float *x, size_t n)
+{
+  for (size_t k = 0; k <= n / 2; k++)
+  {
+    double re = 0.0, im = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+      double a = -2.0 * M_PI * (double)((k * i) % n) / (double)n;
+      re += x[i] * cos(a);
+      im += x[i] * sin(a);
+    }
+    ref_re[k] = re;
+    ref_im[k] = im;
+  }
+}
+
+/**
+ * bin
+ * \brief reads bin k from the packed spectrum layout of fft.h.
+ */
+static void bin(const float *spectrum, size_t n, size_t k, double *re, double *im)
+{
+  if (k == 0 || k == n / 2)
+  {
+    *re = spectrum[k == 0 ? 0 : 1];
+    *im = 0.0;
+  }
+  else
+  {
+    *re = spectrum[2 * k];
+    *im = spectrum[2 * k + 1];
+  }
+}
+
+static void test_size(size_t n)
+{
+  fft_t fft;
+  uint32_t seed = 12345u + (uint32_t)n;
+
+  CHECK(fft_init(&fft, n));
+
+  for (size_t i = 0; i < n; i++)
+  {
+    input[i] = 0.5f * test_random(&seed);
+  }
+  dft(input, n);
+
+  /* Float forward, relative to the largest bin */
+  for (size_t i = 0; i < n; i++)
+  {
+    buf[i] = input[i];
+  }
+  fft_forward(&fft, buf);
+
+  double peak = 0.0, error = 0.0;
+  for (size_t k = 0; k <= n / 2; k++)
+  {
+    double re, im;
+    bin(buf, n, k, &re, &im);
+    peak = fmax(peak, hypot(ref_re[k], ref_im[k]));
+    error = fmax(error, hypot(re - ref_re[k], im - ref_im[k]));
+  }
+  CHECK(error / peak < 1e-6);
+
+  /* Float round trip */
+  fft_inverse(&fft, buf);
+  double round_trip = 0.0;
+  for (size_t i = 0; i < n; i++)
+  {
+    round_trip = fmax(round_trip, fabs(buf[i] - input[i]));
+  }
+  CHECK(round_trip < 1e-6);
+
+  /* Q15 forward is scaled by 1/N, a few LSBs per bin */
+  for (size_t i = 0; i < n; i++)
+  {
+    buf_q15[i] = (int16_t)lrintf(input[i] * 32767.0f);
+  }
+  fft_forward_q15(&fft, buf_q15);
+
+  double error_q15 = 0.0;
+  for (size_t k = 1; k < n / 2; k++)
+  {
+    double re = ref_re[k] * 32767.0 / (double)n;
+    double im = ref_im[k] * 32767.0 / (double)n;
+    error_q15 = fmax(error_q15, hypot(buf_q15[2 * k] - re, buf_q15[2 * k + 1] - im));
+  }
+  CHECK(error_q15 < 4.0);
+
+  /* Q15 round trip, the quantisation grows with N (see fft.h) */
+  fft_inverse_q15(&fft, buf_q15);
+  double signal = 0.0, noise = 0.0;
+  for (size_t i = 0; i < n; i++)
+  {
+    double x = input[i] * 32767.0;
+    signal += x * x;
+    noise += (buf_q15[i] - x) * (buf_q15[i] - x);
+  }
+  double snr = 10.0 * log10(signal / fmax(noise, 1e-9));
+  CHECK(snr > 40.0);
+
+  printf("%5zu  float err %.1e  round trip %.1e  q15 err %4.1f LSB  q15 round trip %5.1f dB\n", n, error / peak,
+         round_trip, error_q15, snr);
+}
+
+static void benchmark(size_t n)
+{
+  fft_t fft;
+  fft_init(&fft, n);
+
+  int runs = (int)(200000 / n);
+  double start = test_seconds();
+  for (int r = 0; r < runs; r++)
+  {
+    fft_forward(&fft, buf);
+    fft_inverse(&fft, buf);
+  }
+  double float_us = (test_seconds() - start) * 1e6 / runs;
+
+  start = test_seconds();
+  for (int r = 0; r < runs; r++)
+  {
+    fft_forward_q15(&fft, buf_q15);
+    fft_inverse_q15(&fft, buf_q15);
+  }
+  double q15_us = (test_seconds() - start) * 1e6 / runs;
+
+  printf("%5zu  float %7.2f us  q15 %7.2f us  (forward + inverse, host)\n", n, float_us, q15_us);
+}
+
+int main(void)
+{
+  fft_t fft;
+  CHECK(!fft_init(&fft, FFT_MIN_SIZE / 2));
+  CHECK(!fft_init(&fft, FFT_MAX_SIZE * 2));
+  CHECK(!fft_init(&fft, 96));
+
+  for (size_t n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1)
+  {
+    test_size(n);
+  }
+
+  for (size_t n = FFT_MIN_SIZE; n <= FFT_MAX_SIZE; n <<= 1)
+  {
+    benchmark(n);
+  }
+
+  return TEST_RESULT();
+}
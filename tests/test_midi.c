@@ -0,0 +1,251 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "midi.h"
+#include "test.h"
+
+/*
+  The parser against hand built byte streams for each case midi.h lists,
+  then random streams, which must only ever produce well formed events.
+  The queue is checked for order, full and empty.
+*/
+
+#define MAX_EVENTS (64)
+#define FUZZ_BYTES (1000000)
+
+static midi_parser_t parser;
+static midi_event_t events[MAX_EVENTS];
+
+/**
+ * feed
+ * \brief parses a byte sequence from a freshly reset parser.
+ * \return the number of events, stored in events[]
+ */
+static size_t feed(const uint8_t *bytes, size_t length)
+{
+  size_t count = 0;
+
+  midi_parser_init(&parser);
+  for (size_t i = 0; i < length; i++)
+  {
+    midi_event_t event;
+    if (midi_parse(&parser, bytes[i], &event) && count < MAX_EVENTS)
+    {
+      events[count++] = event;
+    }
+  }
+
+  return count;
+}
+
+static bool is_event(size_t index, uint8_t status, uint8_t data0, uint8_t data1)
+{
+  return events[index].status == status && events[index].data[0] == data0 && events[index].data[1] == data1;
+}
+
+static void test_running_status(void)
+{
+  /* Note on, then two more under running status, then a note off */
+  const uint8_t bytes[] = {0x93, 60, 100, 64, 90, 67, 0, 0x83, 60, 0};
+  CHECK(feed(bytes, sizeof(bytes)) == 4);
+  CHECK(is_event(0, 0x93, 60, 100));
+  CHECK(is_event(1, 0x93, 64, 90));
+  CHECK(is_event(2, 0x93, 67, 0));
+  CHECK(is_event(3, 0x83, 60, 0));
+  CHECK(midi_type(&events[0]) == MIDI_NOTE_ON && midi_channel(&events[0]) == 3);
+
+  /* One data byte messages */
+  const uint8_t program[] = {0xC5, 7, 8, 0xD1, 50};
+  CHECK(feed(program, sizeof(program)) == 3);
+  CHECK(is_event(0, 0xC5, 7, 0));
+  CHECK(is_event(1, 0xC5, 8, 0));
+  CHECK(is_event(2, 0xD1, 50, 0));
+
+  /* Data with no status, as when joining a stream part way through, is dropped */
+  const uint8_t joined[] = {100, 64, 90, 0xB0, 7, 127};
+  CHECK(feed(joined, sizeof(joined)) == 1);
+  CHECK(is_event(0, 0xB0, 7, 127));
+}
+
+static void test_realtime(void)
+{
+  /* Clocks inside a note on are emitted at once and the note still completes */
+  const uint8_t bytes[] = {0x90, MIDI_CLOCK, 60, MIDI_ACTIVE_SENSING, 100, MIDI_CLOCK, 62, 101};
+  CHECK(feed(bytes, sizeof(bytes)) == 5);
+  CHECK(is_event(0, MIDI_CLOCK, 0, 0));
+  CHECK(is_event(1, MIDI_ACTIVE_SENSING, 0, 0));
+  CHECK(is_event(2, 0x90, 60, 100));
+  CHECK(is_event(3, MIDI_CLOCK, 0, 0));
+  CHECK(is_event(4, 0x90, 62, 101));
+
+  /* And inside a SysEx, which carries on afterwards */
+  const uint8_t sysex[] = {MIDI_SYSEX, 0x7D, MIDI_CLOCK, 0x01, MIDI_SYSEX_END};
+  CHECK(feed(sysex, sizeof(sysex)) == 4);
+  CHECK(is_event(0, MIDI_SYSEX, 0x7D, 0));
+  CHECK(is_event(1, MIDI_CLOCK, 0, 0));
+  CHECK(is_event(2, MIDI_SYSEX, 0x01, 0));
+  CHECK(is_event(3, MIDI_SYSEX_END, 0, 0));
+}
+
+static void test_system_common(void)
+{
+  /* A song position cancels running status, the data after it is dropped */
+  const uint8_t bytes[] = {0x90, 60, 100, MIDI_SONG_POSITION, 0x10, 0x20, 61, 100};
+  CHECK(feed(bytes, sizeof(bytes)) == 2);
+  CHECK(is_event(0, 0x90, 60, 100));
+  CHECK(is_event(1, MIDI_SONG_POSITION, 0x10, 0x20));
+
+  const uint8_t select[] = {MIDI_SONG_SELECT, 5, MIDI_TIME_CODE, 0x31, MIDI_TUNE_REQUEST};
+  CHECK(feed(select, sizeof(select)) == 3);
+  CHECK(is_event(0, MIDI_SONG_SELECT, 5, 0));
+  CHECK(is_event(1, MIDI_TIME_CODE, 0x31, 0));
+  CHECK(is_event(2, MIDI_TUNE_REQUEST, 0, 0));
+
+  /* Undefined system common bytes cancel running status and emit nothing */
+  const uint8_t undefined[] = {0x90, 60, 100, 0xF4, 61, 100};
+  CHECK(feed(undefined, sizeof(undefined)) == 1);
+}
+
+static void test_sysex(void)
+{
+  /* Each data byte is streamed, the end is an event of its own */
+  const uint8_t bytes[] = {MIDI_SYSEX, 0x7D, 0x01, 0x02, MIDI_SYSEX_END, 0x05};
+  CHECK(feed(bytes, sizeof(bytes)) == 4);
+  CHECK(is_event(0, MIDI_SYSEX, 0x7D, 0));
+  CHECK(is_event(2, MIDI_SYSEX, 0x02, 0));
+  CHECK(is_event(3, MIDI_SYSEX_END, 0, 0));
+
+  /* A status byte ends it too, and starts its own message */
+  const uint8_t cut[] = {MIDI_SYSEX, 0x7D, 0x91, 60, 100};
+  CHECK(feed(cut, sizeof(cut)) == 3);
+  CHECK(is_event(1, MIDI_SYSEX_END, 0, 0));
+  CHECK(is_event(2, 0x91, 60, 100));
+
+  /* A tune request that ends a SysEx is dropped, there is one event per byte */
+  const uint8_t tune[] = {MIDI_SYSEX, 0x7D, MIDI_TUNE_REQUEST, MIDI_TUNE_REQUEST};
+  CHECK(feed(tune, sizeof(tune)) == 3);
+  CHECK(is_event(1, MIDI_SYSEX_END, 0, 0));
+  CHECK(is_event(2, MIDI_TUNE_REQUEST, 0, 0));
+}
+
+static void test_fuzz(void)
+{
+  uint32_t seed = 12345u;
+  midi_event_t event;
+  unsigned emitted = 0;
+  bool in_sysex = false;
+
+  midi_parser_init(&parser);
+  for (unsigned i = 0; i < FUZZ_BYTES; i++)
+  {
+    /* Mostly data bytes so messages complete, with status bytes mixed in */
+    test_random(&seed);
+    uint8_t byte = (uint8_t)(seed >> 24);
+    if ((seed & 0x300u) != 0)
+    {
+      byte &= 0x7F;
+    }
+
+    /* A model of the SysEx state, any status byte but realtime ends one */
+    bool ends_sysex = in_sysex && byte >= 0x80 && byte < MIDI_CLOCK;
+    if (byte >= 0x80 && byte < MIDI_CLOCK)
+    {
+      in_sysex = (byte == MIDI_SYSEX);
+    }
+
+    memset(&event, 0xAA, sizeof(event));
+    if (!midi_parse(&parser, byte, &event))
+    {
+      CHECK(!ends_sysex);
+      CHECK(parser.count < 2 && parser.count <= parser.expected);
+      continue;
+    }
+    emitted++;
+
+    /* Every event has a status byte, data bytes are 7 bit */
+    CHECK(event.status >= 0x80);
+    CHECK(event.data[0] < 0x80 && event.data[1] < 0x80);
+
+    if (byte >= MIDI_CLOCK)
+    {
+      /* Realtime events are the byte itself */
+      CHECK(event.status == byte);
+    }
+    else if (ends_sysex)
+    {
+      CHECK(event.status == MIDI_SYSEX_END);
+    }
+    else if (event.status == MIDI_SYSEX)
+    {
+      CHECK(in_sysex && event.data[0] == byte);
+    }
+    else
+    {
+      /* A completed message ends with the byte just received */
+      CHECK(!in_sysex);
+      CHECK(byte < 0x80 || byte == MIDI_TUNE_REQUEST);
+      CHECK(event.status != MIDI_SYSEX_END && event.status < MIDI_CLOCK);
+    }
+  }
+
+  printf("fuzz  %u bytes  %u events\n", FUZZ_BYTES, emitted);
+  CHECK(emitted > FUZZ_BYTES / 4);
+}
+
+static void test_queue(void)
+{
+  static midi_queue_t queue;
+  midi_event_t event = {0};
+
+  midi_queue_init(&queue);
+  CHECK(!midi_queue_pop(&queue, &event));
+
+  /* Fills to exactly its size, the next push is dropped */
+  for (uint32_t i = 0; i < MIDI_QUEUE_SIZE; i++)
+  {
+    event.timestamp = i;
+    CHECK(midi_queue_push(&queue, &event));
+  }
+  event.timestamp = 999;
+  CHECK(!midi_queue_push(&queue, &event));
+
+  /* Comes out in order, across the wrap of the ring and the indices */
+  uint32_t next = 0, pushed = MIDI_QUEUE_SIZE;
+  for (unsigned round = 0; round < 70000; round++)
+  {
+    CHECK(midi_queue_pop(&queue, &event));
+    CHECK(event.timestamp == next);
+    next++;
+
+    event.timestamp = pushed++;
+    CHECK(midi_queue_push(&queue, &event));
+  }
+
+  while (midi_queue_pop(&queue, &event))
+  {
+    CHECK(event.timestamp == next);
+    next++;
+  }
+  CHECK(next == pushed);
+}
+
+int main(void)
+{
+  test_running_status();
+  test_realtime();
+  test_system_common();
+  test_sysex();
+  test_fuzz();
+  test_queue();
+
+  return TEST_RESULT();
+}
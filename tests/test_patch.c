@@ -0,0 +1,472 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "test.h"
+
+/* The log's private functions are driven directly, the task and queue are not needed */
+#include "patch.c"
+
+/*
+  The patch store on a simulated flash, a file mapped read-only at the
+  address the linker gives the PATCHES region, so records are read in place
+  as on the target. Programming only clears bits and every word must be
+  erased before it is programmed, erasing sets a whole sector to ones. Each
+  power cycle unmaps the file and maps it again.
+
+  The link shrinks the region to two 8K sectors so compactions come every
+  few dozen saves. Random saves run with the power cut at random points,
+  part way through a word program or a sector erase, and after every cut
+  each slot must read back its last completed save, or the save that was
+  in progress.
+*/
+
+#define FLASH_BASE (0x08040000UL) /* __patches_start__, see CMakeLists.txt */
+#define FLASH_SIZE (16 * 1024)    /* __patches_end__ - __patches_start__ */
+#define IMAGE "test_patch.bin"
+
+#define SAVES (20000)
+#define MAX_OPERATIONS_BETWEEN_CUTS (2000)
+
+static int image_fd = -1;
+static uint32_t *image;
+static uint32_t seed = 1u;
+
+/* Flash operations until the power is cut, -1 for never */
+static long budget = -1;
+static jmp_buf power_cut;
+static unsigned cuts, erases;
+
+/* Erases of each sector, the interrupted ones too */
+static unsigned sector_erases[2];
+
+/* The output never goes silent, the DAE refuses the erase window */
+static bool never_silent;
+
+/* Stamp of the last completed save in each slot, 0 if none */
+static uint32_t committed[PATCH_SLOTS];
+
+/**
+ * random_below
+ * \brief a repeatable random number from 0 to limit - 1.
+ */
+static uint32_t random_below(uint32_t limit)
+{
+  test_random(&seed);
+  return (seed >> 8) % limit;
+}
+
+/**
+ * writable
+ * \brief opens the mapping for the simulated controller, the store itself only reads.
+ */
+static void writable(bool enable)
+{
+  mprotect(image, FLASH_SIZE, enable ? PROT_READ | PROT_WRITE : PROT_READ);
+}
+
+/**
+ * power_on
+ * \brief maps the flash image, creating it blank (all ones) or filled with a word.
+ */
+static void power_on(bool create, uint32_t fill)
+{
+  image_fd = open(IMAGE, create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+  CHECK(image_fd >= 0);
+
+  if (create)
+  {
+    static uint32_t words[FLASH_SIZE / sizeof(uint32_t)];
+    for (size_t i = 0; i < FLASH_SIZE / sizeof(uint32_t); i++)
+    {
+      words[i] = fill;
+    }
+    CHECK(write(image_fd, words, sizeof(words)) == (ssize_t)sizeof(words));
+  }
+
+  image = mmap((void *)FLASH_BASE, FLASH_SIZE, PROT_READ, MAP_SHARED | MAP_FIXED_NOREPLACE, image_fd, 0);
+  CHECK(image == (uint32_t *)FLASH_BASE);
+
+  /* RAM does not survive */
+  memset(&store, 0, sizeof(store));
+  for (int slot = 0; slot < PATCH_SLOTS; slot++)
+  {
+    atomic_store(&slots[slot], NULL);
+  }
+}
+
+static void power_off(void)
+{
+  munmap(image, FLASH_SIZE);
+  close(image_fd);
+}
+
+/* Simulated flash controller, replacing bsp/flash.c and the DAE's erase window */
+
+bool flash_program(uint32_t address, const uint32_t *data, size_t words)
+{
+  CHECK(address % sizeof(uint32_t) == 0);
+  CHECK(address >= FLASH_BASE && address + words * sizeof(uint32_t) <= FLASH_BASE + FLASH_SIZE);
+
+  writable(true);
+  for (size_t i = 0; i < words; i++)
+  {
+    uint32_t *word = &image[(address - FLASH_BASE) / sizeof(uint32_t) + i];
+
+    /* Written once per erase */
+    CHECK(*word == ERASED);
+
+    if (budget == 0)
+    {
+      /* Cut part way through, some of the bits to clear still set */
+      test_random(&seed);
+      *word &= data[i] | seed;
+      writable(false);
+      longjmp(power_cut, 1);
+    }
+
+    budget -= budget > 0;
+    *word &= data[i];
+  }
+  writable(false);
+
+  return true;
+}
+
+bool dae_flash_erase(uint32_t address)
+{
+  uintptr_t size = sector_size();
+
+  CHECK(address >= FLASH_BASE && address < FLASH_BASE + FLASH_SIZE);
+  if (never_silent)
+  {
+    return false;
+  }
+
+  uint32_t *sector = &image[(address - FLASH_BASE) / size * size / sizeof(uint32_t)];
+
+  sector_erases[(address - FLASH_BASE) / size]++;
+  writable(true);
+  if (budget == 0)
+  {
+    /* Cut part way through, a random scattering of words is erased */
+    for (size_t i = 0; i < size / sizeof(uint32_t); i++)
+    {
+      if (random_below(2))
+      {
+        sector[i] = ERASED;
+      }
+    }
+    writable(false);
+    longjmp(power_cut, 1);
+  }
+
+  budget -= budget > 0;
+  memset(sector, 0xFF, size);
+  writable(false);
+  erases++;
+
+  return true;
+}
+
+bool dae_is_silent(void)
+{
+  return true;
+}
+
+/**
+ * request
+ * \brief a save whose every value and name derive from a stamp.
+ */
+static void request(save_request_t *save, uint8_t slot, uint32_t stamp)
+{
+  memset(save, 0, sizeof(*save));
+  save->slot = slot;
+  snprintf(save->name, PATCH_NAME_LENGTH, "P%u", (unsigned)stamp);
+
+  for (int id = 0; id < PARAM_COUNT; id++)
+  {
+    save->value[id] = (uint16_t)(stamp * (2u * (uint32_t)id + 1u) >> (id & 7));
+  }
+}
+
+/**
+ * holds
+ * \brief true if a slot reads back the save with a stamp, or is empty for stamp 0.
+ */
+static bool holds(uint8_t slot, uint32_t stamp)
+{
+  const patch_t *patch = patch_find(slot);
+  save_request_t expect;
+
+  if (stamp == 0 || patch == NULL)
+  {
+    return stamp == 0 && patch == NULL;
+  }
+
+  request(&expect, slot, stamp);
+
+  return patch->slot == slot && patch->count == PARAM_COUNT &&
+         memcmp(patch->name, expect.name, PATCH_NAME_LENGTH) == 0 &&
+         memcmp(patch->value, expect.value, sizeof(expect.value)) == 0;
+}
+
+static void test_format(void)
+{
+  /* A blank part formats without an erase */
+  power_on(true, ERASED);
+  erases = 0;
+  CHECK(mount());
+  CHECK(erases == 0);
+  CHECK(store.active == sector(0) && store.active->generation == 1);
+  CHECK(RECORD_WORDS_MAX * sizeof(uint32_t) == 56);
+  power_off();
+
+  /* Anything unreadable is erased and formatted */
+  power_on(true, 0x12345678u);
+  erases = 0;
+  CHECK(mount());
+  CHECK(erases == 1);
+  CHECK(is_valid(store.active) && store.spare_dirty);
+  for (int slot = 0; slot < PATCH_SLOTS; slot++)
+  {
+    CHECK(patch_find((uint8_t)slot) == NULL);
+  }
+
+  /* An erased spare keeps its count through a power cycle, the stamp put it back */
+  CHECK(store.active->erase_count == 1 && erase_spare());
+  uint32_t count = store.spare_erases;
+  power_off();
+  power_on(false, 0);
+  CHECK(mount());
+  CHECK(!store.spare_dirty && store.spare_erases == count && count == 2);
+  power_off();
+}
+
+static void test_recall(void)
+{
+  static param_store_t params, recalled;
+  const size_t last = PARAM_COUNT - 1;
+
+  power_on(true, ERASED);
+  CHECK(mount());
+
+  param_init(&params);
+  param_set_unit(&params, PARAM_CUTOFF, 0.25f);
+  param_set_unit(&params, (param_id_t)last, 1.0f);
+
+  /* patch_save() queues a copy, the task saves it */
+  save_request_t queued;
+  patch_save(9, "Warm pad with a long name", &params);
+  CHECK(xQueueReceive(save_queue, &queued, 0) == pdPASS);
+  CHECK(save(&queued));
+
+  const patch_t *patch = patch_find(9);
+  CHECK(patch != NULL && memcmp(patch->name, "Warm pad wit", PATCH_NAME_LENGTH) == 0);
+  CHECK(patch_find(10) == NULL && patch_find(PATCH_SLOTS) == NULL);
+
+  param_init(&recalled);
+  patch_recall(patch, &recalled);
+  for (size_t id = 0; id < PARAM_COUNT; id++)
+  {
+    CHECK(fabsf(param_get_unit(&recalled, (param_id_t)id) - param_get_unit(&params, (param_id_t)id)) < 1e-4f);
+  }
+
+  /* Still there after a power cycle */
+  power_off();
+  power_on(false, 0);
+  CHECK(mount());
+  CHECK(patch_find(9) != NULL && patch_find(9)->value[PARAM_CUTOFF] == patch->value[PARAM_CUTOFF]);
+  power_off();
+}
+
+static void test_power_cuts(void)
+{
+  power_on(true, ERASED);
+  CHECK(mount());
+  memset(committed, 0, sizeof(committed));
+  erases = cuts = 0;
+  memset(sector_erases, 0, sizeof(sector_erases));
+
+  uint32_t first_generation = store.active->generation;
+
+  for (uint32_t stamp = 1; stamp <= SAVES; stamp++)
+  {
+    uint8_t slot = (uint8_t)random_below(PATCH_SLOTS);
+    save_request_t save_request;
+    request(&save_request, slot, stamp);
+
+    budget = (long)random_below(MAX_OPERATIONS_BETWEEN_CUTS) + 1;
+
+    if (setjmp(power_cut) == 0)
+    {
+      CHECK(save(&save_request));
+      committed[slot] = stamp;
+
+      /* The background erase of the patch task */
+      if (store.spare_dirty && random_below(4) == 0)
+      {
+        CHECK(erase_spare());
+      }
+      continue;
+    }
+
+    /* Power cut, every slot has its last save, the one in progress may have made it */
+    cuts++;
+    budget = -1;
+    power_off();
+    power_on(false, 0);
+    CHECK(mount());
+
+    if (holds(slot, stamp))
+    {
+      committed[slot] = stamp;
+    }
+
+    for (int s = 0; s < PATCH_SLOTS; s++)
+    {
+      CHECK(holds((uint8_t)s, committed[s]));
+    }
+  }
+
+  budget = -1;
+
+  /*
+    The sectors swap at each compaction and wear evenly. The erase redone
+    after a cut falls on whichever sector is spare, and a cut between an
+    erase and its stamp loses the count, so the counts are close rather
+    than exact.
+  */
+  uint32_t compactions = store.active->generation - first_generation;
+  int active = store.active == sector(1);
+  int32_t wear = (int32_t)(sector_erases[0] - sector_erases[1]);
+  int32_t active_drift = (int32_t)(store.active->erase_count - sector_erases[active]);
+  int32_t spare_drift = (int32_t)(spare_erases() - sector_erases[!active]);
+  CHECK(compactions > SAVES / 100);
+  CHECK(abs(wear) <= (int32_t)erases / 16);
+  CHECK(abs(active_drift) <= (int32_t)erases / 16 && abs(spare_drift) <= (int32_t)erases / 16);
+
+  printf("%u saves  %u compactions  %u erases  %u power cuts\n", SAVES, (unsigned)compactions, erases, cuts);
+
+  power_off();
+  unlink(IMAGE);
+}
+
+static void test_no_silence(void)
+{
+  power_on(true, ERASED);
+  CHECK(mount());
+  memset(committed, 0, sizeof(committed));
+
+  /* Saves until a compaction has left the old sector to erase */
+  uint32_t stamp = 0;
+  save_request_t save_request;
+  while (!store.spare_dirty)
+  {
+    stamp++;
+    request(&save_request, (uint8_t)(stamp % 8), stamp);
+    CHECK(save(&save_request));
+    committed[stamp % 8] = stamp;
+  }
+
+  /*
+    With the erase refused the saves go on until the next compaction needs
+    the spare, that one fails and the store is left as it was.
+  */
+  never_silent = true;
+  bool refused = false;
+  for (int i = 0; i < 1000 && !refused; i++)
+  {
+    stamp++;
+    request(&save_request, (uint8_t)(stamp % 8), stamp);
+    refused = !save(&save_request);
+    if (!refused)
+    {
+      committed[stamp % 8] = stamp;
+    }
+  }
+
+  CHECK(refused && store.spare_dirty);
+  for (int s = 0; s < PATCH_SLOTS; s++)
+  {
+    CHECK(holds((uint8_t)s, committed[s]));
+  }
+
+  /* Once there is silence the same save goes through */
+  never_silent = false;
+  CHECK(save(&save_request));
+  committed[stamp % 8] = stamp;
+  for (int s = 0; s < PATCH_SLOTS; s++)
+  {
+    CHECK(holds((uint8_t)s, committed[s]));
+  }
+
+  power_off();
+  unlink(IMAGE);
+}
+
+/* Kernel stand-ins for patch_start() and patch_save() */
+
+static save_request_t queue_item;
+static bool queue_full;
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t *storage, StaticQueue_t *queue)
+{
+  return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+  if (queue_full)
+  {
+    return pdFAIL;
+  }
+
+  memcpy(&queue_item, item, sizeof(queue_item));
+  queue_full = true;
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+  if (!queue_full)
+  {
+    return pdFAIL;
+  }
+
+  memcpy(item, &queue_item, sizeof(queue_item));
+  queue_full = false;
+  return pdPASS;
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t code, const char *name, uint32_t stack_depth, void *parameters,
+                               UBaseType_t priority, StackType_t *stack, StaticTask_t *tcb)
+{
+  return tcb;
+}
+
+int main(void)
+{
+  test_format();
+
+  /* patch_start() mounts the store and creates the queue */
+  power_on(true, ERASED);
+  CHECK(patch_start(2));
+  power_off();
+
+  test_recall();
+  test_no_silence();
+  test_power_cuts();
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,121 @@
+/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+#include <stdbool.h>
+
+#include "silence.h"
+#include "test.h"
+
+/*
+  The silence tracking the effects bypass on. A block is silent only if
+  every sample is below SILENCE_THRESHOLD, either sign. A tail tracker
+  starts idle, wakes on the first block of input, and goes idle again only
+  after hold blocks in a row with both input and output silent. Any sound
+  in between, in or out, starts the count again.
+*/
+
+#define BLOCK (32)
+#define HOLD (4)
+
+static float quiet[BLOCK];
+static float loud[BLOCK];
+
+static void test_detect(void)
+{
+  float block[BLOCK] = {0};
+
+  CHECK(silence_detect(block, BLOCK));
+  CHECK(silence_detect(block, 0));
+
+  /* Just under the threshold is silent, at it is not, whatever the sign or position */
+  block[BLOCK - 1] = SILENCE_THRESHOLD * 0.99f;
+  CHECK(silence_detect(block, BLOCK));
+  block[BLOCK - 1] = -SILENCE_THRESHOLD;
+  CHECK(!silence_detect(block, BLOCK));
+  block[BLOCK - 1] = 0.0f;
+  block[0] = SILENCE_THRESHOLD;
+  CHECK(!silence_detect(block, BLOCK));
+
+  /* Only the first n samples count */
+  CHECK(silence_detect(block + 1, BLOCK - 1));
+}
+
+/**
+ * quiet_blocks
+ * \brief runs blocks of silent input and output through a tracker.
+ * \return true if the tracker went idle on the last of them
+ */
+static bool quiet_blocks(silence_tail_t *tail, int blocks)
+{
+  bool idle = false;
+
+  for (int i = 0; i < blocks; i++)
+  {
+    CHECK(silence_tail_input(tail, true));
+    idle = silence_tail_output(tail, true, quiet, BLOCK);
+  }
+
+  return idle;
+}
+
+static void test_tail(void)
+{
+  silence_tail_t tail;
+
+  /* Idle from the start, silent input is bypassed */
+  silence_tail_init(&tail, HOLD);
+  CHECK(!silence_tail_input(&tail, true));
+
+  /* Input wakes it and is processed */
+  CHECK(silence_tail_input(&tail, false));
+  CHECK(!silence_tail_output(&tail, false, loud, BLOCK));
+
+  /* The input stops but the tail rings on, it stays awake however long */
+  for (int i = 0; i < 3 * HOLD; i++)
+  {
+    CHECK(silence_tail_input(&tail, true));
+    CHECK(!silence_tail_output(&tail, true, loud, BLOCK));
+  }
+
+  /* Quiet output for one block short of the hold is a gap in the tail, not its end */
+  CHECK(!quiet_blocks(&tail, HOLD - 1));
+  CHECK(silence_tail_input(&tail, true));
+  CHECK(!silence_tail_output(&tail, true, loud, BLOCK));
+
+  /* The count starts again after the gap, the full hold is needed */
+  CHECK(!quiet_blocks(&tail, HOLD - 1));
+  CHECK(quiet_blocks(&tail, 1));
+  CHECK(!silence_tail_input(&tail, true));
+
+  /* Input during the hold starts it again too, even if the output is quiet */
+  CHECK(silence_tail_input(&tail, false));
+  CHECK(!quiet_blocks(&tail, HOLD - 1));
+  CHECK(silence_tail_input(&tail, false));
+  CHECK(!silence_tail_output(&tail, false, quiet, BLOCK));
+  CHECK(!quiet_blocks(&tail, HOLD - 1));
+  CHECK(quiet_blocks(&tail, 1));
+
+  /* A hold of one goes idle on the first quiet block */
+  silence_tail_init(&tail, 1);
+  CHECK(silence_tail_input(&tail, false));
+  CHECK(!silence_tail_output(&tail, false, loud, BLOCK));
+  CHECK(quiet_blocks(&tail, 1));
+}
+
+int main(void)
+{
+  for (int i = 0; i < BLOCK; i++)
+  {
+    loud[i] = (i & 1) ? 0.5f : -0.5f;
+  }
+
+  test_detect();
+  test_tail();
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# ------------------------------------------------------------------------------
+#  MIT License
+#  Copyright (c) 2025 Jason Wilden
+#
+#  Permission to use, copy, modify, and/or distribute this code for any purpose
+#  with or without fee is hereby granted, provided the above copyright notice an
+#  this permission notice appear in all copies.
+# ------------------------------------------------------------------------------
+#
+# Generates source/synth/body_ir.c, the cabinet impulse response of the synth's
+# body stage.  The IR is const so it lives in flash, the convolver takes its
+# spectrum when the engine is prepared.
+#
+#   python3 tools/gen_body_ir.py > source/synth/body_ir.c
+#
+# The response is a closed-back guitar cabinet in outline: a second order high
+# pass at the cabinet's low resonance, a peak at that resonance, the cone's
+# presence peak and a steep roll off above it.  An IR measured from a real
+# cabinet can replace it, as 48kHz mono floats of SYNTH_BODY_IR_LENGTH samples
+# (source/synth/synth.h), peak gain no more than 1.
+import cmath
+import math
+
+RATE = 48000.0
+LENGTH = 1024
+
+# Fade the last samples out so the truncation does not click
+FADE = 128
+
+
+def biquad(kind, f0, q, gain_db=0.0):
+    """RBJ cookbook coefficients, normalised to a0 = 1."""
+    w = 2.0 * math.pi * f0 / RATE
+    alpha = math.sin(w) / (2.0 * q)
+    cw = math.cos(w)
+    a = 10.0 ** (gain_db / 40.0)
+
+    if kind == "highpass":
+        b = [(1 + cw) / 2, -(1 + cw), (1 + cw) / 2]
+        d = [1 + alpha, -2 * cw, 1 - alpha]
+    elif kind == "lowpass":
+        b = [(1 - cw) / 2, 1 - cw, (1 - cw) / 2]
+        d = [1 + alpha, -2 * cw, 1 - alpha]
+    else:
+        b = [1 + alpha * a, -2 * cw, 1 - alpha * a]
+        d = [1 + alpha / a, -2 * cw, 1 - alpha / a]
+
+    return [v / d[0] for v in b], [v / d[0] for v in d]
+
+
+STAGES = [
+    biquad("highpass", 75.0, 0.7),
+    biquad("peak", 110.0, 1.4, 5.0),
+    biquad("peak", 2400.0, 1.0, 4.0),
+    biquad("lowpass", 4800.0, 0.8),
+    biquad("lowpass", 6000.0, 0.6),
+]
+
+
+def impulse_response():
+    x = [1.0] + [0.0] * (LENGTH - 1)
+
+    for b, a in STAGES:
+        y = []
+        x1 = x2 = y1 = y2 = 0.0
+        for v in x:
+            out = b[0] * v + b[1] * x1 + b[2] * x2 - a[1] * y1 - a[2] * y2
+            x2, x1 = x1, v
+            y2, y1 = y1, out
+            y.append(out)
+        x = y
+
+    for i in range(FADE):
+        x[LENGTH - FADE + i] *= 0.5 * (1.0 + math.cos(math.pi * (i + 1) / FADE))
+
+    return x
+
+
+def peak_gain(ir):
+    """Largest magnitude of the response, on a log spaced grid from 20Hz to 20kHz."""
+    peak = 0.0
+    for k in range(200):
+        f = 20.0 * 1000.0 ** (k / 199.0)
+        z = cmath.exp(-2j * math.pi * f / RATE)
+        peak = max(peak, abs(sum(v * z ** n for n, v in enumerate(ir))))
+    return peak
+
+
+def main():
+    ir = impulse_response()
+    gain = 1.0 / peak_gain(ir)
+    ir = [v * gain for v in ir]
+
+    print("""/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+
+/* Generated by tools/gen_body_ir.py, do not edit. */
+
+#include "synth.h"
+""")
+    print(f"const float synth_body_ir[SYNTH_BODY_IR_LENGTH] =")
+    print("{")
+    for i in range(0, LENGTH, 4):
+        print("  " + " ".join(f"{v:.9e}f," for v in ir[i:i + 4]))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# ------------------------------------------------------------------------------
+#  MIT License
+#  Copyright (c) 2025 Jason Wilden
+#
+#  Permission to use, copy, modify, and/or distribute this code for any purpose
+#  with or without fee is hereby granted, provided the above copyright notice an
+#  this permission notice appear in all copies.
+# ------------------------------------------------------------------------------
+#
+# Generates source/dsp/fft_tables.c, the twiddle and bit-reversal tables used by
+# the FFT library.  The tables are const so they live in flash.
+#
+#   python3 tools/gen_fft_tables.py > source/dsp/fft_tables.c
+#
+# FFT_MAX_SIZE must match the value in source/dsp/fft.h.
+import math
+
+FFT_MAX_SIZE = 2048
+
+# Twiddles are W^n = cos(2.pi.n/N) - j.sin(2.pi.n/N) for n < 3N/4 which covers
+# the radix-4 butterflies of the N/2 complex transform and the real split.
+TWIDDLE_COUNT = 3 * FFT_MAX_SIZE // 4
+
+# The bit reversal table is for the largest complex transform (N/2 points)
+BITREV_COUNT = FFT_MAX_SIZE // 2
+BITREV_BITS = BITREV_COUNT.bit_length() - 1
+
+
+def q15(v):
+    return max(-32768, min(32767, int(round(v * 32768.0))))
+
+
+def bitrev(i):
+    r = 0
+    for _ in range(BITREV_BITS):
+        r = (r << 1) | (i & 1)
+        i >>= 1
+    return r
+
+
+def emit(name, ctype, values, per_line, fmt):
+    print(f"const {ctype} {name}[{len(values)}] =")
+    print("{")
+    for i in range(0, len(values), per_line):
+        print("  " + " ".join(fmt(v) + "," for v in values[i:i + per_line]))
+    print("};")
+    print()
+
+
+def main():
+    tw = []
+    for n in range(TWIDDLE_COUNT):
+        a = 2.0 * math.pi * n / FFT_MAX_SIZE
+        tw += [math.cos(a), math.sin(a)]
+
+    print("""/*
+   MIT License
+   Copyright (c) 2025 Jason Wilden
+
+   Permission to use, copy, modify, and/or distribute this code for any purpose
+   with or without fee is hereby granted, provided the above copyright notice and
+   this permission notice appear in all copies.
+*/
+
+/* Generated by tools/gen_fft_tables.py, do not edit. */
+
+#include "fft.h"
+""")
+    emit("fft_twiddle_f32", "float", tw, 4, lambda v: f"{v:.9e}f")
+    emit("fft_twiddle_q15", "int16_t", [q15(v) for v in tw], 8, lambda v: f"{v:6d}")
+    emit("fft_bitrev", "uint16_t", [bitrev(i) for i in range(BITREV_COUNT)], 12, lambda v: f"{v:4d}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+# ------------------------------------------------------------------------------
+#  MIT License
+#  Copyright (c) 2025 Jason Wilden
+#
+#  Permission to use, copy, modify, and/or distribute this code for any purpose
+#  with or without fee is hereby granted, provided the above copyright notice an
+#  this permission notice appear in all copies.
+# ------------------------------------------------------------------------------
+#
+# Decodes the SystemView post-mortem ring (-DSYSVIEW_POST_MORTEM=ON, see
+# source/bsp/sysview.h) from a dump of the target's RAM.  Halt the target with
+# any debugger and dump the 128K of SRAM, e.g. from gdb:
+#
+#   dump binary memory ram.bin 0x20000000 0x20020000
+#   python3 tools/sysview_dump.py ram.bin
+#
+# Prints the time spent in each marker and interrupt, and the latency from the
+# audio DMA interrupt to the task it wakes.  --timeline lists every event,
+# --raw writes the event stream, oldest first from the first sync.
+import argparse
+import struct
+import sys
+
+RAM_BASE = 0x20000000
+CHANNEL = 1
+
+# Event ids of SEGGER_SYSVIEW.h.  Ids below 24 have a fixed layout, the number
+# of U32 values they carry is below, the others are sent with their length.
+NOP, OVERFLOW, ISR_ENTER, ISR_EXIT, TASK_START_EXEC, TASK_STOP_EXEC = 0, 1, 2, 3, 4, 5
+TASK_START_READY, TASK_STOP_READY, TASK_CREATE, TASK_INFO = 6, 7, 8, 9
+TRACE_START, TRACE_STOP, SYSTIME_CYCLES, SYSTIME_US, SYSDESC = 10, 11, 12, 13, 14
+MARK_START, MARK_STOP, IDLE, ISR_TO_SCHEDULER = 15, 16, 17, 18
+TIMER_ENTER, TIMER_EXIT, STACK_INFO = 19, 20, 21
+INIT, EX = 24, 31
+EX_NAME_MARKER = 1
+
+FIXED_ARGS = {NOP: 0, OVERFLOW: 1, ISR_ENTER: 1, ISR_EXIT: 0, TASK_START_EXEC: 1, TASK_STOP_EXEC: 0,
+              TASK_START_READY: 1, TASK_STOP_READY: 2, TASK_CREATE: 1, TRACE_START: 0, TRACE_STOP: 0,
+              SYSTIME_CYCLES: 1, SYSTIME_US: 2, MARK_START: 1, MARK_STOP: 1, IDLE: 0, ISR_TO_SCHEDULER: 0,
+              TIMER_ENTER: 1, TIMER_EXIT: 0, STACK_INFO: 4}
+
+SYNC = bytes(10)
+
+
+class Stream:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def u32(self):
+        value, shift = 0, 0
+        while True:
+            b = self.data[self.pos]
+            self.pos += 1
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if b < 0x80:
+                return value
+
+    def string(self):
+        n = self.data[self.pos]
+        self.pos += 1
+        if n == 255:
+            n = (self.data[self.pos] << 8) | self.data[self.pos + 1]
+            self.pos += 2
+        s = self.data[self.pos:self.pos + n].decode("ascii", "replace")
+        self.pos += n
+        return s
+
+
+def find_ring(ram, base, channel):
+    # The RTT control block starts with its id, followed by the buffer counts
+    # and the up buffer descriptors (name, buffer, size, write, read, flags).
+    at = 0
+    while True:
+        at = ram.find(b"SEGGER RTT\0", at)
+        if at < 0:
+            sys.exit("no RTT control block in the dump")
+        up, down = struct.unpack_from("<ii", ram, at + 16)
+        if 0 < up <= 16 and 0 < down <= 16 and channel < up:
+            break
+        at += 1
+
+    _, buf, size, wr, rd, _ = struct.unpack_from("<6I", ram, at + 24 + 24 * channel)
+    start = buf - base
+    if size == 0 or start < 0 or start + size > len(ram) or wr >= size or rd >= size:
+        sys.exit(f"RTT channel {channel} is not a SystemView ring in this dump")
+
+    ring = ram[start:start + size]
+    return ring[rd:wr] if rd <= wr else ring[rd:] + ring[:wr]
+
+
+def decode(data):
+    # The ring's oldest bytes are usually part of an overwritten event, decoding
+    # starts at the first sync, which is repeated every 256 events.
+    at = data.find(SYNC)
+    if at < 0:
+        sys.exit("no sync in the ring, it holds less than 256 events")
+
+    s = Stream(data[at:])
+    events, info = [], {"freq": 100_000_000, "tasks": {}, "isrs": {}, "markers": {}}
+    time = 0
+
+    while s.pos < len(s.data):
+        if s.data[s.pos:s.pos + len(SYNC)] == SYNC:
+            s.pos += len(SYNC)
+            continue
+        try:
+            evt = s.u32()
+            args, text = [], None
+            if evt < 24:
+                if evt == TASK_INFO:
+                    args = [s.u32(), s.u32()]
+                    text = s.string()
+                elif evt == SYSDESC:
+                    text = s.string()
+                elif evt in FIXED_ARGS:
+                    args = [s.u32() for _ in range(FIXED_ARGS[evt])]
+                else:
+                    break
+            else:
+                n = s.u32()
+                payload = Stream(s.data[s.pos:s.pos + n])
+                s.pos += n
+                if evt == INIT:
+                    info["freq"] = payload.u32()
+                elif evt == EX and payload.u32() == EX_NAME_MARKER:
+                    marker = payload.u32()
+                    info["markers"][marker] = payload.string()
+            time += s.u32()
+        except IndexError:
+            break
+
+        if evt == TASK_INFO:
+            info["tasks"][args[0]] = text
+        elif evt == SYSDESC:
+            for field in text.split(","):
+                if field.startswith("I#") and "=" in field:
+                    number, name = field[2:].split("=", 1)
+                    info["isrs"][int(number)] = name
+        events.append((time, evt, args))
+
+    return events, info, data[at:]
+
+
+def us(cycles, info):
+    return cycles * 1e6 / info["freq"]
+
+
+def stats(name, times, info):
+    if times:
+        print(f"  {name:<20} {len(times):6d}  {us(min(times), info):9.1f}  "
+              f"{us(sum(times) / len(times), info):9.1f}  {us(max(times), info):9.1f}")
+
+
+def summary(events, info):
+    marks, isrs, wake = {}, {}, []
+    mark_start, isr_stack, woken = {}, [], {}
+
+    for time, evt, args in events:
+        if evt == MARK_START:
+            mark_start[args[0]] = time
+        elif evt == MARK_STOP and args[0] in mark_start:
+            marks.setdefault(args[0], []).append(time - mark_start.pop(args[0]))
+        elif evt == ISR_ENTER:
+            isr_stack.append((args[0], time))
+        elif evt in (ISR_EXIT, ISR_TO_SCHEDULER) and isr_stack:
+            isr, entered = isr_stack.pop()
+            isrs.setdefault(isr, []).append(time - entered)
+        elif evt == TASK_START_READY and isr_stack:
+            # A task woken by an interrupt, timed from the interrupt's entry
+            woken[args[0]] = isr_stack[-1]
+        elif evt == TASK_START_EXEC and args[0] in woken:
+            isr, entered = woken.pop(args[0])
+            wake.append((isr, args[0], time - entered))
+
+    span = events[-1][0] - events[0][0] if events else 0
+    print(f"{len(events)} events over {us(span, info) / 1000:.1f} ms\n")
+    print(f"  {'':<20} {'count':>6}  {'min us':>9}  {'mean us':>9}  {'max us':>9}")
+    for marker, times in sorted(marks.items()):
+        stats(info["markers"].get(marker, f"marker {marker}"), times, info)
+    for isr, times in sorted(isrs.items()):
+        stats("ISR " + info["isrs"].get(isr, str(isr)), times, info)
+    for isr, task in sorted({(i, t) for i, t, _ in wake}):
+        stats(f"{info['isrs'].get(isr, isr)} > {info['tasks'].get(task, task)}",
+              [d for i, t, d in wake if i == isr and t == task], info)
+
+
+def timeline(events, info):
+    names = {ISR_ENTER: "isr enter", ISR_EXIT: "isr exit", ISR_TO_SCHEDULER: "isr exit to scheduler",
+             TASK_START_EXEC: "run", TASK_START_READY: "ready", TASK_STOP_READY: "block",
+             MARK_START: "mark start", MARK_STOP: "mark stop", IDLE: "idle", OVERFLOW: "overflow"}
+    first = events[0][0] if events else 0
+    for time, evt, args in events:
+        if evt not in names:
+            continue
+        detail = ""
+        if evt == ISR_ENTER:
+            detail = info["isrs"].get(args[0], str(args[0]))
+        elif evt in (TASK_START_EXEC, TASK_START_READY, TASK_STOP_READY):
+            detail = info["tasks"].get(args[0], hex(args[0]))
+        elif evt in (MARK_START, MARK_STOP):
+            detail = info["markers"].get(args[0], str(args[0]))
+        print(f"{us(time - first, info):12.1f}  {names[evt]:<22} {detail}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the SystemView post-mortem ring from a RAM dump")
+    parser.add_argument("dump", help="binary dump of the target RAM")
+    parser.add_argument("--base", type=lambda v: int(v, 0), default=RAM_BASE, help="address of the dump's first byte")
+    parser.add_argument("--channel", type=int, default=CHANNEL, help="RTT channel of the trace")
+    parser.add_argument("--raw", help="write the event stream to this file")
+    parser.add_argument("--timeline", action="store_true", help="list every event")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        ram = f.read()
+
+    events, info, data = decode(find_ring(ram, args.base, args.channel))
+
+    if args.raw:
+        with open(args.raw, "wb") as f:
+            f.write(data)
+
+    if args.timeline:
+        timeline(events, info)
+    else:
+        summary(events, info)
+
+
+if __name__ == "__main__":
+    main()